@@ -33,6 +33,7 @@ from ._module import *
 from ._ufunc import *
 from ._utils.array import is_supported_dtype
 from ._utils.coverage import clone_module
+from ._utils.perf_counters import perf_counters
 
 clone_module(_np, globals(), maybe_convert_to_np_ndarray)
 
@@ -15,6 +15,7 @@
 from __future__ import annotations
 
 import operator
+import os
 import warnings
 from functools import reduce
 from typing import TYPE_CHECKING, Any, Sequence, cast
@@ -27,7 +28,6 @@ from legate.core.utils import OrderedSet
 from .. import _ufunc
 from .._utils import is_np2
 from .._utils.array import (
-    calculate_volume,
     max_identity,
     min_identity,
     to_core_type,
@@ -55,7 +55,6 @@ from .util import (
     convert_to_cupynumeric_ndarray,
     maybe_convert_to_np_ndarray,
     sanitize_shape,
-    tuple_pop,
 )
 
 if is_np2:
@@ -3021,26 +3020,15 @@ class ndarray:
                 "cupynumeric.var only supports int types for `axis` currently"
             )
 
-        # this could be computed as a single pass through the array
-        # by computing both <x^2> and <x> and then computing <x^2> - <x>^2.
-        # this would takee the difference of two large numbers and is unstable
-        # the mean needs to be computed first and the variance computed
-        # directly as <(x-mu)^2>, which then requires two passes through the
-        # data to first compute the mean and then compute the variance
-        # see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-        # TODO(https://github.com/nv-legate/cupynumeric/issues/590)
-
         dtype = self._summation_dtype(dtype)
-        # calculate the mean, but keep the dimensions so that the
-        # mean can be broadcast against the original array
-        mu = self.mean(axis=axis, dtype=dtype, keepdims=True, where=where)
-
         where_array = broadcast_where(where, self.shape)
 
-        # 1D arrays (or equivalent) should benefit from this unary reduction:
-        if axis is None or calculate_volume(tuple_pop(self.shape, axis)) == 1:
-            # this is a scalar reduction and we can optimize this as a single
-            # pass through a scalar reduction
+        # Floating point inputs are reduced in a single pass that merges the
+        # count, mean and sum of squared deviations of each partition with
+        # Welford's (Chan's) update. This is as stable as computing <(x-mu)^2>
+        # directly, but does not need the mean up front
+        # see https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+        if dtype in (np.float32, np.float64):
             result = perform_unary_reduction(
                 UnaryRedCode.VARIANCE,
                 self,
@@ -3049,20 +3037,12 @@ class ndarray:
                 out=out,
                 keepdims=keepdims,
                 where=where_array,
-                # FIXME(wonchanl): the following code blocks on mu to convert
-                # it to a Scalar object. We need to get rid of this blocking by
-                # allowing the extra arguments to be Legate stores
-                args=(Scalar(mu.__array__(), to_core_type(self.dtype)),),
             )
         else:
-            # TODO(https://github.com/nv-legate/cupynumeric/issues/591)
-            # there isn't really support for generic binary reductions
-            # right now all of the current binary reductions are boolean
-            # reductions like allclose. To implement this a single pass would
-            # require a variant of einsum/dot that produces
-            # (self-mu)*(self-mu) rather than self*mu. For now, we have to
-            # compute delta = self-mu in a first pass and then compute
-            # delta*delta in second pass
+            # Other types compute the mean first, keeping the dimensions so
+            # that it can be broadcast against the original array, and then
+            # reduce delta*delta with delta = self-mu in a second pass
+            mu = self.mean(axis=axis, dtype=dtype, keepdims=True, where=where)
             delta = self - mu
 
             result = perform_unary_reduction(
@@ -3670,11 +3650,28 @@ class ndarray:
         GzipFile) or file-like objects that do not support ``fileno()`` (e.g.,
         BytesIO).
 
+        When fid is a filename and sep is "", every partition of the array is
+        written directly to its own byte range of the file in parallel.
+
         Availability
         --------
-        Single CPU
+        Multiple CPUs
 
         """
+        if (
+            sep == ""
+            and isinstance(fid, (str, bytes, os.PathLike))
+            and self.ndim > 0
+            and self.size > 0
+        ):
+            from .._module.io_numpy import _create_output_file
+
+            path = os.fsdecode(fid)
+            # Size the file up front so that every point task can write its
+            # own byte range independently
+            _create_output_file(path, b"", self.nbytes)
+            self._thunk.write_file(path, 0)
+            return
         return self.__array__().tofile(fid, sep=sep, format=format)
 
     def tobytes(self, order: OrderType = "C") -> bytes:
@@ -295,6 +295,7 @@ def perform_scan(
     dtype: npt.DTypeLike | None = None,
     out: ndarray | None = None,
     nan_to_identity: bool = False,
+    exclusive: bool = False,
 ) -> ndarray:
     from .array import ndarray
 
@@ -352,5 +353,6 @@ def perform_scan(
         axis=axis,
         dtype=dtype,
         nan_to_identity=nan_to_identity,
+        exclusive=exclusive,
     )
     return out
@@ -66,7 +66,6 @@ from .indexing import *
 # https://numpy.org/doc/stable/reference/routines.io.html
 #
 # from .io_text import *  # Text files
-# from .io_raw import *  # Raw binary files
 # from .io_string import *  # String formatting
 # from .io_memory import *  # Memory mapping files
 # from .io_text import *  # Text formatting options
@@ -75,6 +74,7 @@ from .indexing import *
 # from .io_binary import *  # Binary format description
 
 from .io_numpy import *  # NumPy binary files (NPY, NPZ)
+from .io_raw import *  # Raw binary files
 
 # --- Linear Algebra
 # https://numpy.org/doc/stable/reference/routines.linalg.html
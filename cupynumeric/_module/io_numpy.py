@@ -14,20 +14,113 @@
 #
 from __future__ import annotations
 
+import io
+import os
 from typing import TYPE_CHECKING, Any
 
+import numpy as np
+
+from .._array.array import ndarray
+from .._array.util import convert_to_cupynumeric_ndarray
+from .._utils.array import is_supported_dtype, to_core_type
+from ..runtime import legate_runtime
+from .creation_data import array
+
 if TYPE_CHECKING:
-    from .._array.array import ndarray
     from os import PathLike
     from typing import BinaryIO
 
-import numpy as np
+    import numpy.typing as npt
+
+    from ..types import NdShape
+
+
+def _is_path(file: Any) -> bool:
+    return isinstance(file, (str, bytes, os.PathLike))
+
+
+def _can_transfer_natively(shape: NdShape, dtype: np.dtype[Any]) -> bool:
+    # The native readers and writers move raw bytes of C-ordered, non-empty
+    # arrays; everything else goes through NumPy
+    return len(shape) > 0 and np.prod(shape) > 0 and is_supported_dtype(dtype)
+
+
+def _read_npy_header(
+    file: str | bytes | PathLike[Any], max_header_size: int
+) -> tuple[NdShape, bool, np.dtype[Any], int] | None:
+    with open(file, "rb") as f:
+        try:
+            version = np.lib.format.read_magic(f)
+        except ValueError:
+            # Not a .npy file (e.g. an .npz archive or a pickle)
+            return None
+        if version == (1, 0):
+            read_header = np.lib.format.read_array_header_1_0
+        elif version == (2, 0):
+            read_header = np.lib.format.read_array_header_2_0
+        else:
+            return None
+        shape, fortran_order, dtype = read_header(
+            f, max_header_size=max_header_size  # type: ignore [call-arg]
+        )
+        return shape, fortran_order, dtype, f.tell()
+
+
+def _attach_read_only(mapped: npt.NDArray[Any]) -> ndarray:
+    from .._thunk.deferred import DeferredArray
+
+    if mapped.size == 0 or not is_supported_dtype(mapped.dtype):
+        return array(mapped)
+    # Attach a Fortran-ordered mapping through its C-ordered transpose
+    fortran_order = not mapped.flags.c_contiguous
+    if fortran_order:
+        mapped = mapped.T
+    # The pages are mapped with PROT_READ, so they are attached as a
+    # read-only allocation: Legate reads them in place and makes its own
+    # copy before anything could write to the store
+    store = legate_runtime.create_store_from_buffer(
+        to_core_type(mapped.dtype), mapped.shape, mapped, read_only=True
+    )
+    result = ndarray(shape=None, thunk=DeferredArray(store), writeable=False)
+    return result.transpose() if fortran_order else result
 
-from .creation_data import array
+
+def _create_output_file(path: str, header: bytes, size: int) -> None:
+    # Python control code runs on every rank, so this must be safe to repeat
+    # while other ranks' point tasks are already writing: the file is never
+    # emptied, every rank writes the same header, and truncating to the final
+    # size only drops stale bytes past the end
+    fd = os.open(path, os.O_WRONLY | os.O_CREAT, 0o666)
+    try:
+        os.pwrite(fd, header, 0)
+        os.ftruncate(fd, size)
+    finally:
+        os.close(fd)
+
+
+def _write_npy_header(file: str, shape: NdShape, dtype: np.dtype[Any]) -> int:
+    header = {
+        "descr": np.lib.format.dtype_to_descr(dtype),
+        "fortran_order": False,
+        "shape": shape,
+    }
+    buf = io.BytesIO()
+    try:
+        np.lib.format.write_array_header_1_0(buf, header)
+    except ValueError:
+        # The header is too large for format version 1.0
+        buf = io.BytesIO()
+        np.lib.format.write_array_header_2_0(buf, header)
+    offset = buf.tell()
+    _create_output_file(
+        file, buf.getvalue(), offset + int(np.prod(shape)) * dtype.itemsize
+    )
+    return offset
 
 
 def load(
     file: str | bytes | PathLike[Any] | BinaryIO,
+    mmap_mode: str | None = None,
     *,
     max_header_size: int = 10000,
 ) -> ndarray:
@@ -40,6 +133,12 @@ def load(
         The file to read. File-like objects must support the
         ``seek()`` and ``read()`` methods and must always
         be opened in binary mode.
+    mmap_mode : {None, 'r'}, optional
+        If not None, then memory-map the file instead of reading it. The
+        result is a read-only array backed directly by the mapped pages, so
+        only the pages that are actually accessed are read from disk, and
+        processes on the same node that map the same file share them through
+        the page cache. Only read-only mapping is supported.
     max_header_size : int, optional
         Maximum allowed size of the header.  Large headers may not be safe
         to load securely and thus require explicitly passing a larger value.
@@ -61,15 +160,109 @@ def load(
 
     Notes
     -----
-    cuPyNumeric does not currently support ``.npz`` and pickled files.
+    When `file` is a path, the header is parsed once and every partition of
+    the result is read directly from the file in parallel. File-like objects,
+    as well as arrays with unsupported or non-native dtypes, are loaded with
+    NumPy on a single process. cuPyNumeric does not currently support
+    ``.npz`` and pickled files.
+
+    With ``mmap_mode='r'`` no data is copied at load time; the mapping is
+    only valid on the node where the file is accessible.
 
     Availability
     --------
-    Single CPU
+    Multiple CPUs
     """
+    if mmap_mode is not None:
+        if mmap_mode != "r":
+            raise NotImplementedError(
+                f"cuPyNumeric does not support mmap_mode={mmap_mode!r}"
+            )
+        mapped = np.load(
+            file,
+            mmap_mode=mmap_mode,
+            max_header_size=max_header_size,  # type: ignore [call-arg]
+        )
+        if not isinstance(mapped, np.ndarray):
+            raise NotImplementedError(
+                "cuPyNumeric can only memory-map .npy files"
+            )
+        return _attach_read_only(mapped)
+
+    if _is_path(file):
+        header = _read_npy_header(
+            file,  # type: ignore [arg-type]
+            max_header_size,
+        )
+        if header is not None:
+            shape, fortran_order, dtype, offset = header
+            if _can_transfer_natively(shape, dtype):
+                # A Fortran-ordered array is the transpose of a C-ordered one
+                result = ndarray(
+                    shape=shape[::-1] if fortran_order else shape,
+                    dtype=dtype,
+                )
+                result._thunk.read_file(os.fsdecode(file), offset)
+                return result.transpose() if fortran_order else result
+
     return array(
         np.load(
             file,
             max_header_size=max_header_size,  # type: ignore [call-arg]
         )
     )
+
+
+def save(
+    file: str | bytes | PathLike[Any] | BinaryIO,
+    arr: ndarray,
+    allow_pickle: bool = True,
+    fix_imports: bool = True,
+) -> None:
+    """
+    Save an array to a binary file in NumPy ``.npy`` format.
+
+    Parameters
+    ----------
+    file : file, str, or pathlib.Path
+        File or filename to which the data is saved. If file is a
+        file-object, then the filename is unchanged. If file is a string or
+        Path, a ``.npy`` extension will be appended to the filename if it does
+        not already have one.
+    arr : array_like
+        Array data to be saved.
+    allow_pickle : bool, optional
+        Allow saving object arrays using Python pickles.
+    fix_imports : bool, optional
+        Only useful in forcing objects in object arrays on Python 3 to be
+        pickled in a Python 2 compatible way.
+
+    See Also
+    --------
+    numpy.save
+
+    Notes
+    -----
+    When `file` is a path, the header is written once and every partition of
+    `arr` is written directly to its byte range of the file in parallel.
+    File-like objects are written by NumPy on a single process.
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    arr = convert_to_cupynumeric_ndarray(arr)
+    if _is_path(file) and _can_transfer_natively(arr.shape, arr.dtype):
+        path = os.fsdecode(file)  # type: ignore [arg-type]
+        if not path.endswith(".npy"):
+            path += ".npy"
+        offset = _write_npy_header(path, arr.shape, arr.dtype)
+        arr._thunk.write_file(path, offset)
+        return
+
+    np.save(
+        file,
+        arr.__array__(),
+        allow_pickle=allow_pickle,
+        fix_imports=fix_imports,
+    )
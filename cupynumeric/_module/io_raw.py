@@ -0,0 +1,98 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+import os
+from typing import TYPE_CHECKING, Any
+
+import numpy as np
+
+from .._array.array import ndarray
+from .._utils.array import is_supported_dtype
+from .creation_data import array
+from .io_numpy import _is_path
+
+if TYPE_CHECKING:
+    from os import PathLike
+    from typing import BinaryIO
+
+    import numpy.typing as npt
+
+
+def fromfile(
+    file: str | bytes | PathLike[Any] | BinaryIO,
+    dtype: npt.DTypeLike = float,
+    count: int = -1,
+    sep: str = "",
+    offset: int = 0,
+) -> ndarray:
+    """
+    Construct an array from data in a text or binary file.
+
+    Parameters
+    ----------
+    file : file or str or Path
+        Open file object or filename.
+    dtype : data-type
+        Data type of the returned array. For binary files, it is used to
+        determine the size and byte-order of the items in the file.
+    count : int
+        Number of items to read. ``-1`` means all items (i.e., the complete
+        file).
+    sep : str
+        Separator between items if file is a text file. Empty ("") separator
+        means the file should be treated as binary.
+    offset : int
+        The offset (in bytes) from the file's current position. Defaults to
+        0. Only permitted for binary files.
+
+    Returns
+    -------
+    out : ndarray
+        A one-dimensional array holding the data in the file.
+
+    See Also
+    --------
+    numpy.fromfile
+
+    Notes
+    -----
+    Binary files given by path are read in parallel, with every partition of
+    the result reading its own byte range. Text files and open file objects
+    are read by NumPy on a single process.
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    dt = np.dtype(dtype)
+    if _is_path(file) and sep == "" and is_supported_dtype(dt):
+        path = os.fsdecode(file)  # type: ignore [arg-type]
+        available = (os.path.getsize(path) - offset) // dt.itemsize
+        if count < 0:
+            count = available
+        elif count > available:
+            raise ValueError(
+                f"{path} holds {available} items of {dt}, "
+                f"but {count} were requested"
+            )
+        if count > 0:
+            result = ndarray(shape=(count,), dtype=dt)
+            result._thunk.read_file(path, offset)
+            return result
+
+    return array(
+        np.fromfile(file, dtype=dtype, count=count, sep=sep, offset=offset)
+    )
@@ -15,7 +15,7 @@
 from __future__ import annotations
 
 import re
-from collections import Counter
+from collections import Counter, OrderedDict
 from itertools import chain
 from typing import TYPE_CHECKING, Any, Literal
 
@@ -428,6 +428,144 @@ class NullOptimizer(oe.paths.PathOptimizer):  # type: ignore [misc,no-any-unimpo
         return [(0, 1)] + [(0, -1)] * (len(inputs) - 2)
 
 
+class _EinsumPlan:
+    """
+    The pairwise contractions chosen for an einsum call, along with the
+    intermediate arrays of its most recent evaluation. Cached plans keep at
+    most _EINSUM_BUFFER_BUDGET bytes of intermediates alive in total.
+    """
+
+    def __init__(
+        self,
+        steps: list[tuple[tuple[int, ...], str, str, str]],
+    ) -> None:
+        self.steps = steps
+        # A pairwise step always produces a fresh array, so when that array
+        # is only ever read by a later pairwise step (and thus cannot escape
+        # as a view in the final result), subsequent evaluations can write
+        # into it instead of allocating a new one.
+        self.reusable = [False] * len(steps)
+        self.buffers: list[ndarray | None] = [None] * len(steps)
+        num_operands = sum(len(indices) for indices, *_ in steps) - (
+            len(steps) - 1
+        )
+        producers: list[int | None] = [None] * num_operands
+        for step, (indices, *_) in enumerate(steps):
+            consumed = [producers.pop(i) for i in indices]
+            if len(indices) == 2:
+                for producer in consumed:
+                    if producer is not None and len(steps[producer][0]) == 2:
+                        self.reusable[producer] = True
+            producers.append(step)
+
+    @property
+    def buffer_bytes(self) -> int:
+        return sum(buf.nbytes for buf in self.buffers if buf is not None)
+
+    def drop_buffers(self) -> None:
+        self.buffers = [None] * len(self.steps)
+
+
+_EINSUM_PLAN_CACHE_SIZE = 64
+# Upper bound on the bytes of intermediates that cached plans keep alive
+# between einsum calls
+_EINSUM_BUFFER_BUDGET = 256 << 20
+_einsum_plans: OrderedDict[Any, _EinsumPlan] = OrderedDict()
+
+
+def _trim_einsum_buffers(keep: _EinsumPlan) -> None:
+    # Drop the intermediates of the least recently used plans first, and
+    # those of the current plan only if it exceeds the budget on its own
+    total = sum(plan.buffer_bytes for plan in _einsum_plans.values())
+    for plan in _einsum_plans.values():
+        if total <= _EINSUM_BUFFER_BUDGET:
+            return
+        if plan is not keep:
+            total -= plan.buffer_bytes
+            plan.drop_buffers()
+    if total > _EINSUM_BUFFER_BUDGET:
+        keep.drop_buffers()
+
+
+def clear_einsum_cache() -> None:
+    """
+    Forget the contraction plans cached by :func:`einsum`, releasing the
+    intermediate arrays they keep for reuse by later calls.
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    _einsum_plans.clear()
+
+
+def _make_einsum_plan(
+    expr: str, operands: list[ndarray], optimize: Any
+) -> _EinsumPlan:
+    # This call normalizes the expression (adds the output part if it's
+    # missing, expands '...') and checks for some errors (mismatch on number
+    # of dimensions between operand and expression, wrong number of operands,
+    # unknown modes on output, a mode appearing under two different
+    # non-singleton extents).
+    _, contractions = oe.contract_path(
+        expr, *operands, einsum_call=True, optimize=optimize
+    )
+    steps = []
+    for indices, _, sub_expr, _, _ in contractions:
+        assert len(indices) == 1 or len(indices) == 2
+        if len(indices) == 1:
+            m = re.match(r"([a-zA-Z]*)->([a-zA-Z]*)", sub_expr)
+            if m is None:
+                raise NotImplementedError("Non-alphabetic mode labels")
+            a_modes, b_modes, out_modes = m.group(1), "", m.group(2)
+        else:
+            m = re.match(r"([a-zA-Z]*),([a-zA-Z]*)->([a-zA-Z]*)", sub_expr)
+            if m is None:
+                raise NotImplementedError("Non-alphabetic mode labels")
+            a_modes, b_modes, out_modes = m.groups()
+        steps.append((tuple(indices), a_modes, b_modes, out_modes))
+    return _EinsumPlan(steps)
+
+
+def _get_einsum_plan(
+    expr: str,
+    operands: list[ndarray],
+    optimize: Any,
+    dtype: np.dtype[Any] | None,
+    casting: CastingKind,
+) -> _EinsumPlan:
+    # Only named strategies are deterministic enough to be cached; explicit
+    # paths and custom optimizers are planned on every call
+    if isinstance(optimize, NullOptimizer):
+        optimize_key: str | None = ""
+    elif isinstance(optimize, str):
+        optimize_key = optimize
+    else:
+        optimize_key = None
+    if optimize_key is None:
+        return _make_einsum_plan(expr, operands, optimize)
+
+    key = (
+        expr,
+        tuple(op.shape for op in operands),
+        tuple(op.dtype for op in operands),
+        optimize_key,
+        None if dtype is None else np.dtype(dtype),
+        casting,
+    )
+    plan = _einsum_plans.get(key)
+    if plan is not None:
+        _einsum_plans.move_to_end(key)
+        return plan
+
+    plan = _make_einsum_plan(expr, operands, optimize)
+    _einsum_plans[key] = plan
+    if len(_einsum_plans) > _EINSUM_PLAN_CACHE_SIZE:
+        _, evicted = _einsum_plans.popitem(last=False)
+        evicted.drop_buffers()
+    return plan
+
+
 def _maybe_cast_input(
     arr: ndarray, to_dtype: np.dtype[Any], casting: CastingKind
 ) -> ndarray:
@@ -741,43 +879,27 @@ def einsum(
     elif optimize is False:
         optimize = NullOptimizer()
 
-    # This call normalizes the expression (adds the output part if it's
-    # missing, expands '...') and checks for some errors (mismatch on number
-    # of dimensions between operand and expression, wrong number of operands,
-    # unknown modes on output, a mode appearing under two different
-    # non-singleton extents).
-    computed_operands, contractions = oe.contract_path(
-        expr, *operands_list, einsum_call=True, optimize=optimize
-    )
-    for indices, _, sub_expr, _, _ in contractions:
-        assert len(indices) == 1 or len(indices) == 2
+    plan = _get_einsum_plan(expr, operands_list, optimize, dtype, casting)
+    computed_operands: list[ndarray] = list(operands_list)
+    for step, (indices, a_modes, b_modes, out_modes) in enumerate(plan.steps):
         a = computed_operands.pop(indices[0])
         b = computed_operands.pop(indices[1]) if len(indices) == 2 else None
-        if b is None:
-            m = re.match(r"([a-zA-Z]*)->([a-zA-Z]*)", sub_expr)
-            if m is None:
-                raise NotImplementedError("Non-alphabetic mode labels")
-            a_modes = list(m.group(1))
-            b_modes = []
-            out_modes = list(m.group(2))
-        else:
-            m = re.match(r"([a-zA-Z]*),([a-zA-Z]*)->([a-zA-Z]*)", sub_expr)
-            if m is None:
-                raise NotImplementedError("Non-alphabetic mode labels")
-            a_modes = list(m.group(1))
-            b_modes = list(m.group(2))
-            out_modes = list(m.group(3))
         sub_result = _contract(
-            a_modes,
-            b_modes,
-            out_modes,
+            list(a_modes),
+            list(b_modes),
+            list(out_modes),
             a,
             b,
-            out=(out if len(computed_operands) == 0 else None),
+            out=(
+                out if len(computed_operands) == 0 else plan.buffers[step]
+            ),
             casting=casting,
             dtype=dtype,
         )
+        if plan.reusable[step]:
+            plan.buffers[step] = sub_result
         computed_operands.append(sub_result)
+    _trim_einsum_buffers(plan)
 
     assert len(computed_operands) == 1
     return computed_operands[0]
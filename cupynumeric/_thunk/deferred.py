@@ -34,6 +34,7 @@ from typing import (
 import legate.core.types as ty
 import numpy as np
 from legate.core import (
+    LEGATE_MAX_DIM,
     Annotation,
     LogicalStore,
     ReductionOpKind,
@@ -56,6 +57,7 @@ from .._utils.array import (
     min_identity,
     to_core_type,
 )
+from .._utils.linalg import matmul_launch_shape
 from ..config import (
     BinaryOpCode,
     BitGeneratorDistribution,
@@ -64,11 +66,13 @@ from ..config import (
     ConvertCode,
     ConvolveMethod,
     CuPyNumericOpCode,
+    MatMulActivation,
     RandGenCode,
     UnaryOpCode,
     UnaryRedCode,
 )
 from ..linalg._cholesky import cholesky_deferred
+from ..linalg._eigh import eigh_deferred
 from ..linalg._qr import qr_deferred
 from ..linalg._solve import solve_deferred
 from ..linalg._svd import svd_deferred
@@ -108,6 +112,64 @@ def _prod(tpl: Sequence[int]) -> int:
     return reduce(lambda a, b: a * b, tpl, 1)
 
 
+def _rounding_divide(
+    lhs: tuple[int, ...], rhs: tuple[int, ...]
+) -> tuple[int, ...]:
+    return tuple((lh + rh - 1) // rh for (lh, rh) in zip(lhs, rhs))
+
+
+def _matmul_launch_plan(
+    m: int, n: int, k: int, acc_itemsize: int, itemsize: int
+) -> tuple[tuple[int, int], tuple[int, int], int, int, int]:
+    """
+    Plan the launches of an (m, k) x (k, n) matrix product. Returns the
+    color shape and tile shape of the result, the replication depth, and
+    the size and number of the batches the contracted dimension is split
+    into.
+    """
+    from ..settings import settings
+
+    # 1M elements, we should probably even go larger
+    MIN_MATRIX_SIZE = 1 << 20
+    # If the matrices are too small don't partition them
+    if (
+        not legate_settings.test()
+        and m * n <= MIN_MATRIX_SIZE
+        and (m + n) * k <= MIN_MATRIX_SIZE
+    ):
+        initial_color_shape, depth = (1, 1), 1
+    else:
+        initial_color_shape, depth = matmul_launch_shape(
+            m,
+            n,
+            k,
+            runtime.num_procs,
+            acc_itemsize,
+            settings.matmul_cache_size(),
+        )
+    tile_shape = _rounding_divide((m, n), initial_color_shape)
+    color_shape = _rounding_divide((m, n), tile_shape)
+
+    # TODO: better heuristics?
+    # default corresponds to 128MB (to store A and B tile)
+    max_elements_per_tile = settings.matmul_cache_size() // itemsize
+    layer_k = _rounding_divide((k,), (depth,))[0]
+    total_elements_rhs = (tile_shape[0] + tile_shape[1]) * layer_k
+    num_batches = _rounding_divide(
+        (total_elements_rhs,), (max_elements_per_tile,)
+    )[0]
+    k_batch_size = _rounding_divide((layer_k,), (num_batches,))[0]
+    k_color = _rounding_divide((k,), (k_batch_size,))[0]
+
+    return (
+        (color_shape[0], color_shape[1]),
+        (tile_shape[0], tile_shape[1]),
+        depth,
+        k_batch_size,
+        k_color,
+    )
+
+
 R = TypeVar("R")
 P = ParamSpec("P")
 
@@ -183,7 +245,7 @@ _UNARY_RED_TO_REDUCTION_OPS: dict[int, int] = {
 _UNARY_RED_IDENTITIES: dict[UnaryRedCode, Callable[[Any], Any]] = {
     UnaryRedCode.SUM: lambda _: 0,
     UnaryRedCode.SUM_SQUARES: lambda _: 0,
-    UnaryRedCode.VARIANCE: lambda _: 0,
+    UnaryRedCode.VARIANCE: lambda _: (0, 0, 0),
     UnaryRedCode.PROD: lambda _: 1,
     UnaryRedCode.MIN: min_identity,
     UnaryRedCode.MAX: max_identity,
@@ -207,12 +269,45 @@ _UNARY_RED_IDENTITIES: dict[UnaryRedCode, Callable[[Any], Any]] = {
     UnaryRedCode.NANSUM: lambda _: 0,
 }
 
+# Full reductions that take a flag selecting pairwise summation
+_PAIRWISE_SUM_OPS = (
+    UnaryRedCode.SUM,
+    UnaryRedCode.SUM_SQUARES,
+    UnaryRedCode.NANSUM,
+)
+
+# Comparisons that can write their result as a bit-packed mask
+_PACKED_COMPARISONS = (
+    BinaryOpCode.EQUAL,
+    BinaryOpCode.GREATER,
+    BinaryOpCode.GREATER_EQUAL,
+    BinaryOpCode.LESS,
+    BinaryOpCode.LESS_EQUAL,
+    BinaryOpCode.NOT_EQUAL,
+)
+
+
+def _packed_mask(mask: Any, shape: NdShape) -> LogicalStore | None:
+    """Returns the bit-packed store of a boolean array written by a
+    comparison, if its values were never materialized and it covers exactly
+    the given shape. Tasks that receive it must partition it with
+    _packed_mask_scale, relative to a store of the full shape."""
+    if not isinstance(mask, DeferredArray) or mask._packed is None:
+        return None
+    return mask._packed if mask.shape == tuple(shape) else None
+
+
+def _packed_mask_scale(ndim: int) -> tuple[int, ...]:
+    # Each byte of a packed mask holds 8 elements of the last axis
+    return (1,) * (ndim - 1) + (8,)
+
 
 @unique
 class BlasOperation(IntEnum):
     VV = 1
     MV = 2
     MM = 3
+    BMM = 4
 
 
 class DeferredArray(NumPyThunk):
@@ -227,21 +322,41 @@ class DeferredArray(NumPyThunk):
         self,
         base: LogicalStore,
         numpy_array: npt.NDArray[Any] | None = None,
+        fresh: bool = False,
     ) -> None:
         super().__init__(base.type.to_numpy_dtype())
         assert base is not None
         assert isinstance(base, LogicalStore)
-        self.base: LogicalStore = base  # a Legate Store
+        self._base: LogicalStore = base  # a Legate Store
+        # Boolean arrays written by a comparison on CPUs may hold their
+        # values bit-packed in this store instead (see bits/packed_mask.h),
+        # until something accesses the base. Only fresh arrays, whose store
+        # was created for them and never accessed, can be written that way.
+        self._packed: LogicalStore | None = None
+        self._fresh = fresh
         self.numpy_array = (
             None if numpy_array is None else weakref.ref(numpy_array)
         )
 
+    @property
+    def base(self) -> LogicalStore:
+        self._fresh = False
+        if self._packed is not None:
+            self._unpack_mask()
+        return self._base
+
+    @base.setter
+    def base(self, base: LogicalStore) -> None:
+        self._base = base
+        self._packed = None
+        self._fresh = False
+
     def __str__(self) -> str:
         return f"DeferredArray(base: {self.base})"
 
     @property
     def shape(self) -> NdShape:
-        return tuple(self.base.shape)
+        return tuple(self._base.shape)
 
     @property
     def ndim(self) -> int:
@@ -617,10 +732,14 @@ class DeferredArray(NumPyThunk):
             out.fill(np.zeros((), dtype=out.dtype))
             return False, rhs, out, self
 
-        key_store = key.base
-        # bring key to the same shape as rhs
-        for i in range(key_store.ndim, rhs.ndim):
-            key_store = key_store.promote(i, rhs.shape[i])
+        # A bit-packed key is used as is when it covers all dimensions and
+        # is not the indexed array itself, whose base would unpack it
+        packed = _packed_mask(key, rhs.shape) if key is not rhs else None
+        if packed is None:
+            key_store = key.base
+            # bring key to the same shape as rhs
+            for i in range(key_store.ndim, rhs.ndim):
+                key_store = key_store.promote(i, rhs.shape[i])
 
         # has_set_value && set_value.size==1 corresponds to the case
         # when a[bool_indices]=scalar
@@ -628,7 +747,7 @@ class DeferredArray(NumPyThunk):
         # and avoid calling Copy
         has_set_value = set_value is not None and set_value.size == 1
         if has_set_value:
-            mask = DeferredArray(base=key_store)
+            mask = key if packed is not None else DeferredArray(key_store)
             rhs.putmask(mask, set_value)
             return False, rhs, rhs, self
         else:
@@ -652,12 +771,21 @@ class DeferredArray(NumPyThunk):
             )
             task.add_output(out.base)
             p_rhs = task.add_input(rhs.base)
-            p_key = task.add_input(key_store)
+            p_key = task.add_input(key_store if packed is None else packed)
             task.add_scalar_arg(is_set, ty.bool_)
             task.add_scalar_arg(key_dims, ty.int64)
-            task.add_constraint(align(p_rhs, p_key))
-            if rhs.base.ndim > 1:
-                task.add_constraint(broadcast(p_rhs, range(1, rhs.base.ndim)))
+            if packed is None:
+                task.add_constraint(align(p_rhs, p_key))
+                if rhs.base.ndim > 1:
+                    task.add_constraint(
+                        broadcast(p_rhs, range(1, rhs.base.ndim))
+                    )
+            else:
+                # The rows of rhs follow the partition of the packed key
+                scale_factors = _packed_mask_scale(rhs.ndim)
+                task.add_constraint(scale(scale_factors, p_key, p_rhs))
+                if rhs.ndim > 1:
+                    task.add_constraint(broadcast(p_key, range(1, rhs.ndim)))
             task.execute()
 
             # TODO : current implementation of the ND output regions
@@ -1461,7 +1589,28 @@ class DeferredArray(NumPyThunk):
 
         # Test for special cases where we can use BLAS
         blas_op = None
-        if any(c != 2 for c in mode_counts.values()):
+        batch_modes = lhs_modes[:-2]
+        if (
+            lhs_thunk.dtype in supported_dtypes
+            and len(batch_modes) > 0
+            # the contracted mode is appended as an extra dimension
+            and len(lhs_modes) < LEGATE_MAX_DIM
+            and rhs1_modes[:-2] == batch_modes
+            and rhs2_modes[:-2] == batch_modes
+            and len(rhs1_modes) == len(lhs_modes)
+            and len(rhs2_modes) == len(lhs_modes)
+            and all(mode_counts[mode] == 3 for mode in batch_modes)
+            and all(
+                mode_counts[mode] == 2
+                for mode in lhs_modes[-2:] + rhs1_modes[-2:]
+            )
+            # views may have no unit stride within a matrix, which BLAS
+            # can't consume
+            and not rhs1_thunk.base.transformed
+            and not rhs2_thunk.base.transformed
+        ):
+            blas_op = BlasOperation.BMM
+        elif any(c != 2 for c in mode_counts.values()):
             pass
         elif (
             len(lhs_modes) == 0
@@ -1481,6 +1630,16 @@ class DeferredArray(NumPyThunk):
             )
         ):
             blas_op = BlasOperation.MV
+        elif (
+            lhs_thunk.dtype in supported_dtypes
+            and len(rhs1_modes) > 2
+            and len(rhs2_modes) == 1
+            and len(lhs_modes) == len(rhs1_modes) - 1
+            and lhs_modes[:-1] == rhs1_modes[:-2]
+            and rhs2_modes[0] in rhs1_modes[-2:]
+        ):
+            # Batched matrix-vector multiply over the leading modes
+            blas_op = BlasOperation.MV
         elif (
             lhs_thunk.dtype in supported_dtypes
             and len(lhs_modes) == 2
@@ -1489,18 +1648,41 @@ class DeferredArray(NumPyThunk):
         ):
             blas_op = BlasOperation.MM
 
+        is_half = lhs_thunk.dtype == np.float16
+
+        # Matrix products are split into launches over batches of the
+        # contracted mode. When there is only one such batch, each task
+        # computes its tiles of the result in full and can write them out
+        # through the task's epilogue, in the result's own type.
+        mm_plan = None
+        fused_epilogue = False
+        if blas_op == BlasOperation.MM:
+            (contracted,) = (mode for mode in rhs1_modes if mode in rhs2_modes)
+            mm_plan = _matmul_launch_plan(
+                mode2extent[lhs_modes[0]],
+                mode2extent[lhs_modes[1]],
+                mode2extent[contracted],
+                # half-precision tiles are accumulated in single precision
+                4 if is_half else lhs_thunk.dtype.itemsize,
+                rhs1_thunk.dtype.itemsize,
+            )
+            _, _, depth, _, k_color = mm_plan
+            fused_epilogue = depth == 1 and k_color == 1
+
         # Our half-precision BLAS tasks expect a single-precision accumulator.
         # This is done to avoid the precision loss that results from repeated
         # reductions into a half-precision accumulator, and to enable the use
         # of tensor cores. In the general-purpose tensor contraction case
-        # below the tasks do this adjustment internally.
-        if blas_op is not None and lhs_thunk.dtype == np.float16:
+        # below the tasks do this adjustment internally, as does the epilogue
+        # of a fused matrix product.
+        if blas_op is not None and is_half and not fused_epilogue:
             lhs_thunk = runtime.create_empty_thunk(
                 lhs_thunk.shape, ty.float32, inputs=[lhs_thunk]
             )
 
-        # Clear output array
-        lhs_thunk.fill(np.array(0, dtype=lhs_thunk.dtype))
+        # Clear output array; a fused epilogue overwrites it instead
+        if not fused_epilogue:
+            lhs_thunk.fill(np.array(0, dtype=lhs_thunk.dtype))
 
         # Pull out the stores
         lhs = lhs_thunk.base  # type: ignore
@@ -1535,14 +1717,19 @@ class DeferredArray(NumPyThunk):
                 if len(rhs1_modes) == 1:
                     rhs1, rhs2 = rhs2, rhs1
                     rhs1_modes, rhs2_modes = rhs2_modes, rhs1_modes
-                # ba,b->a --> ab,b->a
-                if rhs1_modes[0] == rhs2_modes[0]:
-                    rhs1 = rhs1.transpose([1, 0])
-                    rhs1_modes = [rhs1_modes[1], rhs1_modes[0]]
-
-                (m, n) = rhs1.shape
-                rhs2 = rhs2.promote(0, m)
-                lhs = lhs.promote(1, n)
+                # ...ba,b->...a --> ...ab,b->...a
+                ndim = len(rhs1_modes)
+                if rhs1_modes[-2] == rhs2_modes[0]:
+                    axes = list(range(ndim - 2)) + [ndim - 1, ndim - 2]
+                    rhs1 = rhs1.transpose(axes)
+                    rhs1_modes = [rhs1_modes[axis] for axis in axes]
+
+                # Any leading modes of the matrix are batch modes, which the
+                # vector is broadcast along
+                n = rhs1.shape[-1]
+                for dim in range(ndim - 1):
+                    rhs2 = rhs2.promote(dim, rhs1.shape[dim])
+                lhs = lhs.promote(ndim - 1, n)
 
                 task = legate_runtime.create_auto_task(
                     self.library, CuPyNumericOpCode.MATVECMUL
@@ -1580,63 +1767,10 @@ class DeferredArray(NumPyThunk):
                 assert n == rhs2.shape[1]
                 assert k == rhs2.shape[0]
 
-                def rounding_divide(
-                    lhs: tuple[int, ...], rhs: tuple[int, ...]
-                ) -> tuple[int, ...]:
-                    return tuple(
-                        (lh + rh - 1) // rh for (lh, rh) in zip(lhs, rhs)
-                    )
-
-                # TODO: better heuristics
-                def choose_2d_color_shape(
-                    shape: tuple[int, int]
-                ) -> tuple[int, int]:
-                    # 1M elements, we should probably even go larger
-                    MIN_MATRIX_SIZE = 1 << 20
-                    # If the matrix is too small don't partition it at all
-                    if (not legate_settings.test()) and shape[0] * shape[
-                        1
-                    ] <= MIN_MATRIX_SIZE:
-                        return (1, 1)
-
-                    # start with 1D and re-balance by powers of 2
-                    # (don't worry about other primes)
-                    color_shape = (runtime.num_procs, 1)
-                    while (
-                        shape[0] / color_shape[0]
-                        < 2 * shape[1] / color_shape[1]
-                        and color_shape[0] % 2 == 0
-                    ):
-                        color_shape = (color_shape[0] // 2, color_shape[1] * 2)
-
-                    return color_shape
-
-                # TODO: better heuristics?
-                def choose_batchsize(
-                    tilesize: tuple[int, int], k: int, itemsize: int
-                ) -> int:
-                    # default corresponds to 128MB (to store A and B tile)
-                    from ..settings import settings
-
-                    max_elements_per_tile = (
-                        settings.matmul_cache_size() // itemsize
-                    )
-                    total_elements_rhs = (tilesize[0] + tilesize[1]) * k
-                    num_batches = rounding_divide(
-                        (total_elements_rhs,), (max_elements_per_tile,)
-                    )[0]
-                    batch_size = rounding_divide((k,), (num_batches,))[0]
-
-                    return batch_size
-
-                # choose color-shape/k_batch_size
-                initial_color_shape = choose_2d_color_shape((m, n))
-                tile_shape = rounding_divide((m, n), initial_color_shape)
-                color_shape = rounding_divide((m, n), tile_shape)
-                k_batch_size = choose_batchsize(
-                    tile_shape, k, rhs1_thunk.dtype.itemsize  # type: ignore
+                assert mm_plan is not None
+                color_shape, tile_shape, depth, k_batch_size, k_color = (
+                    mm_plan
                 )
-                k_color = rounding_divide((k,), (k_batch_size,))
 
                 # initial partition of lhs defined py tile-shape
                 tiled_lhs = lhs.partition_by_tiling(tile_shape)
@@ -1647,6 +1781,34 @@ class DeferredArray(NumPyThunk):
                     (k_batch_size, tile_shape[1])
                 )
 
+                def run_fused_matmul(
+                    tiled_lhs: LogicalStorePartition,
+                    tiled_rhs1: LogicalStorePartition,
+                    tiled_rhs2: LogicalStorePartition,
+                ) -> None:
+                    # Each task overwrites its tiles of the result, so the
+                    # result is not an input, and it is written in its own
+                    # type by the epilogue
+                    manual_task = legate_runtime.create_manual_task(
+                        self.library, CuPyNumericOpCode.MATMUL, color_shape
+                    )
+
+                    manual_task.add_output(tiled_lhs)
+                    manual_task.add_input(
+                        tiled_rhs1, (dimension(0), constant(0))
+                    )
+                    manual_task.add_input(
+                        tiled_rhs2, (constant(0), dimension(1))
+                    )
+                    # alpha, beta and the activation
+                    manual_task.add_scalar_arg(1.0, ty.float64)
+                    manual_task.add_scalar_arg(0.0, ty.float64)
+                    manual_task.add_scalar_arg(
+                        MatMulActivation.NONE, ty.int32
+                    )
+
+                    manual_task.execute()
+
                 def run_matmul_for_batch(
                     tiled_lhs: LogicalStorePartition,
                     tiled_rhs1: LogicalStorePartition,
@@ -1668,15 +1830,97 @@ class DeferredArray(NumPyThunk):
 
                     manual_task.execute()
 
-                for i in range(0, k_color[0]):
-                    run_matmul_for_batch(tiled_lhs, tiled_rhs1, tiled_rhs2, i)
+                def run_replicated_matmul_for_batches(
+                    tiled_lhs: LogicalStorePartition,
+                    tiled_rhs1: LogicalStorePartition,
+                    tiled_rhs2: LogicalStorePartition,
+                    i: int,
+                    layers: int,
+                ) -> None:
+                    # Layer l of the launch multiplies k batch i + l into its
+                    # own copy of the result tiles, which are summed into lhs
+                    manual_task = legate_runtime.create_manual_task(
+                        self.library,
+                        CuPyNumericOpCode.MATMUL,
+                        (layers,) + color_shape,
+                    )
+
+                    manual_task.add_reduction(
+                        tiled_lhs,
+                        ReductionOpKind.ADD,
+                        (dimension(1), dimension(2)),
+                    )
+                    manual_task.add_input(
+                        tiled_rhs1, (dimension(1), dimension(0) + i)
+                    )
+                    manual_task.add_input(
+                        tiled_rhs2, (dimension(0) + i, dimension(2))
+                    )
+
+                    manual_task.execute()
+
+                if fused_epilogue:
+                    run_fused_matmul(tiled_lhs, tiled_rhs1, tiled_rhs2)
+                elif depth == 1:
+                    for i in range(0, k_color):
+                        run_matmul_for_batch(
+                            tiled_lhs, tiled_rhs1, tiled_rhs2, i
+                        )
+                else:
+                    for i in range(0, k_color, depth):
+                        run_replicated_matmul_for_batches(
+                            tiled_lhs,
+                            tiled_rhs1,
+                            tiled_rhs2,
+                            i,
+                            min(depth, k_color - i),
+                        )
+
+            elif blas_op == BlasOperation.BMM:
+                # Batched matrix-matrix multiply over the leading modes
+
+                # ...(cb/bc),...(ab/ba)->...ac --> ...(ab/ba),...(cb/bc)->...ac
+                if lhs_modes[-2] not in rhs1_modes:
+                    rhs1, rhs2 = rhs2, rhs1
+                    rhs1_modes, rhs2_modes = rhs2_modes, rhs1_modes
+                nbatch = len(batch_modes)
+                swap_last = list(range(nbatch)) + [nbatch + 1, nbatch]
+                # ...ba,?->...ac --> ...ab,?->...ac
+                if rhs1_modes[-2] != lhs_modes[-2]:
+                    rhs1 = rhs1.transpose(swap_last)
+                    rhs1_modes = [rhs1_modes[dim] for dim in swap_last]
+                # ?,...bc->...ac --> ?,...cb->...ac
+                if rhs2_modes[-2] != lhs_modes[-1]:
+                    rhs2 = rhs2.transpose(swap_last)
+                    rhs2_modes = [rhs2_modes[dim] for dim in swap_last]
+
+                # Promote all stores to ...acb, so that they can be aligned
+                # and partitioned along the batch modes only
+                (m, n) = lhs.shape[-2:]
+                k = rhs1.shape[-1]
+                lhs = lhs.promote(nbatch + 2, k)
+                rhs1 = rhs1.promote(nbatch + 1, n)
+                rhs2 = rhs2.promote(nbatch, m)
+
+                task = legate_runtime.create_auto_task(
+                    self.library, CuPyNumericOpCode.BATCHED_MATMUL
+                )
+                p_lhs = task.add_reduction(lhs, ReductionOpKind.ADD)
+                p_rhs1 = task.add_input(rhs1)
+                p_rhs2 = task.add_input(rhs2)
+                task.add_constraint(align(p_lhs, p_rhs1))
+                task.add_constraint(align(p_lhs, p_rhs2))
+                task.add_constraint(
+                    broadcast(p_lhs, range(nbatch, nbatch + 3))
+                )
+                task.execute()
 
             else:
                 assert False
 
             # If we used a single-precision intermediate accumulator, cast the
             # result back to half-precision.
-            if rhs1_thunk.dtype == np.float16:
+            if is_half and not fused_epilogue:
                 self.convert(
                     lhs_thunk,
                     warn=False,
@@ -1925,10 +2169,15 @@ class DeferredArray(NumPyThunk):
             self.library, CuPyNumericOpCode.PUTMASK
         )
         p_self = task.add_input(self.base)
-        p_mask = task.add_input(mask.base)
+        packed = _packed_mask(mask, self.shape)
+        p_mask = task.add_input(mask.base if packed is None else packed)
         p_values = task.add_input(values_new)
         task.add_output(self.base, p_self)
-        task.add_constraint(align(p_self, p_mask))
+        if packed is None:
+            task.add_constraint(align(p_self, p_mask))
+        else:
+            scale_factors = _packed_mask_scale(self.ndim)
+            task.add_constraint(scale(scale_factors, p_mask, p_self))
         task.add_constraint(align(p_self, p_values))
         task.execute()
 
@@ -2128,9 +2377,12 @@ class DeferredArray(NumPyThunk):
             self.library, CuPyNumericOpCode.NONZERO
         )
 
-        p_self = task.add_input(self.base)
+        # A packed mask is read on its own, as its padding bits are never set
+        packed = _packed_mask(self, self.shape)
+        p_self = task.add_input(self.base if packed is None else packed)
         for result in results:
             task.add_output(result.base)
+        task.add_scalar_arg(packed is not None, ty.bool_)
 
         if self.ndim > 1:
             task.add_constraint(broadcast(p_self, range(1, self.ndim)))
@@ -3225,6 +3477,9 @@ class DeferredArray(NumPyThunk):
             UnaryRedCode.NANARGMIN,
         )
 
+        # Variance reduces into (count, mean, M2) states
+        welford = op == UnaryRedCode.VARIANCE
+
         if argred:
             argred_dtype = runtime.get_argred_type(rhs_array.base.type)
             lhs_array = runtime.create_empty_thunk(
@@ -3232,6 +3487,13 @@ class DeferredArray(NumPyThunk):
                 dtype=argred_dtype,
                 inputs=[self],
             )
+        elif welford:
+            welford_dtype = runtime.get_welford_type(rhs_array.base.type)
+            lhs_array = runtime.create_empty_thunk(
+                lhs_array.shape,
+                dtype=welford_dtype,
+                inputs=[self],
+            )
 
         is_where = bool(where is not None)
         # See if we are doing reduction to a point or another region
@@ -3258,17 +3520,30 @@ class DeferredArray(NumPyThunk):
                 )
 
                 task.add_reduction(lhs, _UNARY_RED_TO_REDUCTION_OPS[op])
-                task.add_input(rhs_array.base)
+                p_rhs = task.add_input(rhs_array.base)
                 task.add_scalar_arg(op, ty.int32)
                 task.add_scalar_arg(rhs_array.shape, (ty.int64,))
                 task.add_scalar_arg(is_where, ty.bool_)
                 if is_where:
-                    task.add_input(where.base)
-                    task.add_alignment(rhs_array.base, where.base)
+                    packed = _packed_mask(where, rhs_array.shape)
+                    if packed is None:
+                        task.add_input(where.base)
+                        task.add_alignment(rhs_array.base, where.base)
+                    else:
+                        p_where = task.add_input(packed)
+                        scale_factors = _packed_mask_scale(rhs_array.ndim)
+                        task.add_constraint(
+                            scale(scale_factors, p_where, p_rhs)
+                        )
 
                 for arg in args:
                     task.add_scalar_arg(arg)
 
+                if op in _PAIRWISE_SUM_OPS:
+                    from ..settings import settings
+
+                    task.add_scalar_arg(settings.pairwise_sum(), ty.bool_)
+
                 task.execute()
 
         else:
@@ -3327,6 +3602,12 @@ class DeferredArray(NumPyThunk):
                 lhs_array,
                 True,
             )
+        elif welford:
+            self.unary_op(
+                UnaryOpCode.GETM2,
+                lhs_array,
+                True,
+            )
 
     def isclose(
         self, rhs1: Any, rhs2: Any, rtol: float, atol: float, equal_nan: bool
@@ -3348,6 +3629,9 @@ class DeferredArray(NumPyThunk):
         where: Any,
         args: tuple[Scalar, ...],
     ) -> None:
+        if self._packed_compare(op_code, src1, src2, args):
+            return
+
         lhs = self.base
         src1 = src1._copy_if_partially_overlapping(self)
         rhs1 = src1._broadcast(lhs.shape)
@@ -3371,6 +3655,72 @@ class DeferredArray(NumPyThunk):
 
             task.execute()
 
+    def _packed_compare(
+        self,
+        op_code: BinaryOpCode,
+        src1: DeferredArray,
+        src2: DeferredArray,
+        args: tuple[Scalar, ...],
+    ) -> bool:
+        # A comparison into a fresh array, typically the result of a ufunc,
+        # can write a bit-packed mask: the consumers that know the format
+        # read it directly, and any other access to the base unpacks it
+        # first. Packed masks are only consumed by CPU and OpenMP tasks.
+        from ..settings import settings
+
+        if (
+            op_code not in _PACKED_COMPARISONS
+            or args
+            or not self._fresh
+            or self.dtype != bool
+            or self.ndim == 0
+            or self.size == 0
+            or src1.dtype != src2.dtype
+            or self._base.has_scalar_storage
+            or runtime.num_gpus > 0
+            or not settings.packed_masks()
+        ):
+            return False
+
+        shape = self.shape
+        rhs1 = src1._broadcast(shape)
+        rhs2 = src2._broadcast(shape)
+        packed = legate_runtime.create_store(
+            ty.uint8, shape=shape[:-1] + ((shape[-1] + 7) // 8,)
+        )
+
+        with Annotation({"OpCode": op_code.name}):
+            task = legate_runtime.create_auto_task(
+                self.library, CuPyNumericOpCode.PACKED_COMPARE
+            )
+            p_out = task.add_output(packed)
+            p_rhs1 = task.add_input(rhs1)
+            p_rhs2 = task.add_input(rhs2)
+            task.add_scalar_arg(op_code.value, ty.int32)
+
+            task.add_constraint(align(p_rhs1, p_rhs2))
+            task.add_constraint(
+                scale(_packed_mask_scale(self.ndim), p_out, p_rhs1)
+            )
+
+            task.execute()
+
+        self._packed = packed
+        return True
+
+    def _unpack_mask(self) -> None:
+        # Expands the packed mask into the bool store, through the padded
+        # bytes UNPACKBITS produces
+        assert self._packed is not None
+        packed, self._packed = self._packed, None
+        axis = self.ndim - 1
+        padded = legate_runtime.create_store(
+            ty.uint8, shape=packed.shape[:-1] + (packed.shape[-1] * 8,)
+        )
+        DeferredArray(padded).unpackbits(DeferredArray(packed), axis, "little")
+        values = padded.slice(axis, slice(0, self.shape[-1]))
+        self.convert(DeferredArray(values), warn=False)
+
     @auto_convert("src1", "src2")
     def binary_reduction(
         self,
@@ -3413,9 +3763,10 @@ class DeferredArray(NumPyThunk):
     @auto_convert("src1", "src2", "src3")
     def where(self, src1: Any, src2: Any, src3: Any) -> None:
         lhs = self.base
-        rhs1 = src1._broadcast(lhs.shape)
         rhs2 = src2._broadcast(lhs.shape)
         rhs3 = src3._broadcast(lhs.shape)
+        packed = _packed_mask(src1, lhs.shape)
+        rhs1 = src1._broadcast(lhs.shape) if packed is None else packed
 
         # Populate the Legate launcher
         task = legate_runtime.create_auto_task(
@@ -3426,7 +3777,11 @@ class DeferredArray(NumPyThunk):
         p_rhs2 = task.add_input(rhs2)
         p_rhs3 = task.add_input(rhs3)
 
-        task.add_constraint(align(p_lhs, p_rhs1))
+        if packed is None:
+            task.add_constraint(align(p_lhs, p_rhs1))
+        else:
+            scale_factors = _packed_mask_scale(lhs.ndim)
+            task.add_constraint(scale(scale_factors, p_rhs1, p_lhs))
         task.add_constraint(align(p_lhs, p_rhs2))
         task.add_constraint(align(p_lhs, p_rhs3))
 
@@ -3461,6 +3816,10 @@ class DeferredArray(NumPyThunk):
     def cholesky(self, src: Any) -> None:
         cholesky_deferred(self, src)
 
+    @auto_convert("w", "v")
+    def eigh(self, w: Any, v: Any, lower: bool) -> None:
+        eigh_deferred(self, w, v, lower)
+
     @auto_convert("q", "r")
     def qr(self, q: Any, r: Any) -> None:
         qr_deferred(self, q, r)
@@ -3481,13 +3840,8 @@ class DeferredArray(NumPyThunk):
         axis: int,
         dtype: npt.DTypeLike | None,
         nan_to_identity: bool,
+        exclusive: bool = False,
     ) -> None:
-        # local sum
-        # storage for local sums accessible
-        temp = runtime.create_unbound_thunk(
-            dtype=self.base.type, ndim=self.ndim
-        )
-
         if axis == rhs.ndim - 1:
             input = rhs
             output = self
@@ -3500,33 +3854,54 @@ class DeferredArray(NumPyThunk):
             input.copy(swapped, deep=True)
             output = input
 
+        # When there are at least as many rows as processors, keep the scan
+        # axis unpartitioned so that every row is finished by a single local
+        # pass and the global fixup (and its temporary) can be skipped
+        num_rows = input.size // max(input.shape[-1], 1)
+        fused = runtime.num_procs == 1 or (
+            input.ndim > 1 and num_rows >= runtime.num_procs
+        )
+
         task = legate_runtime.create_auto_task(
             self.library, CuPyNumericOpCode.SCAN_LOCAL
         )
         p_out = task.add_output(output.base)
         p_in = task.add_input(input.base)
-        task.add_output(temp.base)
+        if not fused:
+            # local sum
+            # storage for local sums accessible
+            temp = runtime.create_unbound_thunk(
+                dtype=self.base.type, ndim=self.ndim
+            )
+            task.add_output(temp.base)
         task.add_scalar_arg(op, ty.int32)
         task.add_scalar_arg(nan_to_identity, ty.bool_)
+        task.add_scalar_arg(exclusive, ty.bool_)
 
         task.add_constraint(align(p_in, p_out))
+        if fused:
+            task.add_constraint(broadcast(p_in, (input.ndim - 1,)))
 
         task.execute()
-        # Global sum
-        # NOTE: Assumes the partitioning stays the same from previous task.
-        # NOTE: Each node will do a sum up to its index, alternatively could
-        # do one centralized scan and broadcast (slightly less redundant work)
-        task = legate_runtime.create_auto_task(
-            self.library, CuPyNumericOpCode.SCAN_GLOBAL
-        )
-        task.add_input(output.base)
-        p_temp = task.add_input(temp.base)
-        task.add_output(output.base)
-        task.add_scalar_arg(op, ty.int32)
 
-        task.add_constraint(broadcast(p_temp))
+        if not fused:
+            # Global sum
+            # NOTE: Assumes the partitioning stays the same from previous
+            # task.
+            # NOTE: Each node will do a sum up to its index, alternatively
+            # could do one centralized scan and broadcast (slightly less
+            # redundant work)
+            task = legate_runtime.create_auto_task(
+                self.library, CuPyNumericOpCode.SCAN_GLOBAL
+            )
+            task.add_input(output.base)
+            p_temp = task.add_input(temp.base)
+            task.add_output(output.base)
+            task.add_scalar_arg(op, ty.int32)
+
+            task.add_constraint(broadcast(p_temp))
 
-        task.execute()
+            task.execute()
 
         # if axes were swapped, turn them back
         if output is not self:
@@ -3639,6 +4014,41 @@ class DeferredArray(NumPyThunk):
             task.add_scalar_arg(arg, ty.float64)
         task.execute()
 
+    # Each point task reads its own C-ordered block of the array, stored at
+    # byte `offset` of `filename`, straight into its instance
+    def read_file(self, filename: str, offset: int) -> None:
+        task = legate_runtime.create_auto_task(
+            self.library, CuPyNumericOpCode.FILE_READ
+        )
+        task.add_output(self.base)
+        task.add_scalar_arg(filename, ty.string_type)
+        task.add_scalar_arg(offset, ty.int64)
+        task.add_scalar_arg(self.shape, (ty.int64,))
+        task.throws_exception(OSError)
+        task.execute()
+
+    # The file should already have its final size, see _create_output_file
+    def write_file(self, filename: str, offset: int) -> None:
+        src = self
+        if self.base.has_scalar_storage or self.base.transformed:
+            src = cast(
+                DeferredArray,
+                runtime.create_empty_thunk(
+                    self.shape, self.base.type, inputs=[self]
+                ),
+            )
+            src.copy(self, deep=True)
+
+        task = legate_runtime.create_auto_task(
+            self.library, CuPyNumericOpCode.FILE_WRITE
+        )
+        task.add_input(src.base)
+        task.add_scalar_arg(filename, ty.string_type)
+        task.add_scalar_arg(offset, ty.int64)
+        task.add_scalar_arg(self.shape, (ty.int64,))
+        task.throws_exception(OSError)
+        task.execute()
+
     @auto_convert("src")
     def packbits(self, src: Any, axis: int | None, bitorder: BitOrder) -> None:
         bitorder_code = getattr(Bitorder, bitorder.upper())
@@ -161,6 +161,16 @@ _BINARY_OPS: dict[BinaryOpCode, Any] = {
     BinaryOpCode.SUBTRACT: np.subtract,
 }
 
+_SCAN_OPS: dict[ScanCode, Any] = {
+    ScanCode.LOGICAL_AND: np.logical_and,
+    ScanCode.LOGICAL_OR: np.logical_or,
+    ScanCode.LOGICAL_XOR: np.logical_xor,
+    ScanCode.MAX: np.maximum,
+    ScanCode.MIN: np.minimum,
+    ScanCode.PROD: np.multiply,
+    ScanCode.SUM: np.add,
+}
+
 _WINDOW_OPS: dict[
     WindowOpCode,
     Callable[[float], npt.NDArray[Any]]
@@ -187,6 +197,18 @@ def eye_reference(
     return res
 
 
+def scan_identity(op: ScanCode, dtype: np.dtype[Any]) -> Any:
+    if op is ScanCode.MAX or op is ScanCode.MIN:
+        is_max = op is ScanCode.MAX
+        if dtype.kind == "f":
+            return -np.inf if is_max else np.inf
+        if dtype.kind == "b":
+            return not is_max
+        info = np.iinfo(dtype)
+        return info.min if is_max else info.max
+    return _SCAN_OPS[op].identity
+
+
 def diagonal_reference(a: npt.NDArray[Any], axes: NdShape) -> npt.NDArray[Any]:
     transpose_axes = tuple(ax for ax in range(a.ndim) if ax not in axes)
     axes = tuple(sorted(axes, reverse=False, key=lambda i: a.shape[i]))
@@ -1566,15 +1588,13 @@ class EagerArray(NumPyThunk):
                 keepdims=keepdims,
             )
         elif op == UnaryRedCode.VARIANCE:
-            (mu,) = args
-            centered = np.subtract(rhs.array, np.asarray(mu))
-            squares = np.square(centered)
+            where = where if not isinstance(where, EagerArray) else where.array
+            mu = np.mean(rhs.array, axis=orig_axis, keepdims=True, where=where)
+            squares = np.square(np.subtract(rhs.array, mu))
             np.sum(
                 squares,
                 axis=orig_axis,
-                where=where
-                if not isinstance(where, EagerArray)
-                else where.array,
+                where=where,
                 keepdims=keepdims,
                 out=self.array,
             )
@@ -1689,6 +1709,25 @@ class EagerArray(NumPyThunk):
 
             self.array[:] = result
 
+    def eigh(self, w: Any, v: Any, lower: bool) -> None:
+        self.check_eager_args(w, v)
+        if self.deferred is not None:
+            self.deferred.eigh(w, v, lower)
+        else:
+            uplo = "L" if lower else "U"
+            try:
+                if v is None:
+                    result_w = np.linalg.eigvalsh(self.array, uplo)
+                else:
+                    result_w, result_v = np.linalg.eigh(self.array, uplo)
+            except np.linalg.LinAlgError as e:
+                from ..linalg import LinAlgError
+
+                raise LinAlgError(e) from e
+            w.array[:] = result_w
+            if v is not None:
+                v.array[:] = result_v
+
     def qr(self, q: Any, r: Any) -> None:
         self.check_eager_args(q, r)
         if self.deferred is not None:
@@ -1743,23 +1782,29 @@ class EagerArray(NumPyThunk):
         axis: int,
         dtype: npt.DTypeLike | None,
         nan_to_identity: bool,
+        exclusive: bool = False,
     ) -> None:
         self.check_eager_args(rhs)
         if self.deferred is not None:
-            self.deferred.scan(op, rhs, axis, dtype, nan_to_identity)
+            self.deferred.scan(
+                op, rhs, axis, dtype, nan_to_identity, exclusive
+            )
             return
-        if op is ScanCode.SUM:
-            if nan_to_identity is False:
-                np.cumsum(rhs.array, axis, dtype, self.array)
-            else:
-                np.nancumsum(rhs.array, axis, dtype, self.array)
-        elif op is ScanCode.PROD:
-            if nan_to_identity is False:
-                np.cumprod(rhs.array, axis, dtype, self.array)
-            else:
-                np.nancumprod(rhs.array, axis, dtype, self.array)
+        if op is ScanCode.SUM and nan_to_identity:
+            np.nancumsum(rhs.array, axis, dtype, self.array)
+        elif op is ScanCode.PROD and nan_to_identity:
+            np.nancumprod(rhs.array, axis, dtype, self.array)
+        elif op in _SCAN_OPS:
+            _SCAN_OPS[op].accumulate(
+                rhs.array, axis=axis, dtype=dtype, out=self.array
+            )
         else:
             raise RuntimeError(f"unsupported scan op {op}")
+        if exclusive:
+            # shift the inclusive result by one along the scan axis
+            result = np.moveaxis(self.array, axis, -1)
+            result[..., 1:] = result[..., :-1].copy()
+            result[..., 0] = scan_identity(op, self.array.dtype)
 
     def unique(self) -> NumPyThunk:
         if self.deferred is not None:
@@ -1774,6 +1819,25 @@ class EagerArray(NumPyThunk):
             fn = _WINDOW_OPS[op_code]
             self.array[:] = fn(M, *args)
 
+    def read_file(self, filename: str, offset: int) -> None:
+        if self.deferred is not None:
+            self.deferred.read_file(filename, offset)
+        else:
+            self.array[...] = np.fromfile(
+                filename,
+                dtype=self.array.dtype,
+                count=self.array.size,
+                offset=offset,
+            ).reshape(self.array.shape)
+
+    def write_file(self, filename: str, offset: int) -> None:
+        if self.deferred is not None:
+            self.deferred.write_file(filename, offset)
+        else:
+            with open(filename, "r+b") as f:
+                f.seek(offset)
+                f.write(np.ascontiguousarray(self.array).tobytes())
+
     def packbits(self, src: Any, axis: int | None, bitorder: BitOrder) -> None:
         self.check_eager_args(src)
         if self.deferred is not None:
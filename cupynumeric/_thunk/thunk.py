@@ -707,6 +707,10 @@ class NumPyThunk(ABC):
     def cholesky(self, src: Any) -> None:
         ...
 
+    @abstractmethod
+    def eigh(self, w: Any, v: Any, lower: bool) -> None:
+        ...
+
     @abstractmethod
     def qr(self, q: Any, r: Any) -> None:
         ...
@@ -727,6 +731,7 @@ class NumPyThunk(ABC):
         axis: int,
         dtype: npt.DTypeLike | None,
         nan_to_identity: bool,
+        exclusive: bool = False,
     ) -> None:
         ...
 
@@ -738,6 +743,14 @@ class NumPyThunk(ABC):
     def create_window(self, op_code: WindowOpCode, M: Any, *args: Any) -> None:
         ...
 
+    @abstractmethod
+    def read_file(self, filename: str, offset: int) -> None:
+        ...
+
+    @abstractmethod
+    def write_file(self, filename: str, offset: int) -> None:
+        ...
+
     @abstractmethod
     def packbits(self, src: Any, axis: int | None, bitorder: BitOrder) -> None:
         ...
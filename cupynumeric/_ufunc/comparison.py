@@ -19,7 +19,7 @@ from typing import TYPE_CHECKING, Any
 import numpy as np
 
 from .._array.util import convert_to_cupynumeric_ndarray
-from ..config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from ..config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
 from .ufunc import (
     all_dtypes,
     create_binary_ufunc,
@@ -162,6 +162,7 @@ logical_and = create_binary_ufunc(
     BinaryOpCode.LOGICAL_AND,
     relation_types_of(all_dtypes),
     red_code=UnaryRedCode.ALL,
+    scan_code=ScanCode.LOGICAL_AND,
 )
 
 logical_or = create_binary_ufunc(
@@ -170,6 +171,7 @@ logical_or = create_binary_ufunc(
     BinaryOpCode.LOGICAL_OR,
     relation_types_of(all_dtypes),
     red_code=UnaryRedCode.ANY,
+    scan_code=ScanCode.LOGICAL_OR,
 )
 
 logical_xor = create_binary_ufunc(
@@ -177,6 +179,7 @@ logical_xor = create_binary_ufunc(
     "logical_xor",
     BinaryOpCode.LOGICAL_XOR,
     relation_types_of(all_dtypes),
+    scan_code=ScanCode.LOGICAL_XOR,
 )
 
 logical_not = create_unary_ufunc(
@@ -197,6 +200,7 @@ maximum = create_binary_ufunc(
     BinaryOpCode.MAXIMUM,
     all_dtypes,
     red_code=UnaryRedCode.MAX,
+    scan_code=ScanCode.MAX,
 )
 
 fmax = maximum
@@ -207,6 +211,7 @@ minimum = create_binary_ufunc(
     BinaryOpCode.MINIMUM,
     all_dtypes,
     red_code=UnaryRedCode.MIN,
+    scan_code=ScanCode.MIN,
 )
 
 fmin = minimum
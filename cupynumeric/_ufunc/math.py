@@ -14,7 +14,7 @@
 #
 from __future__ import annotations
 
-from ..config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from ..config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
 from .ufunc import (
     all_but_boolean,
     all_dtypes,
@@ -32,6 +32,7 @@ add = create_binary_ufunc(
     BinaryOpCode.ADD,
     all_dtypes,
     red_code=UnaryRedCode.SUM,
+    scan_code=ScanCode.SUM,
 )
 
 subtract = create_binary_ufunc(
@@ -47,6 +48,7 @@ multiply = create_binary_ufunc(
     BinaryOpCode.MULTIPLY,
     all_dtypes,
     red_code=UnaryRedCode.PROD,
+    scan_code=ScanCode.PROD,
 )
 
 true_divide = create_binary_ufunc(
@@ -19,13 +19,13 @@ from typing import TYPE_CHECKING, Any, Callable, Sequence, TypeAlias
 import numpy as np
 from legate.core.utils import OrderedSet
 
-from .._array.thunk import perform_unary_reduction
+from .._array.thunk import perform_scan, perform_unary_reduction
 from .._array.util import (
     add_boilerplate,
     check_writeable,
     convert_to_cupynumeric_ndarray,
 )
-from ..config import BinaryOpCode, UnaryOpCode, UnaryRedCode
+from ..config import BinaryOpCode, ScanCode, UnaryOpCode, UnaryRedCode
 from ..types import NdShape
 
 if TYPE_CHECKING:
@@ -602,6 +602,7 @@ class binary_ufunc(ufunc):
         op_code: BinaryOpCode,
         types: dict[tuple[str, str], str],
         red_code: UnaryRedCode | None = None,
+        scan_code: ScanCode | None = None,
         use_common_type: bool = True,
         post_resolution_check: PostResolutionCheckFunc | None = None,
     ) -> None:
@@ -618,6 +619,7 @@ class binary_ufunc(ufunc):
             tuple[str | type, ...], tuple[np.dtype[Any], ...]
         ] = {}
         self._red_code = red_code
+        self._scan_code = scan_code
         self._use_common_type = use_common_type
         if post_resolution_check is None:
             self._post_resolution_check = _default_post_resolution_check
@@ -892,6 +894,87 @@ class binary_ufunc(ufunc):
             res_dtype=res_dtype,
         )
 
+    @add_boilerplate("array")
+    def accumulate(
+        self,
+        array: ndarray,
+        axis: int = 0,
+        dtype: np.dtype[Any] | None = None,
+        out: ndarray | None = None,
+    ) -> ndarray:
+        """
+        accumulate(array, axis=0, dtype=None, out=None)
+
+        Accumulate the result of applying the operator to all elements.
+
+        For example, add.accumulate() is equivalent to cumsum() and
+        maximum.accumulate() computes a running maximum.
+
+        Parameters
+        ----------
+        array : array_like
+            The array to act on.
+        axis : int, optional
+            The axis along which to apply the accumulation; default is zero.
+        dtype : data-type code, optional
+            The data-type used to represent the intermediate results. Defaults
+            to the data-type of the output array if such is provided, or the
+            data-type of the input array if no output array is provided.
+        out : ndarray, optional
+            A location into which the result is stored. If not provided or
+            None, a freshly-allocated array is returned.
+
+        Returns
+        -------
+        r : ndarray
+            The accumulated values. If `out` was supplied, `r` is a reference
+            to `out`.
+
+        See Also
+        --------
+        numpy.ufunc.accumulate
+        """
+        if self._scan_code is None:
+            raise NotImplementedError(
+                f"accumulate for {self} is not yet implemented"
+            )
+
+        if array.ndim == 0:
+            raise TypeError("cannot accumulate on a scalar")
+
+        if self._op_code in (
+            BinaryOpCode.LOGICAL_AND,
+            BinaryOpCode.LOGICAL_OR,
+            BinaryOpCode.LOGICAL_XOR,
+        ):
+            # Logical scans run on booleans, like NumPy's, and are only cast
+            # when the caller asks for another type
+            result = perform_scan(
+                self._scan_code, array, axis=axis, dtype=np.dtype(bool)
+            )
+            if out is not None:
+                out[...] = result
+                return out
+            if dtype is None or np.dtype(dtype) == result.dtype:
+                return result
+            return result.astype(dtype)
+
+        if dtype is None:
+            dtype = array.dtype if out is None else out.dtype
+        dtype = np.dtype(dtype)
+
+        if dtype.kind == "c" and self._scan_code in (
+            ScanCode.MAX,
+            ScanCode.MIN,
+        ):
+            raise NotImplementedError(
+                f"accumulate for {self} is not supported for complex types"
+            )
+
+        return perform_scan(
+            self._scan_code, array, axis=axis, dtype=dtype, out=out
+        )
+
 
 def _parse_unary_ufunc_type(ty: str) -> tuple[str, str]:
     if len(ty) == 1:
@@ -935,6 +1018,7 @@ def create_binary_ufunc(
     op_code: BinaryOpCode,
     types: Sequence[str],
     red_code: UnaryRedCode | None = None,
+    scan_code: ScanCode | None = None,
     use_common_type: bool = True,
     post_resolution_check: PostResolutionCheckFunc | None = None,
 ) -> binary_ufunc:
@@ -946,6 +1030,7 @@ def create_binary_ufunc(
         op_code,
         types_dict,
         red_code=red_code,
+        scan_code=scan_code,
         use_common_type=use_common_type,
         post_resolution_check=post_resolution_check,
     )
@@ -128,3 +128,52 @@ def tensordot_modes(a_ndim: int, b_ndim: int, axes: AxesPairLike) -> Modes:
     ]
 
     return (a_modes, b_modes, a_out + b_out)
+
+
+def _divisors(value: int) -> list[int]:
+    return [d for d in range(1, value + 1) if value % d == 0]
+
+
+def matmul_launch_shape(
+    m: int, n: int, k: int, procs: int, itemsize: int, replica_budget: int
+) -> tuple[tuple[int, int], int]:
+    """
+    Choose how to distribute an (m, k) x (k, n) matrix multiplication over
+    ``procs`` processors.
+
+    Returns the color shape ``(pm, pn)`` of the result tiles and the
+    replication depth ``c``. Each of the ``pm * pn * c`` tasks computes one
+    result tile over a ``1 / c`` slice of the contracted dimension, and the
+    ``c`` partial tiles are then summed (the "2.5D" algorithm; ``c == 1`` is
+    the plain SUMMA-style launch).
+
+    The cost of a candidate is the number of elements each task receives:
+    its A and B panels, plus its partial tile when the result is replicated.
+    Replication is only considered while a partial tile, with elements of
+    ``itemsize`` bytes, fits in ``replica_budget`` bytes.
+    """
+
+    def ceil_div(lhs: int, rhs: int) -> int:
+        return (lhs + rhs - 1) // rhs
+
+    best: tuple[tuple[int, int, int], tuple[int, int], int] | None = None
+    for c in _divisors(procs):
+        if c > 1 and c > k:
+            break
+        for pm in _divisors(procs // c):
+            pn = procs // c // pm
+            tile_m = ceil_div(m, pm)
+            tile_n = ceil_div(n, pn)
+            if c > 1 and tile_m * tile_n * itemsize > replica_budget:
+                continue
+            slice_k = ceil_div(k, c)
+            cost = tile_m * slice_k + slice_k * tile_n
+            if c > 1:
+                cost += tile_m * tile_n
+            # On ties, prefer less replication, then taller tiles
+            key = (cost, c, -pm)
+            if best is None or key < best[0]:
+                best = (key, (pm, pn), c)
+
+    assert best is not None
+    return best[1], best[2]
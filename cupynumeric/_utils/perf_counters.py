@@ -0,0 +1,182 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+import json
+from contextlib import contextmanager
+from dataclasses import asdict, dataclass
+from typing import Any, Iterator
+
+from legate.core import get_legate_runtime
+
+from ..config import CuPyNumericOpCode
+
+__all__ = ("PerfRecord", "PerfReport", "perf_counters")
+
+# Variant -1 counts the launches made through the C++ API
+_VARIANT_NAMES = {-1: "submit", 0: "cpu", 1: "omp", 2: "gpu"}
+
+_FIELDS = (
+    "launches",
+    "elements",
+    "bytes_read",
+    "bytes_written",
+    "dense_launches",
+    "strided_launches",
+    "nanoseconds",
+)
+
+
+@dataclass(frozen=True)
+class PerfRecord:
+    """Performance counters of one task variant."""
+
+    op: str
+    variant: str
+    launches: int
+    elements: int
+    bytes_read: int
+    bytes_written: int
+    dense_launches: int
+    strided_launches: int
+    nanoseconds: int
+
+    @property
+    def seconds(self) -> float:
+        return self.nanoseconds * 1e-9
+
+    @property
+    def gbps(self) -> float:
+        """Bytes read and written per nanosecond, i.e. GB/s."""
+        if self.nanoseconds == 0:
+            return 0.0
+        return (self.bytes_read + self.bytes_written) / self.nanoseconds
+
+
+def _op_name(op_code: int) -> str:
+    try:
+        return CuPyNumericOpCode(op_code).name
+    except ValueError:
+        return str(op_code)
+
+
+def _read_counters() -> dict[tuple[int, int], tuple[int, ...]]:
+    from ..runtime import runtime
+
+    lib = runtime.cupynumeric_lib
+    # The counters are updated by the task bodies, so wait for them
+    get_legate_runtime().issue_execution_fence(block=True)
+    counters = {}
+    for i in range(lib.cupynumeric_perf_counters_snapshot()):
+        record = lib.cupynumeric_perf_counters_get(i)
+        counters[(record.op_code, record.variant)] = tuple(
+            int(getattr(record, field)) for field in _FIELDS
+        )
+    return counters
+
+
+class PerfReport:
+    """Performance counters of the tasks executed in a ``perf_counters``
+    block, sorted by decreasing time."""
+
+    def __init__(self) -> None:
+        self.records: list[PerfRecord] = []
+
+    def _set(
+        self,
+        before: dict[tuple[int, int], tuple[int, ...]],
+        after: dict[tuple[int, int], tuple[int, ...]],
+    ) -> None:
+        records = []
+        for (op_code, variant), values in after.items():
+            prior = before.get((op_code, variant), (0,) * len(_FIELDS))
+            delta = tuple(a - b for a, b in zip(values, prior))
+            if not any(delta):
+                continue
+            records.append(
+                PerfRecord(
+                    _op_name(op_code),
+                    _VARIANT_NAMES.get(variant, str(variant)),
+                    *delta,
+                )
+            )
+        records.sort(key=lambda r: (-r.nanoseconds, r.op, r.variant))
+        self.records = records
+
+    def _rows(self) -> list[dict[str, Any]]:
+        return [
+            dict(asdict(record), gbps=record.gbps) for record in self.records
+        ]
+
+    def to_csv(self, path: str) -> None:
+        columns = ("op", "variant") + _FIELDS + ("gbps",)
+        with open(path, "w") as f:
+            print(",".join(columns), file=f)
+            for row in self._rows():
+                print(",".join(str(row[c]) for c in columns), file=f)
+
+    def to_json(self, path: str) -> None:
+        with open(path, "w") as f:
+            json.dump(self._rows(), f, indent=2)
+
+    def dump(self, path: str) -> None:
+        if path.endswith(".json"):
+            self.to_json(path)
+        else:
+            self.to_csv(path)
+
+    def __str__(self) -> str:
+        lines = [
+            f"{'op':<24}{'variant':>8}{'launches':>10}{'dense':>8}"
+            f"{'elements':>14}{'seconds':>12}{'GB/s':>10}"
+        ]
+        for r in self.records:
+            lines.append(
+                f"{r.op:<24}{r.variant:>8}{r.launches:>10}"
+                f"{r.dense_launches:>8}{r.elements:>14}"
+                f"{r.seconds:>12.6f}{r.gbps:>10.2f}"
+            )
+        return "\n".join(lines)
+
+
+@contextmanager
+def perf_counters() -> Iterator[PerfReport]:
+    """Collect per-operation performance counters for the enclosed code.
+
+    The report yielded by the context manager is filled in when the block
+    exits. It holds one record per task op code and variant with the number
+    of executions, the elements and bytes they touched, how many took the
+    dense path and their wall time.
+
+    Examples
+    --------
+    >>> with perf_counters() as report:
+    ...     y = np.sin(x) + x
+    >>> print(report)
+    >>> report.to_csv("perf.csv")
+    """
+    from ..runtime import runtime
+
+    lib = runtime.cupynumeric_lib
+    report = PerfReport()
+    before = _read_counters()
+    was_enabled = lib.cupynumeric_perf_counters_enabled()
+    lib.cupynumeric_perf_counters_enable(True)
+    try:
+        yield report
+    finally:
+        after = _read_counters()
+        lib.cupynumeric_perf_counters_enable(was_enabled)
+        report._set(before, after)
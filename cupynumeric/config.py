@@ -33,11 +33,24 @@ class _ReductionOpIds:
     argmin_redop_id: int
 
 
+class _PerfRecord:
+    op_code: int
+    variant: int
+    launches: int
+    elements: int
+    bytes_read: int
+    bytes_written: int
+    dense_launches: int
+    strided_launches: int
+    nanoseconds: int
+
+
 class _CupynumericSharedLib:
     CUPYNUMERIC_ADVANCED_INDEXING: int
     CUPYNUMERIC_ARANGE: int
     CUPYNUMERIC_ARGWHERE: int
     CUPYNUMERIC_BATCHED_CHOLESKY: int
+    CUPYNUMERIC_BATCHED_MATMUL: int
     CUPYNUMERIC_BINARY_OP: int
     CUPYNUMERIC_BINARY_RED: int
     CUPYNUMERIC_BINCOUNT: int
@@ -152,6 +165,8 @@ class _CupynumericSharedLib:
     CUPYNUMERIC_CONVOLVE_AUTO: int
     CUPYNUMERIC_CONVOLVE_DIRECT: int
     CUPYNUMERIC_CONVOLVE_FFT: int
+    CUPYNUMERIC_CSR_HALO: int
+    CUPYNUMERIC_CSR_POS: int
     CUPYNUMERIC_DIAG: int
     CUPYNUMERIC_DOT: int
     CUPYNUMERIC_EYE: int
@@ -164,12 +179,16 @@ class _CupynumericSharedLib:
     CUPYNUMERIC_FFT_R2C: int
     CUPYNUMERIC_FFT_Z2D: int
     CUPYNUMERIC_FFT_Z2Z: int
+    CUPYNUMERIC_FILE_READ: int
+    CUPYNUMERIC_FILE_WRITE: int
     CUPYNUMERIC_FILL: int
     CUPYNUMERIC_FLIP: int
     CUPYNUMERIC_GEMM: int
     CUPYNUMERIC_HISTOGRAM: int
     CUPYNUMERIC_LOAD_CUDALIBS: int
     CUPYNUMERIC_MATMUL: int
+    CUPYNUMERIC_MATMUL_ACTIVATION_NONE: int
+    CUPYNUMERIC_MATMUL_ACTIVATION_RELU: int
     CUPYNUMERIC_MATVECMUL: int
     CUPYNUMERIC_MAX_MAPPERS: int
     CUPYNUMERIC_MAX_REDOPS: int
@@ -178,6 +197,7 @@ class _CupynumericSharedLib:
     CUPYNUMERIC_MP_SOLVE: int
     CUPYNUMERIC_NONZERO: int
     CUPYNUMERIC_PACKBITS: int
+    CUPYNUMERIC_PACKED_COMPARE: int
     CUPYNUMERIC_POTRF: int
     CUPYNUMERIC_PUTMASK: int
     CUPYNUMERIC_QR: int
@@ -205,13 +225,21 @@ class _CupynumericSharedLib:
     CUPYNUMERIC_SCALAR_UNARY_RED: int
     CUPYNUMERIC_SCAN_GLOBAL: int
     CUPYNUMERIC_SCAN_LOCAL: int
+    CUPYNUMERIC_SCAN_LOGICAL_AND: int
+    CUPYNUMERIC_SCAN_LOGICAL_OR: int
+    CUPYNUMERIC_SCAN_LOGICAL_XOR: int
+    CUPYNUMERIC_SCAN_MAX: int
+    CUPYNUMERIC_SCAN_MIN: int
     CUPYNUMERIC_SCAN_PROD: int
     CUPYNUMERIC_SCAN_SUM: int
     CUPYNUMERIC_SEARCHSORTED: int
     CUPYNUMERIC_SELECT: int
     CUPYNUMERIC_SOLVE: int
     CUPYNUMERIC_SORT: int
+    CUPYNUMERIC_SPMM: int
+    CUPYNUMERIC_SPMV: int
     CUPYNUMERIC_SVD: int
+    CUPYNUMERIC_SYEV: int
     CUPYNUMERIC_SYRK: int
     CUPYNUMERIC_TILE: int
     CUPYNUMERIC_TRANSPOSE_COPY_2D: int
@@ -245,6 +273,7 @@ class _CupynumericSharedLib:
     CUPYNUMERIC_UOP_FLOOR: int
     CUPYNUMERIC_UOP_FREXP: int
     CUPYNUMERIC_UOP_GETARG: int
+    CUPYNUMERIC_UOP_GETM2: int
     CUPYNUMERIC_UOP_IMAG: int
     CUPYNUMERIC_UOP_INVERT: int
     CUPYNUMERIC_UOP_ISFINITE: int
@@ -291,10 +320,30 @@ class _CupynumericSharedLib:
     def cupynumeric_max_eager_volume(self) -> int:
         ...
 
+    @abstractmethod
+    def cupynumeric_perf_counters_enabled(self) -> bool:
+        ...
+
+    @abstractmethod
+    def cupynumeric_perf_counters_enable(self, enable: bool) -> None:
+        ...
+
+    @abstractmethod
+    def cupynumeric_perf_counters_snapshot(self) -> int:
+        ...
+
+    @abstractmethod
+    def cupynumeric_perf_counters_get(self, index: int) -> _PerfRecord:
+        ...
+
     @abstractmethod
     def cupynumeric_register_reduction_ops(self, code: int) -> _ReductionOpIds:
         ...
 
+    @abstractmethod
+    def cupynumeric_register_welford_op(self, code: int) -> int:
+        ...
+
 
 def dlopen_no_autoclose(ffi: Any, lib_path: str) -> Any:
     # Use an already-opened library handle, which cffi will convert to a
@@ -370,6 +419,7 @@ class CuPyNumericOpCode(IntEnum):
     ARANGE = _cupynumeric.CUPYNUMERIC_ARANGE
     ARGWHERE = _cupynumeric.CUPYNUMERIC_ARGWHERE
     BATCHED_CHOLESKY = _cupynumeric.CUPYNUMERIC_BATCHED_CHOLESKY
+    BATCHED_MATMUL = _cupynumeric.CUPYNUMERIC_BATCHED_MATMUL
     BINARY_OP = _cupynumeric.CUPYNUMERIC_BINARY_OP
     BINARY_RED = _cupynumeric.CUPYNUMERIC_BINARY_RED
     BINCOUNT = _cupynumeric.CUPYNUMERIC_BINCOUNT
@@ -378,10 +428,14 @@ class CuPyNumericOpCode(IntEnum):
     CONTRACT = _cupynumeric.CUPYNUMERIC_CONTRACT
     CONVERT = _cupynumeric.CUPYNUMERIC_CONVERT
     CONVOLVE = _cupynumeric.CUPYNUMERIC_CONVOLVE
+    CSR_HALO = _cupynumeric.CUPYNUMERIC_CSR_HALO
+    CSR_POS = _cupynumeric.CUPYNUMERIC_CSR_POS
     DIAG = _cupynumeric.CUPYNUMERIC_DIAG
     DOT = _cupynumeric.CUPYNUMERIC_DOT
     EYE = _cupynumeric.CUPYNUMERIC_EYE
     FFT = _cupynumeric.CUPYNUMERIC_FFT
+    FILE_READ = _cupynumeric.CUPYNUMERIC_FILE_READ
+    FILE_WRITE = _cupynumeric.CUPYNUMERIC_FILE_WRITE
     FILL = _cupynumeric.CUPYNUMERIC_FILL
     FLIP = _cupynumeric.CUPYNUMERIC_FLIP
     GEMM = _cupynumeric.CUPYNUMERIC_GEMM
@@ -393,6 +447,7 @@ class CuPyNumericOpCode(IntEnum):
     MP_SOLVE = _cupynumeric.CUPYNUMERIC_MP_SOLVE
     NONZERO = _cupynumeric.CUPYNUMERIC_NONZERO
     PACKBITS = _cupynumeric.CUPYNUMERIC_PACKBITS
+    PACKED_COMPARE = _cupynumeric.CUPYNUMERIC_PACKED_COMPARE
     POTRF = _cupynumeric.CUPYNUMERIC_POTRF
     PUTMASK = _cupynumeric.CUPYNUMERIC_PUTMASK
     QR = _cupynumeric.CUPYNUMERIC_QR
@@ -406,7 +461,10 @@ class CuPyNumericOpCode(IntEnum):
     SELECT = _cupynumeric.CUPYNUMERIC_SELECT
     SOLVE = _cupynumeric.CUPYNUMERIC_SOLVE
     SORT = _cupynumeric.CUPYNUMERIC_SORT
+    SPMM = _cupynumeric.CUPYNUMERIC_SPMM
+    SPMV = _cupynumeric.CUPYNUMERIC_SPMV
     SVD = _cupynumeric.CUPYNUMERIC_SVD
+    SYEV = _cupynumeric.CUPYNUMERIC_SYEV
     SYRK = _cupynumeric.CUPYNUMERIC_SYRK
     TILE = _cupynumeric.CUPYNUMERIC_TILE
     TRANSPOSE_COPY_2D = _cupynumeric.CUPYNUMERIC_TRANSPOSE_COPY_2D
@@ -450,6 +508,7 @@ class UnaryOpCode(IntEnum):
     FLOOR = _cupynumeric.CUPYNUMERIC_UOP_FLOOR
     FREXP = _cupynumeric.CUPYNUMERIC_UOP_FREXP
     GETARG = _cupynumeric.CUPYNUMERIC_UOP_GETARG
+    GETM2 = _cupynumeric.CUPYNUMERIC_UOP_GETM2
     IMAG = _cupynumeric.CUPYNUMERIC_UOP_IMAG
     INVERT = _cupynumeric.CUPYNUMERIC_UOP_INVERT
     ISFINITE = _cupynumeric.CUPYNUMERIC_UOP_ISFINITE
@@ -562,6 +621,11 @@ class RandGenCode(IntEnum):
 # Match these to CuPyNumericScanCode in cupynumeric_c.h
 @unique
 class ScanCode(IntEnum):
+    LOGICAL_AND = _cupynumeric.CUPYNUMERIC_SCAN_LOGICAL_AND
+    LOGICAL_OR = _cupynumeric.CUPYNUMERIC_SCAN_LOGICAL_OR
+    LOGICAL_XOR = _cupynumeric.CUPYNUMERIC_SCAN_LOGICAL_XOR
+    MAX = _cupynumeric.CUPYNUMERIC_SCAN_MAX
+    MIN = _cupynumeric.CUPYNUMERIC_SCAN_MIN
     PROD = _cupynumeric.CUPYNUMERIC_SCAN_PROD
     SUM = _cupynumeric.CUPYNUMERIC_SCAN_SUM
 
@@ -660,6 +724,13 @@ class ConvolveMethod(IntEnum):
     FFT = _cupynumeric.CUPYNUMERIC_CONVOLVE_FFT
 
 
+# Match these to CuPyNumericMatMulActivation in cupynumeric_c.h
+@unique
+class MatMulActivation(IntEnum):
+    NONE = _cupynumeric.CUPYNUMERIC_MATMUL_ACTIVATION_NONE
+    RELU = _cupynumeric.CUPYNUMERIC_MATMUL_ACTIVATION_RELU
+
+
 @unique
 class TransferType(IntEnum):
     DONATE = 0
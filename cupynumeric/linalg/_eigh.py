@@ -0,0 +1,131 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from legate.core import constant, dimension, get_legate_runtime, types as ty
+
+from ..config import CuPyNumericOpCode
+from ..runtime import runtime
+from ._exception import LinAlgError
+
+legate_runtime = get_legate_runtime()
+
+if TYPE_CHECKING:
+    from legate.core import Library, LogicalStore
+
+    from .._thunk.deferred import DeferredArray
+
+
+def eigh_single(
+    library: Library,
+    a: LogicalStore,
+    w: LogicalStore,
+    v: LogicalStore | None,
+    lower: bool,
+) -> None:
+    task = legate_runtime.create_auto_task(library, CuPyNumericOpCode.SYEV)
+    task.throws_exception(LinAlgError)
+    task.add_input(a)
+    task.add_output(w)
+    if v is not None:
+        task.add_output(v)
+    task.add_scalar_arg(lower, ty.bool_)
+
+    task.add_broadcast(a)
+    task.add_broadcast(w)
+    if v is not None:
+        task.add_broadcast(v)
+
+    task.execute()
+
+
+# Spread the leading (batch) dimensions over the available processors,
+# outermost dimension first. The matrices themselves are never split.
+def choose_batch_color_shape(
+    num_procs: int, batch_shape: tuple[int, ...]
+) -> tuple[int, ...]:
+    remaining = num_procs
+    color_shape = []
+    for extent in batch_shape:
+        color = max(1, min(extent, remaining))
+        color_shape.append(color)
+        remaining = max(1, remaining // color)
+    return tuple(color_shape)
+
+
+def eigh_batched(
+    library: Library,
+    a: LogicalStore,
+    w: LogicalStore,
+    v: LogicalStore | None,
+    lower: bool,
+) -> None:
+    batch_shape = tuple(a.shape[:-2])
+    n = a.shape[-1]
+    initial_color_shape = choose_batch_color_shape(
+        runtime.num_procs, batch_shape
+    )
+    tile_shape = tuple(
+        (extent + color - 1) // color
+        for extent, color in zip(batch_shape, initial_color_shape)
+    )
+    color_shape = tuple(
+        (extent + tile - 1) // tile
+        for extent, tile in zip(batch_shape, tile_shape)
+    )
+
+    batch_proj = tuple(dimension(dim) for dim in range(len(batch_shape)))
+    matrix_proj = batch_proj + (constant(0), constant(0))
+    vector_proj = batch_proj + (constant(0),)
+
+    task = legate_runtime.create_manual_task(
+        library, CuPyNumericOpCode.SYEV, color_shape
+    )
+    task.throws_exception(LinAlgError)
+    task.add_input(a.partition_by_tiling(tile_shape + (n, n)), matrix_proj)
+    task.add_output(w.partition_by_tiling(tile_shape + (n,)), vector_proj)
+    if v is not None:
+        task.add_output(
+            v.partition_by_tiling(tile_shape + (n, n)), matrix_proj
+        )
+    task.add_scalar_arg(lower, ty.bool_)
+    task.execute()
+
+
+def eigh_deferred(
+    a: DeferredArray,
+    w: DeferredArray,
+    v: DeferredArray | None,
+    lower: bool,
+) -> None:
+    library = a.library
+    v_store = None if v is None else v.base
+
+    if a.ndim > 2:
+        size = a.base.shape[-1]
+        # Like batched cholesky, each matrix is solved by a single processor,
+        # so warn when the individual matrices get large
+        if size > 32768:
+            runtime.warn(
+                "batched eigh is only valid"
+                " when the square submatrices fit"
+                f" on a single proc, n > {size} may be too large",
+                category=UserWarning,
+            )
+        eigh_batched(library, a.base, w.base, v_store, lower)
+    else:
+        eigh_single(library, a.base, w.base, v_store, lower)
@@ -274,6 +274,101 @@ def svd(a: ndarray, full_matrices: bool = True) -> tuple[ndarray, ...]:
     return _thunk_svd(a, full_matrices)
 
 
+@add_boilerplate("a")
+def eigh(a: ndarray, UPLO: str = "L") -> tuple[ndarray, ...]:
+    """
+    Return the eigenvalues and eigenvectors of a complex Hermitian
+    (conjugate symmetric) or a real symmetric matrix.
+
+    Returns two objects, a 1-D array containing the eigenvalues of `a`, and
+    a 2-D square array or matrix (depending on the input type) of the
+    corresponding eigenvectors (in columns).
+
+    Parameters
+    ----------
+    a : (..., M, M) array_like
+        Hermitian or real symmetric matrices whose eigenvalues and
+        eigenvectors are to be computed.
+    UPLO : {'L', 'U'}, optional
+        Specifies whether the calculation is done with the lower triangular
+        part of `a` ('L', default) or the upper triangular part ('U').
+        Irrespective of this value only the real parts of the diagonal will
+        be considered in the computation to preserve the notion of a
+        Hermitian matrix.
+
+    Returns
+    -------
+    eigenvalues : (..., M) array_like
+        The eigenvalues in ascending order, each repeated according to
+        its multiplicity.
+    eigenvectors : (..., M, M) array_like
+        The column ``eigenvectors[:, i]`` is the normalized eigenvector
+        corresponding to the eigenvalue ``eigenvalues[i]``.
+
+    Raises
+    ------
+    LinAlgError
+        If the eigenvalue computation does not converge.
+
+    Notes
+    -----
+    Stacked matrices are distributed over the leading dimensions; each
+    individual matrix is decomposed by a single processor.
+
+    See Also
+    --------
+    numpy.linalg.eigh
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    _check_eigh_args(a, UPLO)
+    return _thunk_eigh(a, UPLO, compute_vectors=True)
+
+
+@add_boilerplate("a")
+def eigvalsh(a: ndarray, UPLO: str = "L") -> ndarray:
+    """
+    Compute the eigenvalues of a complex Hermitian or real symmetric matrix.
+
+    Main difference from eigh: the eigenvectors are not computed.
+
+    Parameters
+    ----------
+    a : (..., M, M) array_like
+        A complex- or real-valued matrix whose eigenvalues are to be
+        computed.
+    UPLO : {'L', 'U'}, optional
+        Specifies whether the calculation is done with the lower triangular
+        part of `a` ('L', default) or the upper triangular part ('U').
+        Irrespective of this value only the real parts of the diagonal will
+        be considered in the computation to preserve the notion of a
+        Hermitian matrix.
+
+    Returns
+    -------
+    w : (..., M) array_like
+        The eigenvalues in ascending order, each repeated according to
+        its multiplicity.
+
+    Raises
+    ------
+    LinAlgError
+        If the eigenvalue computation does not converge.
+
+    See Also
+    --------
+    numpy.linalg.eigvalsh
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    _check_eigh_args(a, UPLO)
+    return _thunk_eigh(a, UPLO, compute_vectors=False)[0]
+
+
 # This implementation is adapted closely from NumPy
 @add_boilerplate("a")
 def matrix_power(a: ndarray, n: int) -> ndarray:
@@ -700,6 +795,20 @@ def norm(
         raise ValueError("Improper number of dimensions to norm")
 
 
+def _check_eigh_args(a: ndarray, UPLO: str) -> None:
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.shape[-2] != a.shape[-1]:
+        raise LinAlgError("Last 2 dimensions of the array must be square")
+    if UPLO not in ("L", "U"):
+        raise ValueError("UPLO argument must be 'L' or 'U'")
+    if np.dtype("e") == a.dtype:
+        raise TypeError("array type float16 is unsupported in linalg")
+
+
 def _thunk_cholesky(a: ndarray) -> ndarray:
     """Cholesky decomposition.
 
@@ -833,3 +942,41 @@ def _thunk_svd(a: ndarray, full_matrices: bool) -> tuple[ndarray, ...]:
 
     a._thunk.svd(out_u._thunk, out_s._thunk, out_vh._thunk)
     return out_u, out_s, out_vh
+
+
+def _thunk_eigh(
+    a: ndarray, UPLO: str, compute_vectors: bool
+) -> tuple[ndarray, ...]:
+    if a.dtype.kind not in ("f", "c"):
+        a = a.astype("float64")
+
+    real_dtype = a.dtype.type(0).real.dtype
+
+    out_w = ndarray(
+        shape=a.shape[:-1],
+        dtype=real_dtype,
+        inputs=(a,),
+    )
+    if a.size == 0:
+        if not compute_vectors:
+            return (out_w,)
+        return out_w, empty_like(a)
+
+    out_v = (
+        ndarray(
+            shape=a.shape,
+            dtype=a.dtype,
+            inputs=(a,),
+        )
+        if compute_vectors
+        else None
+    )
+
+    a._thunk.eigh(
+        out_w._thunk,
+        None if out_v is None else out_v._thunk,
+        UPLO == "L",
+    )
+    if out_v is None:
+        return (out_w,)
+    return out_w, out_v
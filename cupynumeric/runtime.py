@@ -97,11 +97,15 @@ class Runtime(object):
 
         settings.warn = settings.warn() or legate_settings.test()
 
+        if settings.report_perf_counters():
+            self.cupynumeric_lib.cupynumeric_perf_counters_enable(True)
+
         if self.num_gpus > 0 and settings.preload_cudalibs():
             self._load_cudalibs()
 
         # Maps value types to struct types used in argmin/argmax
         self._cached_argred_types: dict[ty.Type, ty.Type] = dict()
+        self._cached_welford_types: dict[ty.Type, ty.Type] = dict()
 
     @property
     def num_procs(self) -> int:
@@ -145,6 +149,21 @@ class Runtime(object):
         )
         return argred_dtype
 
+    def get_welford_type(self, value_dtype: ty.Type) -> ty.Type:
+        cached = self._cached_welford_types.get(value_dtype)
+        if cached is not None:
+            return cached
+        # (count, mean, sum of squared deviations); matches WelfordVal
+        welford_dtype = ty.struct_type(
+            [ty.int64, value_dtype, value_dtype], True
+        )
+        self._cached_welford_types[value_dtype] = welford_dtype
+        redop_id = self.cupynumeric_lib.cupynumeric_register_welford_op(
+            value_dtype.code
+        )
+        welford_dtype.record_reduction_op(ty.ReductionOpKind.ADD, redop_id)
+        return welford_dtype
+
     def _report_coverage(self) -> None:
         total = len(self.api_calls)
         implemented = sum(int(impl) for (_, _, impl) in self.api_calls)
@@ -165,12 +184,35 @@ class Runtime(object):
                 for func_name, loc, impl in self.api_calls:
                     print(f"{func_name},{loc},{impl}", file=f)
 
+    def _report_perf_counters(self) -> None:
+        from ._utils.perf_counters import PerfReport, _read_counters
+        from .settings import settings
+
+        # The counters are kept per process, and every rank runs this, so
+        # only rank 0 reports its own counters
+        legate_runtime = get_legate_runtime()
+        if legate_runtime.node_id != 0:
+            return
+
+        report = PerfReport()
+        report._set({}, _read_counters())
+        if legate_runtime.node_count > 1:
+            print("cuPyNumeric performance counters (rank 0):")
+        else:
+            print("cuPyNumeric performance counters:")
+        print(report)
+
+        if (dump := settings.report_perf_dump()) is not None:
+            report.dump(dump)
+
     def destroy(self) -> None:
         from .settings import settings
 
         assert not self.destroyed
         if settings.report_coverage():
             self._report_coverage()
+        if settings.report_perf_counters():
+            self._report_perf_counters()
         self.destroyed = True
 
     def bitgenerator_populate_task(
@@ -482,7 +524,7 @@ class Runtime(object):
         store = legate_runtime.create_store(
             dtype, shape=shape, optimize_scalar=True
         )
-        return DeferredArray(store)
+        return DeferredArray(store, fresh=True)
 
     def create_eager_thunk(
         self,
@@ -76,6 +76,29 @@ class CupynumericRuntimeSettings(Settings):
         """,
     )
 
+    report_perf_counters: PrioritizedSetting[bool] = PrioritizedSetting(
+        "report_perf_counters",
+        "CUPYNUMERIC_PERF_COUNTERS",
+        default=False,
+        convert=convert_bool,
+        help="""
+        Count the launches, elements, bytes and time of every cuPyNumeric
+        task, per operation and variant, and print a summary at exit. The
+        counters are kept per process; with multiple ranks only rank 0
+        reports the tasks it executed.
+        """,
+    )
+
+    report_perf_dump: PrioritizedSetting[str | None] = PrioritizedSetting(
+        "report_perf_dump",
+        "CUPYNUMERIC_PERF_DUMP",
+        default=None,
+        help="""
+        Save the performance counter report to a specified file, as JSON if
+        its name ends in ".json" and as CSV otherwise.
+        """,
+    )
+
     numpy_compat: PrioritizedSetting[bool] = PrioritizedSetting(
         "numpy_compat",
         "CUPYNUMERIC_NUMPY_COMPATIBILITY",
@@ -88,6 +111,33 @@ class CupynumericRuntimeSettings(Settings):
         """,
     )
 
+    pairwise_sum: PrioritizedSetting[bool] = PrioritizedSetting(
+        "pairwise_sum",
+        "CUPYNUMERIC_PAIRWISE_SUM",
+        default=True,
+        convert=convert_bool,
+        help="""
+        Use blocked pairwise summation for full floating-point sum, nansum
+        and mean reductions, which keeps the rounding error close to that of
+        NumPy. Disable to accumulate each partition sequentially instead.
+        """,
+    )
+
+    packed_masks: PrioritizedSetting[bool] = PrioritizedSetting(
+        "packed_masks",
+        "CUPYNUMERIC_PACKED_MASKS",
+        default=False,
+        convert=convert_bool,
+        help="""
+        On machines without GPUs, store the boolean results of comparisons
+        with one bit per element, which where, putmask, nonzero, boolean
+        indexing and the where= argument of full reductions read directly.
+        Other operations unpack such masks on first use, which costs an
+        extra pass and a temporary, so this only pays off when most masks
+        go to those consumers.
+        """,
+    )
+
     fast_math: EnvOnlySetting[int] = EnvOnlySetting(
         "fast_math",
         "CUPYNUMERIC_FAST_MATH",
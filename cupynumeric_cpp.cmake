@@ -152,6 +152,7 @@ list(APPEND cupynumeric_SOURCES
   src/cupynumeric/scan/scan_local.cc
   src/cupynumeric/binary/binary_op.cc
   src/cupynumeric/binary/binary_op_util.cc
+  src/cupynumeric/binary/packed_compare.cc
   src/cupynumeric/binary/binary_red.cc
   src/cupynumeric/bits/packbits.cc
   src/cupynumeric/bits/unpackbits.cc
@@ -173,6 +174,7 @@ list(APPEND cupynumeric_SOURCES
   src/cupynumeric/item/read.cc
   src/cupynumeric/item/write.cc
   src/cupynumeric/matrix/batched_cholesky.cc
+  src/cupynumeric/matrix/batched_matmul.cc
   src/cupynumeric/matrix/contract.cc
   src/cupynumeric/matrix/diag.cc
   src/cupynumeric/matrix/gemm.cc
@@ -183,6 +185,7 @@ list(APPEND cupynumeric_SOURCES
   src/cupynumeric/matrix/qr.cc
   src/cupynumeric/matrix/solve.cc
   src/cupynumeric/matrix/svd.cc
+  src/cupynumeric/matrix/syev.cc
   src/cupynumeric/matrix/syrk.cc
   src/cupynumeric/matrix/tile.cc
   src/cupynumeric/matrix/transpose.cc
@@ -198,12 +201,22 @@ list(APPEND cupynumeric_SOURCES
   src/cupynumeric/search/nonzero.cc
   src/cupynumeric/set/unique.cc
   src/cupynumeric/set/unique_reduce.cc
+  src/cupynumeric/sparse/csr_halo.cc
+  src/cupynumeric/sparse/csr_pos.cc
+  src/cupynumeric/sparse/spmm.cc
+  src/cupynumeric/sparse/spmv.cc
   src/cupynumeric/stat/bincount.cc
   src/cupynumeric/convolution/convolve.cc
   src/cupynumeric/transform/flip.cc
+  src/cupynumeric/io/file_read.cc
+  src/cupynumeric/io/file_write.cc
   src/cupynumeric/utilities/repartition.cc
+  src/cupynumeric/utilities/perf_counters.cc
+  src/cupynumeric/utilities/scratch_arena.cc
   src/cupynumeric/arg_redop_register.cc
   src/cupynumeric/mapper.cc
+  src/cupynumeric/csr_matrix.cc
+  src/cupynumeric/eager.cc
   src/cupynumeric/ndarray.cc
   src/cupynumeric/operators.cc
   src/cupynumeric/runtime.cc
@@ -219,6 +232,7 @@ if(Legion_USE_OpenMP)
     src/cupynumeric/scan/scan_local_omp.cc
     src/cupynumeric/binary/binary_op_omp.cc
     src/cupynumeric/binary/binary_red_omp.cc
+    src/cupynumeric/binary/packed_compare_omp.cc
     src/cupynumeric/bits/packbits_omp.cc
     src/cupynumeric/bits/unpackbits_omp.cc
     src/cupynumeric/unary/unary_op_omp.cc
@@ -237,6 +251,7 @@ if(Legion_USE_OpenMP)
     src/cupynumeric/index/wrap_omp.cc
     src/cupynumeric/index/zip_omp.cc
     src/cupynumeric/matrix/batched_cholesky_omp.cc
+    src/cupynumeric/matrix/batched_matmul_omp.cc
     src/cupynumeric/matrix/contract_omp.cc
     src/cupynumeric/matrix/diag_omp.cc
     src/cupynumeric/matrix/gemm_omp.cc
@@ -247,6 +262,7 @@ if(Legion_USE_OpenMP)
     src/cupynumeric/matrix/qr_omp.cc
     src/cupynumeric/matrix/solve_omp.cc
     src/cupynumeric/matrix/svd_omp.cc
+    src/cupynumeric/matrix/syev_omp.cc
     src/cupynumeric/matrix/syrk_omp.cc
     src/cupynumeric/matrix/tile_omp.cc
     src/cupynumeric/matrix/transpose_omp.cc
@@ -257,9 +273,15 @@ if(Legion_USE_OpenMP)
     src/cupynumeric/search/nonzero_omp.cc
     src/cupynumeric/set/unique_omp.cc
     src/cupynumeric/set/unique_reduce_omp.cc
+    src/cupynumeric/sparse/csr_halo_omp.cc
+    src/cupynumeric/sparse/csr_pos_omp.cc
+    src/cupynumeric/sparse/spmm_omp.cc
+    src/cupynumeric/sparse/spmv_omp.cc
     src/cupynumeric/stat/bincount_omp.cc
     src/cupynumeric/convolution/convolve_omp.cc
     src/cupynumeric/transform/flip_omp.cc
+    src/cupynumeric/io/file_read_omp.cc
+    src/cupynumeric/io/file_write_omp.cc
     src/cupynumeric/stat/histogram_omp.cc
   )
 endif()
@@ -291,6 +313,7 @@ if(Legion_USE_CUDA)
     src/cupynumeric/item/read.cu
     src/cupynumeric/item/write.cu
     src/cupynumeric/matrix/batched_cholesky.cu
+    src/cupynumeric/matrix/batched_matmul.cu
     src/cupynumeric/matrix/contract.cu
     src/cupynumeric/matrix/diag.cu
     src/cupynumeric/matrix/gemm.cu
@@ -301,6 +324,7 @@ if(Legion_USE_CUDA)
     src/cupynumeric/matrix/qr.cu
     src/cupynumeric/matrix/solve.cu
     src/cupynumeric/matrix/svd.cu
+    src/cupynumeric/matrix/syev.cu
     src/cupynumeric/matrix/syrk.cu
     src/cupynumeric/matrix/tile.cu
     src/cupynumeric/matrix/transpose.cu
@@ -314,6 +338,7 @@ if(Legion_USE_CUDA)
     src/cupynumeric/convolution/convolve.cu
     src/cupynumeric/fft/fft.cu
     src/cupynumeric/transform/flip.cu
+    src/cupynumeric/utilities/perf_counters.cu
     src/cupynumeric/utilities/repartition.cu
     src/cupynumeric/arg_redop_register.cu
     src/cupynumeric/cudalibs.cu
@@ -501,6 +526,7 @@ install(
 
 install(
   FILES src/cupynumeric/cupynumeric_c.h
+        src/cupynumeric/csr_matrix.h
         src/cupynumeric/ndarray.h
         src/cupynumeric/ndarray.inl
         src/cupynumeric/operators.h
@@ -563,3 +589,7 @@ if(cupynumeric_BUILD_TESTS)
 
   add_subdirectory(tests/cpp)
 endif()
+
+if(cupynumeric_BUILD_BENCHMARKS)
+  add_subdirectory(tests/cpp/bench)
+endif()
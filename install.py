@@ -173,6 +173,7 @@ def install_cupynumeric(
     arch,
     build_isolation,
     with_tests,
+    with_benchmarks,
     check_bounds,
     clean_first,
     cmake_exe,
@@ -218,6 +219,7 @@ def install_cupynumeric(
         print("arch: ", arch)
         print("build_isolation: ", build_isolation)
         print("with_tests: ", with_tests)
+        print("with_benchmarks: ", with_benchmarks)
         print("check_bounds: ", check_bounds)
         print("clean_first: ", clean_first)
         print("cmake_exe: ", cmake_exe)
@@ -392,6 +394,7 @@ def install_cupynumeric(
 -DLegion_NETWORKS={";".join(networks)}
 -DLegion_USE_HDF5={("ON" if hdf else "OFF")}
 -Dcupynumeric_BUILD_TESTS={("ON" if with_tests else "OFF")}
+-Dcupynumeric_BUILD_BENCHMARKS={("ON" if with_benchmarks else "OFF")}
 """.splitlines()
 
     if march:
@@ -465,6 +468,14 @@ def driver():
         default=False,
         help="Build cuPyNumeric tests.",
     )
+    parser.add_argument(
+        "--with-benchmarks",
+        dest="with_benchmarks",
+        action="store_true",
+        required=False,
+        default=False,
+        help="Build the cuPyNumeric C++ kernel benchmarks.",
+    )
     parser.add_argument(
         "--check-bounds",
         dest="check_bounds",
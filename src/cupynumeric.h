@@ -14,6 +14,7 @@
  *
  */
 
+#include "cupynumeric/csr_matrix.h"
 #include "cupynumeric/ndarray.h"
 #include "cupynumeric/operators.h"
 #include "cupynumeric/slice.h"
@@ -47,9 +47,18 @@ DEFINE_IDENTITIES(uint16_t)
 DEFINE_IDENTITIES(uint32_t)
 DEFINE_IDENTITIES(uint64_t)
 
+#define DEFINE_WELFORD_IDENTITY(TYPE)                       \
+  template <>                                               \
+  const WelfordVal<TYPE> WelfordReduction<TYPE>::identity = \
+    WelfordVal<TYPE>(0, TYPE{0}, TYPE{0});
+
+DEFINE_WELFORD_IDENTITY(float)
+DEFINE_WELFORD_IDENTITY(double)
+
 #undef DEFINE_ARGMAX_IDENTITY
 #undef DEFINE_ARGMIN_IDENTITY
 #undef DEFINE_IDENTITIES
+#undef DEFINE_WELFORD_IDENTITY
 
 /*static*/ legate::LocalRedopID
 register_reduction_op_fn::register_reduction_op_fn::next_reduction_operator_id()
@@ -68,5 +77,11 @@ ReductionOpIds cupynumeric_register_reduction_ops(int code)
   return legate::type_dispatch(static_cast<legate::Type::Code>(code),
                                cupynumeric::register_reduction_op_fn{});
 }
+
+int cupynumeric_register_welford_op(int code)
+{
+  return legate::type_dispatch(static_cast<legate::Type::Code>(code),
+                               cupynumeric::register_welford_op_fn{});
+}
 }
 #endif
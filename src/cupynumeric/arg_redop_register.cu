@@ -23,4 +23,10 @@ ReductionOpIds cupynumeric_register_reduction_ops(int code)
   return legate::type_dispatch(static_cast<legate::Type::Code>(code),
                                cupynumeric::register_reduction_op_fn{});
 }
+
+int cupynumeric_register_welford_op(int code)
+{
+  return legate::type_dispatch(static_cast<legate::Type::Code>(code),
+                               cupynumeric::register_welford_op_fn{});
+}
 }
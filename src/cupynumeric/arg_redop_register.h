@@ -19,6 +19,7 @@
 #include "legate.h"
 #include "cupynumeric/cupynumeric_c.h"
 #include "cupynumeric/arg.h"
+#include "cupynumeric/welford.h"
 
 namespace cupynumeric {
 
@@ -47,4 +48,27 @@ struct register_reduction_op_fn {
   static legate::LocalRedopID next_reduction_operator_id();
 };
 
+struct register_welford_op_fn {
+  template <legate::Type::Code CODE,
+            std::enable_if_t<CODE == legate::Type::Code::FLOAT32 ||
+                             CODE == legate::Type::Code::FLOAT64>* = nullptr>
+  int operator()()
+  {
+    using VAL    = legate::type_of<CODE>;
+    auto runtime = legate::Runtime::get_runtime();
+    auto context = runtime->find_library("cupynumeric");
+    return static_cast<int>(context.register_reduction_operator<WelfordReduction<VAL>>(
+      register_reduction_op_fn::next_reduction_operator_id()));
+  }
+
+  template <legate::Type::Code CODE,
+            std::enable_if_t<CODE != legate::Type::Code::FLOAT32 &&
+                             CODE != legate::Type::Code::FLOAT64>* = nullptr>
+  int operator()()
+  {
+    LEGATE_ABORT("Should never get here");
+    return -1;
+  }
+};
+
 }  // namespace cupynumeric
@@ -20,6 +20,7 @@
 #include "cupynumeric/binary/binary_op.h"
 #include "cupynumeric/binary/binary_op_util.h"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -59,6 +60,7 @@ struct BinaryOpImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     OP func{args.args};
     BinaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in1, in2, pitches, rect, dense);
@@ -84,6 +86,7 @@ struct BinaryOpDispatch {
 template <VariantKind KIND>
 static void binary_op_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_BINARY_OP, KIND};
   auto scalars = context.scalars();
   auto op_code = scalars.front().value<BinaryOpCode>();
 
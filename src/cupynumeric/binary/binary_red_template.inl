@@ -20,6 +20,7 @@
 #include "cupynumeric/binary/binary_red.h"
 #include "cupynumeric/binary/binary_op_util.h"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -63,6 +64,7 @@ struct BinaryRedImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     OP func(args.args);
     BinaryRedImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in1, in2, pitches, rect, dense);
@@ -88,6 +90,7 @@ struct BinaryRedDispatch {
 template <VariantKind KIND>
 static void binary_red_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_BINARY_RED, KIND};
   auto scalars = context.scalars();
   auto op_code = scalars.front().value<BinaryOpCode>();
 
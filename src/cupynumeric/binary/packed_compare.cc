@@ -0,0 +1,59 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/binary/packed_compare.h"
+#include "cupynumeric/binary/packed_compare_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <BinaryOpCode OP_CODE, Type::Code CODE, int DIM>
+struct PackedCompareImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
+  using OP  = BinaryOp<OP_CODE, CODE>;
+  using ARG = type_of<CODE>;
+
+  void operator()(OP func,
+                  AccessorWO<uint8_t, DIM> out,
+                  AccessorRO<ARG, DIM> in1,
+                  AccessorRO<ARG, DIM> in2,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  int64_t in_hi,
+                  size_t volume,
+                  bool dense) const
+  {
+    for (size_t idx = 0; idx < volume; ++idx) {
+      auto p = pitches.unflatten(idx, rect.lo);
+      out[p] = pack_compare(func, in1, in2, p, in_hi, dense);
+    }
+  }
+};
+
+/*static*/ void PackedCompareTask::cpu_variant(TaskContext context)
+{
+  packed_compare_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  PackedCompareTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cupynumeric
@@ -0,0 +1,147 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/binary/packed_compare.h"
+#include "cupynumeric/binary/binary_op_util.h"
+#include "cupynumeric/pitches.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <typename Functor, typename... Fnargs>
+constexpr decltype(auto) compare_op_dispatch(BinaryOpCode op_code, Functor f, Fnargs&&... args)
+{
+  switch (op_code) {
+    case BinaryOpCode::EQUAL:
+      return f.template operator()<BinaryOpCode::EQUAL>(std::forward<Fnargs>(args)...);
+    case BinaryOpCode::GREATER:
+      return f.template operator()<BinaryOpCode::GREATER>(std::forward<Fnargs>(args)...);
+    case BinaryOpCode::GREATER_EQUAL:
+      return f.template operator()<BinaryOpCode::GREATER_EQUAL>(std::forward<Fnargs>(args)...);
+    case BinaryOpCode::LESS:
+      return f.template operator()<BinaryOpCode::LESS>(std::forward<Fnargs>(args)...);
+    case BinaryOpCode::LESS_EQUAL:
+      return f.template operator()<BinaryOpCode::LESS_EQUAL>(std::forward<Fnargs>(args)...);
+    case BinaryOpCode::NOT_EQUAL:
+      return f.template operator()<BinaryOpCode::NOT_EQUAL>(std::forward<Fnargs>(args)...);
+    default: break;
+  }
+  assert(false);
+  return f.template operator()<BinaryOpCode::EQUAL>(std::forward<Fnargs>(args)...);
+}
+
+template <VariantKind KIND, BinaryOpCode OP_CODE, Type::Code CODE, int DIM>
+struct PackedCompareImplBody;
+
+template <VariantKind KIND, BinaryOpCode OP_CODE>
+struct PackedCompareImpl {
+  template <Type::Code CODE, int DIM, std::enable_if_t<BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(PackedCompareArgs& args) const
+  {
+    using OP  = BinaryOp<OP_CODE, CODE>;
+    using ARG = type_of<CODE>;
+
+    // Every byte of the output covers 8 elements of the inputs along the last axis
+    auto out_rect = args.out.shape<DIM>();
+    auto in_rect  = args.in1.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(out_rect);
+
+    if (volume == 0 || in_rect.empty()) {
+      return;
+    }
+
+    auto out = args.out.write_accessor<uint8_t, DIM>(out_rect);
+    auto in1 = args.in1.read_accessor<ARG, DIM>(in_rect);
+    auto in2 = args.in2.read_accessor<ARG, DIM>(in_rect);
+
+#if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
+    // Dense inputs let each byte read its 8 elements through plain pointers
+    bool dense =
+      in1.accessor.is_dense_row_major(in_rect) && in2.accessor.is_dense_row_major(in_rect);
+#else
+    bool dense = false;
+#endif
+
+    OP func{args.args};
+    PackedCompareImplBody<KIND, OP_CODE, CODE, DIM>()(
+      func, out, in1, in2, pitches, out_rect, in_rect.hi[DIM - 1], volume, dense);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(PackedCompareArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+struct PackedCompareDispatch {
+  template <BinaryOpCode OP_CODE>
+  void operator()(PackedCompareArgs& args) const
+  {
+    auto dim = std::max(1, args.out.dim());
+    double_dispatch(dim, args.in1.code(), PackedCompareImpl<KIND, OP_CODE>{}, args);
+  }
+};
+
+// Packs the comparison of the elements [8 * p[DIM - 1], 8 * p[DIM - 1] + 8) of a row, clipped to
+// in_hi, into one byte, with the first element in the lowest bit
+template <typename OP, typename ARG, int DIM>
+inline uint8_t pack_compare(const OP& func,
+                            const AccessorRO<ARG, DIM>& in1,
+                            const AccessorRO<ARG, DIM>& in2,
+                            Point<DIM> p,
+                            int64_t in_hi,
+                            bool dense)
+{
+  const int64_t lo = p[DIM - 1] * 8;
+  const int64_t n  = std::min<int64_t>(8, in_hi + 1 - lo);
+  uint8_t acc      = 0;
+  p[DIM - 1]       = lo;
+  if (dense) {
+    auto in1ptr = in1.ptr(p);
+    auto in2ptr = in2.ptr(p);
+    for (int64_t k = 0; k < n; ++k) {
+      acc |= static_cast<uint8_t>(func(in1ptr[k], in2ptr[k])) << k;
+    }
+  } else {
+    for (int64_t k = 0; k < n; ++k, ++p[DIM - 1]) {
+      acc |= static_cast<uint8_t>(func(in1[p], in2[p])) << k;
+    }
+  }
+  return acc;
+}
+
+template <VariantKind KIND>
+static void packed_compare_template(TaskContext& context)
+{
+  auto scalars = context.scalars();
+  auto op_code = scalars.front().value<BinaryOpCode>();
+
+  scalars.erase(scalars.begin());
+
+  PackedCompareArgs args{
+    context.input(0), context.input(1), context.output(0), op_code, std::move(scalars)};
+  compare_op_dispatch(args.op_code, PackedCompareDispatch<KIND>{}, args);
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,308 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Packing and unpacking kernels of the CPU and OpenMP variants of PACKBITS and UNPACKBITS for
+// dense stores. When the packed axis is the last one, the elements of a byte are contiguous and
+// are handled 32 at a time with AVX2 compares and movemasks, or with pdep when unpacking; these
+// paths are picked at run time on x86 processors that support them. Otherwise the 8 elements of
+// a byte sit in 8 consecutive rows, which are combined a whole row at a time.
+
+#include "cupynumeric/bits/bits_util.h"
+
+#include "legate.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CUPYNUMERIC_BITS_X86 1
+#include <immintrin.h>
+#else
+#define CUPYNUMERIC_BITS_X86 0
+#endif
+
+namespace cupynumeric {
+
+// Number of bytes of a row that OpenMP threads pack or unpack at a time
+constexpr int64_t BITS_CHUNK = 4096;
+
+namespace detail {
+
+constexpr std::array<uint8_t, 256> make_reversed_bytes()
+{
+  std::array<uint8_t, 256> table{};
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    uint32_t reversed = 0;
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      reversed |= ((byte >> bit) & 1) << (7 - bit);
+    }
+    table[byte] = static_cast<uint8_t>(reversed);
+  }
+  return table;
+}
+
+// Byte k of entry b is bit k of b
+constexpr std::array<uint64_t, 256> make_spread_bytes()
+{
+  std::array<uint64_t, 256> table{};
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    uint64_t spread = 0;
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      spread |= static_cast<uint64_t>((byte >> bit) & 1) << (8 * bit);
+    }
+    table[byte] = spread;
+  }
+  return table;
+}
+
+inline constexpr std::array<uint8_t, 256> REVERSED_BYTES = make_reversed_bytes();
+inline constexpr std::array<uint64_t, 256> SPREAD_BYTES  = make_spread_bytes();
+
+// Stores 8 flags held in the bytes of a word, the first element in the lowest byte
+inline void store_flags(uint8_t* out, uint64_t flags)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  flags = __builtin_bswap64(flags);
+#endif
+  std::memcpy(out, &flags, sizeof(flags));
+}
+
+// Packs n <= 8 elements into a byte. The flags of the elements are gathered in the bytes of a
+// word, which a multiplication moves into its top byte in the requested order.
+template <Bitorder BITORDER, typename VAL>
+inline uint8_t pack_byte(const VAL* in, int64_t n)
+{
+  uint64_t flags = 0;
+  for (int64_t k = 0; k < n; ++k) {
+    flags |= static_cast<uint64_t>(in[k] != VAL(0)) << (8 * k);
+  }
+  if constexpr (BITORDER == Bitorder::LITTLE) {
+    return static_cast<uint8_t>((flags * 0x0102040810204080ULL) >> 56);
+  } else {
+    return static_cast<uint8_t>((flags * 0x8040201008040201ULL) >> 56);
+  }
+}
+
+template <Bitorder BITORDER>
+inline uint64_t unpack_byte(uint8_t byte)
+{
+  if constexpr (BITORDER == Bitorder::LITTLE) {
+    return SPREAD_BYTES[byte];
+  } else {
+    return SPREAD_BYTES[REVERSED_BYTES[byte]];
+  }
+}
+
+#if CUPYNUMERIC_BITS_X86
+
+inline bool has_avx2()
+{
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+inline bool has_bmi2()
+{
+  static const bool supported = __builtin_cpu_supports("bmi2");
+  return supported;
+}
+
+// Bit i of the result is set when element i of the 32 is zero
+template <typename VAL>
+__attribute__((target("avx2"))) inline uint32_t zero_mask32(const VAL* in)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  const auto* vecs   = reinterpret_cast<const __m256i*>(in);
+  if constexpr (sizeof(VAL) == 1) {
+    const __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(vecs), zero);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+  } else if constexpr (sizeof(VAL) == 2) {
+    // Saturating packs keep the 0 / -1 lanes, interleaving the 128-bit halves of the inputs
+    const __m256i lo = _mm256_cmpeq_epi16(_mm256_loadu_si256(vecs), zero);
+    const __m256i hi = _mm256_cmpeq_epi16(_mm256_loadu_si256(vecs + 1), zero);
+    const __m256i eq = _mm256_permute4x64_epi64(_mm256_packs_epi16(lo, hi), 0xD8);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+  } else if constexpr (sizeof(VAL) == 4) {
+    uint32_t mask = 0;
+    for (int32_t vec = 0; vec < 4; ++vec) {
+      const __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(vecs + vec), zero);
+      mask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq))) << (8 * vec);
+    }
+    return mask;
+  } else {
+    static_assert(sizeof(VAL) == 8);
+    uint32_t mask = 0;
+    for (int32_t vec = 0; vec < 8; ++vec) {
+      const __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256(vecs + vec), zero);
+      mask |= static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(eq))) << (4 * vec);
+    }
+    return mask;
+  }
+}
+
+// Packs the first nbytes / 4 * 4 bytes and returns their number
+template <Bitorder BITORDER, typename VAL>
+__attribute__((target("avx2"))) size_t pack_avx2(const VAL* in, uint8_t* out, size_t nbytes)
+{
+  size_t idx = 0;
+  for (; idx + 4 <= nbytes; idx += 4) {
+    uint32_t bits = ~zero_mask32(in + 8 * idx);
+    if constexpr (BITORDER == Bitorder::BIG) {
+      for (int32_t byte = 0; byte < 4; ++byte) {
+        out[idx + byte] = REVERSED_BYTES[(bits >> (8 * byte)) & 0xFF];
+      }
+    } else {
+      std::memcpy(out + idx, &bits, sizeof(bits));
+    }
+  }
+  return idx;
+}
+
+template <Bitorder BITORDER>
+__attribute__((target("bmi2"))) void unpack_bmi2(const uint8_t* in, uint8_t* out, size_t nbytes)
+{
+  for (size_t idx = 0; idx < nbytes; ++idx) {
+    uint64_t flags = _pdep_u64(in[idx], 0x0101010101010101ULL);
+    if constexpr (BITORDER == Bitorder::BIG) {
+      flags = __builtin_bswap64(flags);
+    }
+    std::memcpy(out + 8 * idx, &flags, sizeof(flags));
+  }
+}
+
+#endif
+
+}  // namespace detail
+
+// Packs the 8 * nbytes contiguous elements starting at in
+template <Bitorder BITORDER, typename VAL>
+void pack_contiguous(const VAL* in, uint8_t* out, size_t nbytes)
+{
+  size_t idx = 0;
+#if CUPYNUMERIC_BITS_X86
+  if constexpr (sizeof(VAL) <= 8) {
+    if (detail::has_avx2()) {
+      idx = detail::pack_avx2<BITORDER>(in, out, nbytes);
+    }
+  }
+#endif
+  for (; idx < nbytes; ++idx) {
+    out[idx] = detail::pack_byte<BITORDER>(in + 8 * idx, 8);
+  }
+}
+
+// Unpacks nbytes bytes into 8 * nbytes contiguous elements
+template <Bitorder BITORDER>
+void unpack_contiguous(const uint8_t* in, uint8_t* out, size_t nbytes)
+{
+#if CUPYNUMERIC_BITS_X86
+  if (detail::has_bmi2()) {
+    detail::unpack_bmi2<BITORDER>(in, out, nbytes);
+    return;
+  }
+#endif
+  for (size_t idx = 0; idx < nbytes; ++idx) {
+    detail::store_flags(out + 8 * idx, detail::unpack_byte<BITORDER>(in[idx]));
+  }
+}
+
+// Packs nplanes <= 8 rows of width elements, row k holding element k of every byte
+template <Bitorder BITORDER, typename VAL>
+void pack_planes(const VAL* const* planes, int32_t nplanes, uint8_t* out, size_t width)
+{
+  for (size_t idx = 0; idx < width; ++idx) {
+    out[idx] = 0;
+  }
+  for (int32_t k = 0; k < nplanes; ++k) {
+    const int32_t shift = BITORDER == Bitorder::LITTLE ? k : 7 - k;
+    const VAL* plane    = planes[k];
+    for (size_t idx = 0; idx < width; ++idx) {
+      out[idx] |= static_cast<uint8_t>(static_cast<uint8_t>(plane[idx] != VAL(0)) << shift);
+    }
+  }
+}
+
+// Unpacks width bytes into 8 rows, row k receiving element k of every byte
+template <Bitorder BITORDER>
+void unpack_planes(const uint8_t* in, uint8_t* const* planes, size_t width)
+{
+  for (int32_t k = 0; k < 8; ++k) {
+    const int32_t shift = BITORDER == Bitorder::LITTLE ? k : 7 - k;
+    uint8_t* plane      = planes[k];
+    for (size_t idx = 0; idx < width; ++idx) {
+      plane[idx] = (in[idx] >> shift) & 1;
+    }
+  }
+}
+
+// Packs n output elements along the last axis, starting at p, of dense stores
+template <Bitorder BITORDER, typename VAL, int32_t DIM>
+void pack_line(const legate::AccessorWO<uint8_t, DIM>& out,
+               const legate::AccessorRO<VAL, DIM>& in,
+               legate::Point<DIM> p,
+               int64_t n,
+               int64_t in_hi_axis,
+               uint32_t axis)
+{
+  auto q = p;
+  if (axis == DIM - 1) {
+    q[axis] *= 8;
+    const int64_t in_count = std::min<int64_t>(8 * n, in_hi_axis - q[axis] + 1);
+    const int64_t full     = in_count / 8;
+    auto outptr            = out.ptr(p);
+    auto inptr             = in.ptr(q);
+    pack_contiguous<BITORDER>(inptr, outptr, full);
+    if (full < n) {
+      outptr[full] = detail::pack_byte<BITORDER>(inptr + 8 * full, in_count - 8 * full);
+    }
+  } else {
+    const VAL* planes[8];
+    int32_t nplanes = 0;
+    for (; nplanes < 8 && p[axis] * 8 + nplanes <= in_hi_axis; ++nplanes) {
+      q[axis]         = p[axis] * 8 + nplanes;
+      planes[nplanes] = in.ptr(q);
+    }
+    pack_planes<BITORDER>(planes, nplanes, out.ptr(p), n);
+  }
+}
+
+// Unpacks n input elements along the last axis, starting at p, of dense stores
+template <Bitorder BITORDER, int32_t DIM>
+void unpack_line(const legate::AccessorWO<uint8_t, DIM>& out,
+                 const legate::AccessorRO<uint8_t, DIM>& in,
+                 legate::Point<DIM> p,
+                 int64_t n,
+                 uint32_t axis)
+{
+  auto q = p;
+  if (axis == DIM - 1) {
+    q[axis] *= 8;
+    unpack_contiguous<BITORDER>(in.ptr(p), out.ptr(q), n);
+  } else {
+    uint8_t* planes[8];
+    for (int32_t k = 0; k < 8; ++k) {
+      q[axis]   = p[axis] * 8 + k;
+      planes[k] = out.ptr(q);
+    }
+    unpack_planes<BITORDER>(in.ptr(p), planes, n);
+  }
+}
+
+}  // namespace cupynumeric
@@ -16,6 +16,7 @@
 
 #include "cupynumeric/bits/packbits.h"
 #include "cupynumeric/bits/packbits_template.inl"
+#include "cupynumeric/bits/bits_simd.h"
 
 namespace cupynumeric {
 
@@ -50,6 +51,26 @@ struct PackbitsImplBody<VariantKind::CPU, CODE, DIM, BITORDER> {
   }
 };
 
+template <Type::Code CODE, int32_t DIM, Bitorder BITORDER>
+struct PackbitsDenseImplBody<VariantKind::CPU, CODE, DIM, BITORDER> {
+  using VAL = type_of<CODE>;
+
+  void operator()(const AccessorWO<uint8_t, DIM>& out,
+                  const AccessorRO<VAL, DIM>& in,
+                  const Rect<DIM>& out_rect,
+                  int64_t in_hi_axis,
+                  uint32_t axis) const
+  {
+    const int64_t width = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
+    Pitches<DIM - 1> pitches{};
+    const size_t lines = pitches.flatten(out_rect) / width;
+    for (size_t line = 0; line < lines; ++line) {
+      auto p = pitches.unflatten(line * width, out_rect.lo);
+      pack_line<BITORDER>(out, in, p, width, in_hi_axis, axis);
+    }
+  }
+};
+
 /*static*/ void PackbitsTask::cpu_variant(TaskContext context)
 {
   packbits_template<VariantKind::CPU>(context);
@@ -16,6 +16,7 @@
 
 #include "cupynumeric/bits/packbits.h"
 #include "cupynumeric/bits/packbits_template.inl"
+#include "cupynumeric/bits/bits_simd.h"
 
 namespace cupynumeric {
 
@@ -52,6 +53,31 @@ struct PackbitsImplBody<VariantKind::OMP, CODE, DIM, BITORDER> {
   }
 };
 
+template <Type::Code CODE, int32_t DIM, Bitorder BITORDER>
+struct PackbitsDenseImplBody<VariantKind::OMP, CODE, DIM, BITORDER> {
+  using VAL = type_of<CODE>;
+
+  void operator()(const AccessorWO<uint8_t, DIM>& out,
+                  const AccessorRO<VAL, DIM>& in,
+                  const Rect<DIM>& out_rect,
+                  int64_t in_hi_axis,
+                  uint32_t axis) const
+  {
+    const int64_t width  = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
+    const int64_t chunks = (width + BITS_CHUNK - 1) / BITS_CHUNK;
+    Pitches<DIM - 1> pitches{};
+    const int64_t lines = static_cast<int64_t>(pitches.flatten(out_rect)) / width;
+#pragma omp parallel for schedule(static)
+    for (int64_t idx = 0; idx < lines * chunks; ++idx) {
+      const int64_t offset = (idx % chunks) * BITS_CHUNK;
+      auto p               = pitches.unflatten((idx / chunks) * width, out_rect.lo);
+      p[DIM - 1] += offset;
+      pack_line<BITORDER>(
+        out, in, p, std::min<int64_t>(BITS_CHUNK, width - offset), in_hi_axis, axis);
+    }
+  }
+};
+
 /*static*/ void PackbitsTask::omp_variant(TaskContext context)
 {
   packbits_template<VariantKind::OMP>(context);
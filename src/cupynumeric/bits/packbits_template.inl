@@ -27,6 +27,10 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE, int32_t DIM, Bitorder BITORDER>
 struct PackbitsImplBody;
 
+// Packs dense row-major stores with the vector kernels of bits_simd.h
+template <VariantKind KIND, Type::Code CODE, int32_t DIM, Bitorder BITORDER>
+struct PackbitsDenseImplBody;
+
 template <VariantKind KIND, Bitorder BITORDER>
 struct PackbitsImpl {
   template <Type::Code CODE, int32_t DIM, std::enable_if_t<is_integral<CODE>::value>* = nullptr>
@@ -45,6 +49,16 @@ struct PackbitsImpl {
     auto out = output.write_accessor<uint8_t, DIM>(out_rect);
     auto in  = input.read_accessor<VAL, DIM>(in_rect);
 
+    if constexpr (KIND != VariantKind::GPU) {
+#if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
+      if (out.accessor.is_dense_row_major(out_rect) && in.accessor.is_dense_row_major(in_rect)) {
+        PackbitsDenseImplBody<KIND, CODE, DIM, BITORDER>{}(
+          out, in, out_rect, in_rect.hi[axis], axis);
+        return;
+      }
+#endif
+    }
+
     // Compute an output rectangle where each output element can use all 8 input elements
     // for packing
     auto aligned_rect     = out_rect;
@@ -0,0 +1,103 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "legate.h"
+
+namespace cupynumeric {
+
+// Boolean masks produced by comparisons on CPUs can be stored bit-packed: a uint8 store with the
+// shape of the mask, except for the last axis that is ceil(n / 8) long. Element j of a row is bit
+// (j % 8) of byte (j / 8), i.e. the little bit order of packbits, and the padding bits of the last
+// byte are zero. Tasks receive such a mask in place of a bool store, partitioned with a scale
+// constraint of 8 on the last axis, and tell the two apart by the type code of the store.
+inline bool is_packed_mask(const legate::PhysicalStore& mask)
+{
+  return mask.code() == legate::Type::Code::UINT8;
+}
+
+// Length of the row segments that OpenMP threads process at a time, a multiple of 8 so that
+// segments that start on a byte boundary never share a byte
+constexpr int64_t PACKED_MASK_CHUNK = 4096;
+
+template <int DIM>
+class PackedMaskRO {
+ public:
+  PackedMaskRO() = default;
+  explicit PackedMaskRO(const legate::PhysicalStore& mask)
+    : bytes_{mask.read_accessor<uint8_t, DIM>(mask.shape<DIM>())}
+  {
+  }
+
+  __CUDA_HD__ inline bool operator[](legate::Point<DIM> p) const
+  {
+    const auto col = p[DIM - 1];
+    p[DIM - 1]     = col >> 3;
+    return (bytes_[p] >> (col & 7)) & 1;
+  }
+
+  // Number of set elements among the `n` ones that start at `p` along the last axis
+  inline size_t count(const legate::Point<DIM>& p, int64_t n) const
+  {
+    size_t total = 0;
+    scan(p, n, [&](int64_t, uint32_t bits) {
+      total += static_cast<size_t>(__builtin_popcount(bits));
+    });
+    return total;
+  }
+
+  // Calls f(k) for every set element p + k among the `n` ones that start at `p` along the
+  // last axis, in increasing order of k
+  template <typename F>
+  inline void for_each_set(const legate::Point<DIM>& p, int64_t n, F&& f) const
+  {
+    scan(p, n, [&](int64_t base, uint32_t bits) {
+      while (bits != 0) {
+        f(base + __builtin_ctz(bits));
+        bits &= bits - 1;
+      }
+    });
+  }
+
+ private:
+  // Calls f(base, bits) for every byte covering [p, p + n) along the last axis, where
+  // bits has the elements outside the range cleared and bit i stands for element p + base + i
+  template <typename F>
+  inline void scan(legate::Point<DIM> p, int64_t n, F&& f) const
+  {
+    const int64_t lo = p[DIM - 1];
+    const int64_t hi = lo + n;
+    for (int64_t byte = lo >> 3; byte * 8 < hi; ++byte) {
+      p[DIM - 1]         = byte;
+      const int64_t base = byte * 8;
+      uint32_t bits      = bytes_[p];
+      if (base < lo) {
+        bits &= 0xFFu << (lo - base);
+      }
+      if (base + 8 > hi) {
+        bits &= 0xFFu >> (base + 8 - hi);
+      }
+      if (bits != 0) {
+        f(base - lo, bits);
+      }
+    }
+  }
+
+  legate::AccessorRO<uint8_t, DIM> bytes_{};
+};
+
+}  // namespace cupynumeric
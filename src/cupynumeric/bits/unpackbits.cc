@@ -16,6 +16,7 @@
 
 #include "cupynumeric/bits/unpackbits.h"
 #include "cupynumeric/bits/unpackbits_template.inl"
+#include "cupynumeric/bits/bits_simd.h"
 
 namespace cupynumeric {
 
@@ -38,6 +39,23 @@ struct UnpackbitsImplBody<VariantKind::CPU, DIM, BITORDER> {
   }
 };
 
+template <int32_t DIM, Bitorder BITORDER>
+struct UnpackbitsDenseImplBody<VariantKind::CPU, DIM, BITORDER> {
+  void operator()(const AccessorWO<uint8_t, DIM>& out,
+                  const AccessorRO<uint8_t, DIM>& in,
+                  const Rect<DIM>& in_rect,
+                  uint32_t axis) const
+  {
+    const int64_t width = in_rect.hi[DIM - 1] - in_rect.lo[DIM - 1] + 1;
+    Pitches<DIM - 1> pitches{};
+    const size_t lines = pitches.flatten(in_rect) / width;
+    for (size_t line = 0; line < lines; ++line) {
+      auto p = pitches.unflatten(line * width, in_rect.lo);
+      unpack_line<BITORDER>(out, in, p, width, axis);
+    }
+  }
+};
+
 /*static*/ void UnpackbitsTask::cpu_variant(TaskContext context)
 {
   unpackbits_template<VariantKind::CPU>(context);
@@ -16,6 +16,7 @@
 
 #include "cupynumeric/bits/unpackbits.h"
 #include "cupynumeric/bits/unpackbits_template.inl"
+#include "cupynumeric/bits/bits_simd.h"
 
 namespace cupynumeric {
 
@@ -39,6 +40,27 @@ struct UnpackbitsImplBody<VariantKind::OMP, DIM, BITORDER> {
   }
 };
 
+template <int32_t DIM, Bitorder BITORDER>
+struct UnpackbitsDenseImplBody<VariantKind::OMP, DIM, BITORDER> {
+  void operator()(const AccessorWO<uint8_t, DIM>& out,
+                  const AccessorRO<uint8_t, DIM>& in,
+                  const Rect<DIM>& in_rect,
+                  uint32_t axis) const
+  {
+    const int64_t width  = in_rect.hi[DIM - 1] - in_rect.lo[DIM - 1] + 1;
+    const int64_t chunks = (width + BITS_CHUNK - 1) / BITS_CHUNK;
+    Pitches<DIM - 1> pitches{};
+    const int64_t lines = static_cast<int64_t>(pitches.flatten(in_rect)) / width;
+#pragma omp parallel for schedule(static)
+    for (int64_t idx = 0; idx < lines * chunks; ++idx) {
+      const int64_t offset = (idx % chunks) * BITS_CHUNK;
+      auto p               = pitches.unflatten((idx / chunks) * width, in_rect.lo);
+      p[DIM - 1] += offset;
+      unpack_line<BITORDER>(out, in, p, std::min<int64_t>(BITS_CHUNK, width - offset), axis);
+    }
+  }
+};
+
 /*static*/ void UnpackbitsTask::omp_variant(TaskContext context)
 {
   unpackbits_template<VariantKind::OMP>(context);
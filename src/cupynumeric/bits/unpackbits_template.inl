@@ -27,6 +27,10 @@ using namespace legate;
 template <VariantKind KIND, int32_t DIM, Bitorder BITORDER>
 struct UnpackbitsImplBody;
 
+// Unpacks dense row-major stores with the vector kernels of bits_simd.h
+template <VariantKind KIND, int32_t DIM, Bitorder BITORDER>
+struct UnpackbitsDenseImplBody;
+
 template <VariantKind KIND, Bitorder BITORDER>
 struct UnpackbitsImpl {
   template <int32_t DIM>
@@ -43,6 +47,15 @@ struct UnpackbitsImpl {
     auto out = output.write_accessor<uint8_t, DIM>(out_rect);
     auto in  = input.read_accessor<uint8_t, DIM>(in_rect);
 
+    if constexpr (KIND != VariantKind::GPU) {
+#if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
+      if (out.accessor.is_dense_row_major(out_rect) && in.accessor.is_dense_row_major(in_rect)) {
+        UnpackbitsDenseImplBody<KIND, DIM, BITORDER>{}(out, in, in_rect, axis);
+        return;
+      }
+#endif
+    }
+
     Pitches<DIM - 1> in_pitches{};
     auto in_volume = in_pitches.flatten(in_rect);
 
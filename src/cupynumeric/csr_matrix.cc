@@ -0,0 +1,220 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/csr_matrix.h"
+
+#include "cupynumeric/operators.h"
+#include "cupynumeric/runtime.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace cupynumeric {
+
+namespace {
+
+bool is_sparse_type(const legate::Type& type)
+{
+  switch (type.code()) {
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128: return true;
+    default: break;
+  }
+  return false;
+}
+
+legate::LogicalStore make_pos(NDArray indptr,
+                              const NDArray& indices,
+                              const NDArray& data,
+                              const std::vector<uint64_t>& shape)
+{
+  if (shape.size() != 2) {
+    throw std::invalid_argument("CSR matrices must be 2-D");
+  }
+  const auto rows = shape[0];
+  if (indptr.dim() != 1 || indptr.size() != rows + 1 || indptr.type() != legate::int64()) {
+    throw std::invalid_argument("indptr must be a 1-D int64 array with " +
+                                std::to_string(rows + 1) + " elements");
+  }
+  if (indices.dim() != 1 || indices.type() != legate::int64()) {
+    throw std::invalid_argument("indices must be a 1-D int64 array");
+  }
+  if (data.dim() != 1 || data.size() != indices.size()) {
+    throw std::invalid_argument("data must be a 1-D array with one element per index");
+  }
+  if (!is_sparse_type(data.type())) {
+    throw std::invalid_argument("CSR matrices only support float and complex values");
+  }
+
+  auto legate_runtime = legate::Runtime::get_runtime();
+  auto pos = legate_runtime->create_store(legate::Shape{rows}, legate::rect_type(1));
+  if (rows == 0) {
+    return pos;
+  }
+
+  // Row i holds the nonzeros [indptr[i], indptr[i + 1]), so the two slices line up with the rows
+  auto offsets = indptr.get_store();
+  auto runtime = CuPyNumericRuntime::get_runtime();
+  auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_CSR_POS);
+  auto p_pos   = task.add_output(pos);
+  auto p_lo    = task.add_input(offsets.slice(0, legate::Slice(0, static_cast<int64_t>(rows))));
+  auto p_hi    = task.add_input(offsets.slice(0, legate::Slice(1, static_cast<int64_t>(rows + 1))));
+  task.add_constraint(legate::align(p_pos, p_lo));
+  task.add_constraint(legate::align(p_pos, p_hi));
+  runtime->submit(std::move(task));
+  return pos;
+}
+
+}  // namespace
+
+CsrMatrix::CsrMatrix(NDArray indptr, NDArray indices, NDArray data, std::vector<uint64_t> shape)
+  : indptr_(std::move(indptr)),
+    indices_(std::move(indices)),
+    data_(std::move(data)),
+    shape_(std::move(shape)),
+    pos_(make_pos(indptr_, indices_, data_, shape_))
+{
+}
+
+const std::vector<uint64_t>& CsrMatrix::shape() const { return shape_; }
+
+uint64_t CsrMatrix::nnz() const { return indices_.size(); }
+
+legate::Type CsrMatrix::type() const { return data_.type(); }
+
+NDArray CsrMatrix::indptr() const { return indptr_; }
+
+NDArray CsrMatrix::indices() const { return indices_; }
+
+NDArray CsrMatrix::data() const { return data_; }
+
+NDArray CsrMatrix::dot(NDArray rhs, std::optional<NDArray> out) const
+{
+  if (rhs.dim() != 1 && rhs.dim() != 2) {
+    throw std::invalid_argument("The right-hand side must be a vector or a matrix");
+  }
+  if (rhs.shape()[0] != shape_[1]) {
+    throw std::invalid_argument("Incompatible shapes: (" + std::to_string(shape_[0]) + ", " +
+                                std::to_string(shape_[1]) + ") x " +
+                                std::to_string(rhs.shape()[0]) + " rows");
+  }
+  if (rhs.type() != type()) {
+    rhs = rhs.as_type(type());
+  }
+
+  auto out_shape = rhs.shape();
+  out_shape[0]   = shape_[0];
+  if (out.has_value()) {
+    if (out->shape() != out_shape || out->type() != type()) {
+      throw std::invalid_argument("The output does not match the shape and type of the product");
+    }
+  } else {
+    auto runtime = CuPyNumericRuntime::get_runtime();
+    out          = runtime->create_array(out_shape, type());
+  }
+
+  if (out->size() == 0) {
+    return out.value();
+  }
+  if (nnz() == 0) {
+    out->assign(zeros(out_shape, type()));
+    return out.value();
+  }
+
+  if (rhs.dim() == 1) {
+    spmv(out.value(), rhs);
+  } else {
+    spmm(out.value(), rhs);
+  }
+  return out.value();
+}
+
+void CsrMatrix::spmv(NDArray& out, NDArray& rhs) const
+{
+  auto runtime = CuPyNumericRuntime::get_runtime();
+  auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_SPMV);
+
+  auto p_y    = task.add_output(out.get_store());
+  auto p_pos  = task.add_input(pos_);
+  auto p_halo = task.add_input(halo(0));
+  auto p_crd  = task.add_input(NDArray(indices_).get_store());
+  auto p_vals = task.add_input(NDArray(data_).get_store());
+  auto p_x    = task.add_input(rhs.get_store());
+
+  // Rows are partitioned like y. The nonzeros of a block of rows are contiguous, so their image
+  // is bounded by the first and last row ranges; the part of x a block reads is gathered through
+  // the bounding box of its column halos.
+  task.add_constraint(legate::align(p_y, p_pos));
+  task.add_constraint(legate::align(p_pos, p_halo));
+  task.add_constraint(legate::image(p_pos, p_crd, legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(p_pos, p_vals, legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(p_halo, p_x, legate::ImageComputationHint::MIN_MAX));
+
+  runtime->submit(std::move(task));
+}
+
+void CsrMatrix::spmm(NDArray& out, NDArray& rhs) const
+{
+  auto runtime     = CuPyNumericRuntime::get_runtime();
+  const auto width = static_cast<int64_t>(rhs.shape()[1]);
+  auto task        = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_SPMM);
+
+  auto p_y    = task.add_output(out.get_store());
+  auto p_pos  = task.add_input(pos_.promote(1, width));
+  auto p_halo = task.add_input(halo(width).promote(1, width));
+  auto p_crd  = task.add_input(NDArray(indices_).get_store());
+  auto p_vals = task.add_input(NDArray(data_).get_store());
+  auto p_x    = task.add_input(rhs.get_store());
+
+  // As for SPMV, with only the rows of Y partitioned
+  task.add_constraint(legate::broadcast(p_y, {1}));
+  task.add_constraint(legate::align(p_y, p_pos));
+  task.add_constraint(legate::align(p_pos, p_halo));
+  task.add_constraint(legate::image(p_pos, p_crd, legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(p_pos, p_vals, legate::ImageComputationHint::FIRST_LAST));
+  task.add_constraint(legate::image(p_halo, p_x, legate::ImageComputationHint::MIN_MAX));
+
+  runtime->submit(std::move(task));
+}
+
+legate::LogicalStore CsrMatrix::halo(int64_t width) const
+{
+  auto finder = halos_.find(width);
+  if (finder != halos_.end()) {
+    return finder->second;
+  }
+
+  auto legate_runtime = legate::Runtime::get_runtime();
+  auto ranges         = legate_runtime->create_store(legate::Shape{shape_[0]},
+                                             legate::rect_type(width == 0 ? 1 : 2));
+
+  auto runtime = CuPyNumericRuntime::get_runtime();
+  auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_CSR_HALO);
+  auto p_halo  = task.add_output(ranges);
+  auto p_pos   = task.add_input(pos_);
+  auto p_crd   = task.add_input(NDArray(indices_).get_store());
+  task.add_scalar_arg(legate::Scalar(width));
+  task.add_constraint(legate::align(p_halo, p_pos));
+  task.add_constraint(legate::image(p_pos, p_crd, legate::ImageComputationHint::FIRST_LAST));
+  runtime->submit(std::move(task));
+
+  halos_.insert({width, ranges});
+  return ranges;
+}
+
+}  // namespace cupynumeric
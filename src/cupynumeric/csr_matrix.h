@@ -0,0 +1,75 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+
+#include "legate.h"
+#include "cupynumeric/ndarray.h"
+
+namespace cupynumeric {
+
+// A sparse matrix in compressed sparse row format. Products with it are computed by row-blocked
+// SPMV and SPMM tasks: every task owns a block of rows of the result and receives only the
+// nonzeros of those rows and the entries of the right-hand side that they reference, so the
+// matrix and its operands stay distributed.
+class CsrMatrix {
+ public:
+  // A shape[0] x shape[1] matrix made of its row pointers (shape[0] + 1 int64 offsets), column
+  // indices (one int64 per nonzero) and values (one per nonzero). The arrays are used without
+  // being copied.
+  CsrMatrix(NDArray indptr, NDArray indices, NDArray data, std::vector<uint64_t> shape);
+
+ public:
+  CsrMatrix(const CsrMatrix&)            = default;
+  CsrMatrix& operator=(const CsrMatrix&) = default;
+
+ public:
+  CsrMatrix(CsrMatrix&&)            = default;
+  CsrMatrix& operator=(CsrMatrix&&) = default;
+
+ public:
+  const std::vector<uint64_t>& shape() const;
+  uint64_t nnz() const;
+  legate::Type type() const;
+  NDArray indptr() const;
+  NDArray indices() const;
+  NDArray data() const;
+
+ public:
+  // The product with a vector (SpMV) or with a matrix (SpMM), written to `out` when given
+  NDArray dot(NDArray rhs, std::optional<NDArray> out = std::nullopt) const;
+
+ private:
+  void spmv(NDArray& out, NDArray& rhs) const;
+  void spmm(NDArray& out, NDArray& rhs) const;
+  // Per row, the rows of a right-hand side with `width` columns (0 for a vector) that the
+  // row's nonzeros read
+  legate::LogicalStore halo(int64_t width) const;
+
+ private:
+  NDArray indptr_;
+  NDArray indices_;
+  NDArray data_;
+  std::vector<uint64_t> shape_;
+  // The range of nonzeros of every row
+  legate::LogicalStore pos_;
+  mutable std::map<int64_t, legate::LogicalStore> halos_{};
+};
+
+}  // namespace cupynumeric
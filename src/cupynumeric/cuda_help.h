@@ -24,6 +24,7 @@
 
 #include "legate/cuda/stream_pool.h"
 #include "cupynumeric/arg.h"
+#include "cupynumeric/welford.h"
 #include <cublas_v2.h>
 #include <cusolverDn.h>
 #if LEGATE_DEFINED(CUPYNUMERIC_USE_CUSOLVERMP)
@@ -354,6 +355,11 @@ struct HasNativeShuffle<Argval<T>> {
   static constexpr bool value = false;
 };
 
+template <typename T>
+struct HasNativeShuffle<WelfordVal<T>> {
+  static constexpr bool value = false;
+};
+
 template <typename T, typename REDUCTION>
 __device__ __forceinline__ void reduce_output(DeviceScalarReductionBuffer<REDUCTION> result,
                                               T value)
@@ -25,6 +25,7 @@ enum CuPyNumericOpCode {
   CUPYNUMERIC_ARANGE,
   CUPYNUMERIC_ARGWHERE,
   CUPYNUMERIC_BATCHED_CHOLESKY,
+  CUPYNUMERIC_BATCHED_MATMUL,
   CUPYNUMERIC_BINARY_OP,
   CUPYNUMERIC_BINARY_RED,
   CUPYNUMERIC_BINCOUNT,
@@ -33,12 +34,16 @@ enum CuPyNumericOpCode {
   CUPYNUMERIC_CONTRACT,
   CUPYNUMERIC_CONVERT,
   CUPYNUMERIC_CONVOLVE,
+  CUPYNUMERIC_CSR_HALO,
+  CUPYNUMERIC_CSR_POS,
   CUPYNUMERIC_SCAN_GLOBAL,
   CUPYNUMERIC_SCAN_LOCAL,
   CUPYNUMERIC_DIAG,
   CUPYNUMERIC_DOT,
   CUPYNUMERIC_EYE,
   CUPYNUMERIC_FFT,
+  CUPYNUMERIC_FILE_READ,
+  CUPYNUMERIC_FILE_WRITE,
   CUPYNUMERIC_FILL,
   CUPYNUMERIC_FLIP,
   CUPYNUMERIC_GEMM,
@@ -50,6 +55,7 @@ enum CuPyNumericOpCode {
   CUPYNUMERIC_MP_SOLVE,
   CUPYNUMERIC_NONZERO,
   CUPYNUMERIC_PACKBITS,
+  CUPYNUMERIC_PACKED_COMPARE,
   CUPYNUMERIC_POTRF,
   CUPYNUMERIC_PUTMASK,
   CUPYNUMERIC_QR,
@@ -61,7 +67,10 @@ enum CuPyNumericOpCode {
   CUPYNUMERIC_SELECT,
   CUPYNUMERIC_SOLVE,
   CUPYNUMERIC_SORT,
+  CUPYNUMERIC_SPMM,
+  CUPYNUMERIC_SPMV,
   CUPYNUMERIC_SVD,
+  CUPYNUMERIC_SYEV,
   CUPYNUMERIC_SYRK,
   CUPYNUMERIC_TILE,
   CUPYNUMERIC_TRANSPOSE_COPY_2D,
@@ -105,6 +114,7 @@ enum CuPyNumericUnaryOpCode {
   CUPYNUMERIC_UOP_FLOOR,
   CUPYNUMERIC_UOP_FREXP,
   CUPYNUMERIC_UOP_GETARG,
+  CUPYNUMERIC_UOP_GETM2,
   CUPYNUMERIC_UOP_IMAG,
   CUPYNUMERIC_UOP_INVERT,
   CUPYNUMERIC_UOP_ISFINITE,
@@ -221,7 +231,12 @@ enum CuPyNumericBounds {
 // Match these to ScanCode in config.py
 // Also, sort these alphabetically for easy lookup later
 enum CuPyNumericScanCode {
-  CUPYNUMERIC_SCAN_PROD = 1,
+  CUPYNUMERIC_SCAN_LOGICAL_AND = 1,
+  CUPYNUMERIC_SCAN_LOGICAL_OR,
+  CUPYNUMERIC_SCAN_LOGICAL_XOR,
+  CUPYNUMERIC_SCAN_MAX,
+  CUPYNUMERIC_SCAN_MIN,
+  CUPYNUMERIC_SCAN_PROD,
   CUPYNUMERIC_SCAN_SUM,
 };
 
@@ -330,6 +345,12 @@ enum CuPyNumericFFTDirection { CUPYNUMERIC_FFT_FORWARD = -1, CUPYNUMERIC_FFT_INV
 // Match these to Bitorder in config.py
 enum CuPyNumericBitorder { CUPYNUMERIC_BITORDER_BIG = 0, CUPYNUMERIC_BITORDER_LITTLE = 1 };
 
+// Match these to MatMulActivation in config.py
+enum CuPyNumericMatMulActivation {
+  CUPYNUMERIC_MATMUL_ACTIVATION_NONE = 0,
+  CUPYNUMERIC_MATMUL_ACTIVATION_RELU = 1,
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -339,6 +360,19 @@ typedef struct ReductionOpIds {
   int argmin_redop_id;
 } ReductionOpIds;
 
+// Match these to PerfCounters in utilities/perf_counters.h; a variant of -1 counts submissions
+typedef struct CuPyNumericPerfRecord {
+  int op_code;
+  int variant;
+  unsigned long long launches;
+  unsigned long long elements;
+  unsigned long long bytes_read;
+  unsigned long long bytes_written;
+  unsigned long long dense_launches;
+  unsigned long long strided_launches;
+  unsigned long long nanoseconds;
+} CuPyNumericPerfRecord;
+
 void cupynumeric_perform_registration();
 bool cupynumeric_has_cusolvermp();
 
@@ -346,8 +380,17 @@ unsigned cupynumeric_max_eager_volume();
 
 unsigned cupynumeric_matmul_cache_size();
 
+bool cupynumeric_perf_counters_enabled();
+void cupynumeric_perf_counters_enable(bool enable);
+void cupynumeric_perf_counters_reset();
+// Takes a snapshot of the counters and returns its number of records
+unsigned cupynumeric_perf_counters_snapshot();
+struct CuPyNumericPerfRecord cupynumeric_perf_counters_get(unsigned index);
+
 struct ReductionOpIds cupynumeric_register_reduction_ops(int code);
 
+int cupynumeric_register_welford_op(int code);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,448 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/eager.h"
+
+#include "cupynumeric/binary/binary_op_util.h"
+#include "cupynumeric/ndarray.h"
+#include "cupynumeric/unary/convert_util.h"
+#include "cupynumeric/unary/unary_op_util.h"
+#include "cupynumeric/unary/unary_red_util.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace cupynumeric {
+
+bool is_eager_type(const legate::Type& type)
+{
+  switch (type.code()) {
+    case legate::Type::Code::BOOL:
+    case legate::Type::Code::INT8:
+    case legate::Type::Code::INT16:
+    case legate::Type::Code::INT32:
+    case legate::Type::Code::INT64:
+    case legate::Type::Code::UINT8:
+    case legate::Type::Code::UINT16:
+    case legate::Type::Code::UINT32:
+    case legate::Type::Code::UINT64:
+    case legate::Type::Code::FLOAT16:
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128: return true;
+    default: break;
+  }
+  return false;
+}
+
+namespace {
+
+// An input of an eager operation. Inputs with a single element are broadcast with a zero stride.
+struct EagerOperand {
+  const std::byte* ptr;
+  size_t stride;
+
+  template <typename T>
+  const T& at(size_t idx) const
+  {
+    return reinterpret_cast<const T*>(ptr)[idx * stride];
+  }
+};
+
+const std::vector<legate::Scalar> NO_ARGS{};
+
+template <BinaryOpCode OP_CODE>
+struct eager_binary_op_fn {
+  template <legate::Type::Code CODE, std::enable_if_t<BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  bool operator()(
+    legate::Type::Code out_code, std::byte* out, EagerOperand in1, EagerOperand in2, size_t volume)
+  {
+    using OP   = BinaryOp<OP_CODE, CODE>;
+    using RHS1 = legate::type_of<CODE>;
+    using RHS2 = rhs2_of_binary_op<OP_CODE, CODE>;
+    using LHS  = std::result_of_t<OP(RHS1, RHS2)>;
+
+    // Operations like ldexp take a second operand of another type, which NDArray::binary_op
+    // does not allow
+    if constexpr (!std::is_same_v<RHS1, RHS2>) {
+      return false;
+    } else {
+      if (out_code != legate::type_code_of_v<LHS>) {
+        return false;
+      }
+      OP func{NO_ARGS};
+      auto lhs = reinterpret_cast<LHS*>(out);
+      for (size_t idx = 0; idx < volume; ++idx) {
+        lhs[idx] = func(in1.at<RHS1>(idx), in2.at<RHS2>(idx));
+      }
+      return true;
+    }
+  }
+
+  template <legate::Type::Code CODE, std::enable_if_t<!BinaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  bool operator()(legate::Type::Code, std::byte*, EagerOperand, EagerOperand, size_t)
+  {
+    return false;
+  }
+};
+
+struct eager_binary_op_dispatch {
+  template <BinaryOpCode OP_CODE>
+  bool operator()(legate::Type::Code code,
+                  legate::Type::Code out_code,
+                  std::byte* out,
+                  EagerOperand in1,
+                  EagerOperand in2,
+                  size_t volume)
+  {
+    return legate::type_dispatch(
+      code, eager_binary_op_fn<OP_CODE>{}, out_code, out, in1, in2, volume);
+  }
+};
+
+template <UnaryOpCode OP_CODE>
+struct eager_unary_op_fn {
+  template <legate::Type::Code CODE, std::enable_if_t<UnaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  bool operator()(legate::Type::Code out_code,
+                  std::byte* out,
+                  EagerOperand in,
+                  size_t volume,
+                  const std::vector<legate::Scalar>& args)
+  {
+    using OP  = UnaryOp<OP_CODE, CODE>;
+    using ARG = typename OP::T;
+    using RES = std::result_of_t<OP(ARG)>;
+
+    // getarg and friends read a struct type that only the task receives
+    if constexpr (!std::is_same_v<ARG, legate::type_of<CODE>>) {
+      return false;
+    } else {
+      if (out_code != legate::type_code_of_v<RES>) {
+        return false;
+      }
+      OP func{args};
+      auto res = reinterpret_cast<RES*>(out);
+      for (size_t idx = 0; idx < volume; ++idx) {
+        res[idx] = func(in.at<ARG>(idx));
+      }
+      return true;
+    }
+  }
+
+  template <legate::Type::Code CODE, std::enable_if_t<!UnaryOp<OP_CODE, CODE>::valid>* = nullptr>
+  bool operator()(
+    legate::Type::Code, std::byte*, EagerOperand, size_t, const std::vector<legate::Scalar>&)
+  {
+    return false;
+  }
+};
+
+struct eager_unary_op_dispatch {
+  template <UnaryOpCode OP_CODE>
+  bool operator()(legate::Type::Code code,
+                  legate::Type::Code out_code,
+                  std::byte* out,
+                  EagerOperand in,
+                  size_t volume,
+                  const std::vector<legate::Scalar>& args)
+  {
+    return legate::type_dispatch(code, eager_unary_op_fn<OP_CODE>{}, out_code, out, in, volume, args);
+  }
+};
+
+template <UnaryRedCode OP_CODE>
+struct eager_unary_red_fn {
+  // Reductions whose value only depends on the elements, not on their positions or extra
+  // arguments
+  static constexpr bool SUPPORTED =
+    OP_CODE == UnaryRedCode::ALL || OP_CODE == UnaryRedCode::ANY ||
+    OP_CODE == UnaryRedCode::COUNT_NONZERO || OP_CODE == UnaryRedCode::MAX ||
+    OP_CODE == UnaryRedCode::MIN || OP_CODE == UnaryRedCode::PROD ||
+    OP_CODE == UnaryRedCode::SUM || OP_CODE == UnaryRedCode::SUM_SQUARES ||
+    OP_CODE == UnaryRedCode::NANMAX || OP_CODE == UnaryRedCode::NANMIN ||
+    OP_CODE == UnaryRedCode::NANPROD || OP_CODE == UnaryRedCode::NANSUM;
+
+  template <legate::Type::Code CODE,
+            std::enable_if_t<SUPPORTED && UnaryRedOp<OP_CODE, CODE>::valid>* = nullptr>
+  bool operator()(legate::Type::Code out_code, std::byte* out, EagerOperand in, size_t volume)
+  {
+    using OP  = UnaryRedOp<OP_CODE, CODE>;
+    using RHS = typename OP::RHS;
+    using VAL = typename OP::VAL;
+
+    if (out_code != legate::type_code_of_v<VAL>) {
+      return false;
+    }
+    const VAL identity = OP::OP::identity;
+    VAL result         = identity;
+    for (size_t idx = 0; idx < volume; ++idx) {
+      OP::template fold<true>(result, OP::convert(in.at<RHS>(idx), identity));
+    }
+    *reinterpret_cast<VAL*>(out) = result;
+    return true;
+  }
+
+  template <legate::Type::Code CODE,
+            std::enable_if_t<!(SUPPORTED && UnaryRedOp<OP_CODE, CODE>::valid)>* = nullptr>
+  bool operator()(legate::Type::Code, std::byte*, EagerOperand, size_t)
+  {
+    return false;
+  }
+};
+
+struct eager_unary_red_dispatch {
+  template <UnaryRedCode OP_CODE>
+  bool operator()(legate::Type::Code code,
+                  legate::Type::Code out_code,
+                  std::byte* out,
+                  EagerOperand in,
+                  size_t volume)
+  {
+    return legate::type_dispatch(code, eager_unary_red_fn<OP_CODE>{}, out_code, out, in, volume);
+  }
+};
+
+template <legate::Type::Code SRC_TYPE>
+struct eager_convert_fn {
+  template <legate::Type::Code DST_TYPE>
+  bool operator()(std::byte* out, EagerOperand in, size_t volume)
+  {
+    if constexpr (SRC_TYPE == DST_TYPE) {
+      return false;
+    } else {
+      using SRC = legate::type_of<SRC_TYPE>;
+      using DST = legate::type_of<DST_TYPE>;
+      ConvertOp<ConvertCode::NOOP, DST_TYPE, SRC_TYPE> func{};
+      auto dst = reinterpret_cast<DST*>(out);
+      for (size_t idx = 0; idx < volume; ++idx) {
+        dst[idx] = func(in.at<SRC>(idx));
+      }
+      return true;
+    }
+  }
+};
+
+struct eager_convert_dispatch {
+  template <legate::Type::Code SRC_TYPE>
+  bool operator()(legate::Type::Code dst_code, std::byte* out, EagerOperand in, size_t volume)
+  {
+    return legate::type_dispatch(dst_code, eager_convert_fn<SRC_TYPE>{}, out, in, volume);
+  }
+};
+
+}  // namespace
+
+std::byte* NDArray::eager_output()
+{
+  if (!eager_ || eager_->store.has_value()) {
+    return nullptr;
+  }
+  eager_->data.resize(size() * type().size());
+  return eager_->data.data();
+}
+
+const std::byte* NDArray::eager_input() const
+{
+  if (!eager_ || eager_->store.has_value() || eager_->data.empty()) {
+    return nullptr;
+  }
+  return eager_->data.data();
+}
+
+void NDArray::eager_discard(bool fresh)
+{
+  // Drop a buffer allocated for an operation that turned out not to be eager, so that the array
+  // is not promoted with values that were never written
+  if (fresh) {
+    eager_->data = {};
+  }
+}
+
+legate::LogicalStore& NDArray::store() const
+{
+  if (!eager_) {
+    return store_;
+  }
+
+  if (!eager_->store.has_value()) {
+    auto& data = eager_->data;
+    if (data.empty()) {
+      // Nothing was computed eagerly, so the store the array was created with is up to date
+      eager_->store = store_;
+    } else if (size() == 1) {
+      auto runtime  = legate::Runtime::get_runtime();
+      eager_->store = runtime->create_store(legate::Scalar{type(), data.data(), true /*copy*/},
+                                            legate::Shape{shape()});
+    } else {
+      // The allocation stays alive until Legate detaches it along with the store
+      auto values = std::make_shared<std::vector<std::byte>>(std::move(data));
+      auto alloc  = legate::ExternalAllocation::create_sysmem(
+        values->data(), values->size(), false /*read_only*/, [values](void*) {});
+      auto runtime  = legate::Runtime::get_runtime();
+      eager_->store = runtime->create_store(legate::Shape{shape()}, type(), alloc);
+    }
+    data = {};
+  }
+
+  store_ = eager_->store.value();
+  eager_.reset();
+  return store_;
+}
+
+bool NDArray::eager_fill(const Scalar& value)
+{
+  if (value.type() != type()) {
+    return false;
+  }
+  auto out = eager_output();
+  if (nullptr == out) {
+    return false;
+  }
+  const auto item_size = type().size();
+  for (size_t idx = 0; idx < size(); ++idx) {
+    std::memcpy(out + idx * item_size, value.ptr(), item_size);
+  }
+  return true;
+}
+
+namespace {
+
+// Eager inputs must have the shape of the output or a single element
+std::optional<EagerOperand> eager_operand(const NDArray& out,
+                                          const NDArray& input,
+                                          const std::byte* ptr)
+{
+  if (nullptr == ptr) {
+    return std::nullopt;
+  }
+  if (input.shape() == out.shape()) {
+    return EagerOperand{ptr, 1};
+  }
+  if (input.size() == 1 && input.dim() <= out.dim()) {
+    return EagerOperand{ptr, 0};
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+bool NDArray::eager_binary_op(int32_t op_code, const NDArray& rhs1, const NDArray& rhs2)
+{
+  auto in1 = eager_operand(*this, rhs1, rhs1.eager_input());
+  auto in2 = eager_operand(*this, rhs2, rhs2.eager_input());
+  if (!in1.has_value() || !in2.has_value() || !eager_ || eager_->store.has_value()) {
+    return false;
+  }
+
+  // The output may alias an input, which element-wise operations tolerate
+  const bool fresh = eager_->data.empty();
+  auto out         = eager_output();
+  if (op_dispatch(static_cast<BinaryOpCode>(op_code),
+                  eager_binary_op_dispatch{},
+                  rhs1.type().code(),
+                  type().code(),
+                  out,
+                  in1.value(),
+                  in2.value(),
+                  size())) {
+    return true;
+  }
+  eager_discard(fresh);
+  return false;
+}
+
+bool NDArray::eager_unary_op(int32_t op_code,
+                             const NDArray& input,
+                             const std::vector<legate::Scalar>& extra_args)
+{
+  auto in = eager_operand(*this, input, input.eager_input());
+  if (!in.has_value() || !eager_ || eager_->store.has_value()) {
+    return false;
+  }
+
+  const bool fresh = eager_->data.empty();
+  auto out         = eager_output();
+  if (static_cast<UnaryOpCode>(op_code) == UnaryOpCode::COPY && input.type() == type()) {
+    const auto item_size = type().size();
+    if (in->stride == 0) {
+      for (size_t idx = 0; idx < size(); ++idx) {
+        std::memcpy(out + idx * item_size, in->ptr, item_size);
+      }
+    } else if (out != in->ptr) {
+      std::memcpy(out, in->ptr, size() * item_size);
+    }
+    return true;
+  }
+  if (op_dispatch(static_cast<UnaryOpCode>(op_code),
+                  eager_unary_op_dispatch{},
+                  input.type().code(),
+                  type().code(),
+                  out,
+                  in.value(),
+                  size(),
+                  extra_args)) {
+    return true;
+  }
+  eager_discard(fresh);
+  return false;
+}
+
+bool NDArray::eager_unary_reduction(int32_t op_code, const NDArray& input)
+{
+  auto in = input.eager_input();
+  if (nullptr == in || size() != 1) {
+    return false;
+  }
+  if (!eager_ || eager_->store.has_value()) {
+    return false;
+  }
+  const bool fresh = eager_->data.empty();
+  auto out         = eager_output();
+  if (op_dispatch(static_cast<UnaryRedCode>(op_code),
+                  eager_unary_red_dispatch{},
+                  input.type().code(),
+                  type().code(),
+                  out,
+                  EagerOperand{in, 1},
+                  input.size())) {
+    return true;
+  }
+  eager_discard(fresh);
+  return false;
+}
+
+bool NDArray::eager_convert(const NDArray& rhs, int32_t nan_op)
+{
+  // Conversions that also replace NaNs are only issued by the Python frontend
+  if (static_cast<ConvertCode>(nan_op) != ConvertCode::NOOP) {
+    return false;
+  }
+  auto in = eager_operand(*this, rhs, rhs.eager_input());
+  if (!in.has_value() || !eager_ || eager_->store.has_value()) {
+    return false;
+  }
+  const bool fresh = eager_->data.empty();
+  auto out         = eager_output();
+  if (legate::type_dispatch(
+        rhs.type().code(), eager_convert_dispatch{}, type().code(), out, in.value(), size())) {
+    return true;
+  }
+  eager_discard(fresh);
+  return false;
+}
+
+}  // namespace cupynumeric
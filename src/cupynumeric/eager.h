@@ -0,0 +1,44 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "legate.h"
+
+namespace cupynumeric {
+
+// Arrays created with at most CuPyNumericRuntime::max_eager_volume() elements start out eager,
+// like the eager thunks of the Python frontend. Element-wise operations, fills, conversions and
+// full reductions whose operands are all eager run immediately on their host values, using the
+// functors of the corresponding tasks, without launching any task.
+//
+// Any other use of an eager array promotes it: its values are attached to a store, which every
+// copy of the NDArray adopts, and the array goes through tasks from then on. An array whose
+// values were never written eagerly simply keeps the store it was created with.
+struct EagerStorage {
+  // Dense row-major values, allocated by the first eager operation that writes the array
+  std::vector<std::byte> data{};
+  // Set when the array gets promoted
+  std::optional<legate::LogicalStore> store{};
+};
+
+[[nodiscard]] bool is_eager_type(const legate::Type& type);
+
+}  // namespace cupynumeric
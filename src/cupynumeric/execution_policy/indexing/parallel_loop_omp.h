@@ -18,6 +18,7 @@
 
 #include "cupynumeric/cupynumeric_task.h"
 #include "cupynumeric/execution_policy/indexing/parallel_loop.h"
+#include "cupynumeric/execution_policy/scheduling.h"
 #include "cupynumeric/omp_help.h"
 
 #include <omp.h>
@@ -30,9 +31,16 @@ struct ParallelLoopPolicy<VariantKind::OMP, Tag> {
   void operator()(const RECT& rect, KERNEL&& kernel)
   {
     const size_t volume = rect.volume();
-#pragma omp for schedule(static)
-    for (size_t idx = 0; idx < volume; ++idx) {
-      kernel(idx, Tag{});
+    if constexpr (is_dynamic_tag<Tag>::value) {
+#pragma omp parallel for schedule(dynamic, DYNAMIC_CHUNK_SIZE)
+      for (size_t idx = 0; idx < volume; ++idx) {
+        kernel(idx, Tag{});
+      }
+    } else {
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) {
+        kernel(idx, Tag{});
+      }
     }
   }
 };
@@ -38,6 +38,33 @@ static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
   reduce_output(out, value);
 }
 
+// Same as scalar_unary_red_kernel, except that threads stop visiting points once any thread
+// has found a partial result that the remaining points cannot change. Every thread still
+// takes part in the final exchange.
+template <class AccessorRD, class Kernel, class LHS, class Tag>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  scalar_unary_red_short_circuit_kernel(size_t volume,
+                                        size_t iters,
+                                        AccessorRD out,
+                                        Kernel kernel,
+                                        LHS identity,
+                                        Tag tag,
+                                        volatile bool* finished)
+{
+  auto value = identity;
+  for (size_t idx = 0; idx < iters && !*finished; idx++) {
+    const size_t offset = (idx * gridDim.x + blockIdx.x) * blockDim.x + threadIdx.x;
+    if (offset < volume) {
+      kernel(value, offset, identity, tag);
+      if (kernel.done(value)) {
+        *finished = true;
+      }
+    }
+  }
+  // Every thread in the thread block must participate in the exchange to get correct results
+  reduce_output(out, value);
+}
+
 template <typename Buffer, typename RedAcc>
 static __global__ void __launch_bounds__(1, 1) copy_kernel(Buffer result, RedAcc out)
 {
@@ -64,7 +91,17 @@ struct ScalarReductionPolicy<VariantKind::GPU, LG_OP, Tag> {
     DeviceScalarReductionBuffer<LG_OP> result(stream);
     size_t shmem_size = THREADS_PER_BLOCK / 32 * sizeof(LHS);
 
-    if (blocks >= MAX_REDUCTION_CTAS) {
+    if constexpr (is_short_circuit<Kernel>::value) {
+      auto finished = create_buffer<bool>(1, legate::Memory::Kind::GPU_FB_MEM);
+      CUPYNUMERIC_CHECK_CUDA(cudaMemsetAsync(finished.ptr(0), 0, sizeof(bool), stream));
+      const size_t num_ctas = std::min<size_t>(blocks, MAX_REDUCTION_CTAS);
+      const size_t iters    = (blocks + num_ctas - 1) / num_ctas;
+      scalar_reduction_impl::scalar_unary_red_short_circuit_kernel<<<num_ctas,
+                                                                     THREADS_PER_BLOCK,
+                                                                     shmem_size,
+                                                                     stream>>>(
+        volume, iters, result, std::forward<Kernel>(kernel), identity, Tag{}, finished.ptr(0));
+    } else if (blocks >= MAX_REDUCTION_CTAS) {
       const size_t iters = (blocks + MAX_REDUCTION_CTAS - 1) / MAX_REDUCTION_CTAS;
       scalar_reduction_impl::
         scalar_unary_red_kernel<<<MAX_REDUCTION_CTAS, THREADS_PER_BLOCK, shmem_size, stream>>>(
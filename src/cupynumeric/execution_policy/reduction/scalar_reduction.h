@@ -17,9 +17,42 @@
 #pragma once
 
 #include "cupynumeric/cupynumeric_task.h"
+#include "cupynumeric/execution_policy/scheduling.h"
+
+#include <algorithm>
+#include <type_traits>
 
 namespace cupynumeric {
 
+// Kernels whose result can saturate (e.g., `any` once it has seen a true
+// value) may opt into early termination by defining
+//
+//   static constexpr bool SHORT_CIRCUIT = true;
+//   bool done(const LHS& lhs) const;
+//
+// where `done` reports that folding more values cannot change `lhs`. The
+// policies then check for completion between chunks of the iteration space
+// and skip the rest once any of their partial results is done.
+template <class Kernel, class = void>
+struct is_short_circuit : std::false_type {};
+
+template <class Kernel>
+struct is_short_circuit<Kernel, std::void_t<decltype(std::decay_t<Kernel>::SHORT_CIRCUIT)>>
+  : std::bool_constant<std::decay_t<Kernel>::SHORT_CIRCUIT> {};
+
+// Number of points visited between two checks for completion
+static constexpr size_t SHORT_CIRCUIT_CHUNK_SIZE = 1 << 12;
+
+// Kernels that can fold a contiguous range of points more cheaply than one
+// point at a time may pass a tag with `static constexpr bool RANGE = true`.
+// The CPU policies then call `kernel(lhs, lo, hi, identity, Tag{})` once per
+// range instead of once per point.
+template <class Tag, class = void>
+struct is_range_tag : std::false_type {};
+
+template <class Tag>
+struct is_range_tag<Tag, std::void_t<decltype(Tag::RANGE)>> : std::bool_constant<Tag::RANGE> {};
+
 template <VariantKind KIND, class LG_OP, class Tag = void>
 struct ScalarReductionPolicy {
   // No C++-20 yet. This is just here to illustrate the expected concept
@@ -42,8 +75,19 @@ struct ScalarReductionPolicy<VariantKind::CPU, LG_OP, Tag> {
   void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
   {
     auto result = identity;
-    for (size_t idx = 0; idx < volume; ++idx) {
-      kernel(result, idx, identity, Tag{});
+    if constexpr (is_range_tag<Tag>::value) {
+      kernel(result, size_t{0}, volume, identity, Tag{});
+    } else if constexpr (is_short_circuit<Kernel>::value) {
+      for (size_t lo = 0; lo < volume && !kernel.done(result); lo += SHORT_CIRCUIT_CHUNK_SIZE) {
+        const size_t hi = std::min(lo + SHORT_CIRCUIT_CHUNK_SIZE, volume);
+        for (size_t idx = lo; idx < hi; ++idx) {
+          kernel(result, idx, identity, Tag{});
+        }
+      }
+    } else {
+      for (size_t idx = 0; idx < volume; ++idx) {
+        kernel(result, idx, identity, Tag{});
+      }
     }
     out.reduce(0, result);
   }
@@ -20,6 +20,7 @@
 #include "cupynumeric/omp_help.h"
 
 #include <omp.h>
+#include <memory>
 
 namespace cupynumeric {
 
@@ -28,17 +29,82 @@ struct ScalarReductionPolicy<VariantKind::OMP, LG_OP, Tag> {
   template <class AccessorRD, class LHS, class Kernel>
   void operator()(size_t volume, AccessorRD& out, const LHS& identity, Kernel&& kernel)
   {
+    if constexpr (is_dynamic_tag<Tag>::value && !is_range_tag<Tag>::value &&
+                  !is_short_circuit<Kernel>::value) {
+      // Each chunk reduces into its own partial result, and the partials are folded in chunk
+      // order, so the result does not depend on which thread picked up which chunk
+      const size_t num_chunks = (volume + DYNAMIC_CHUNK_SIZE - 1) / DYNAMIC_CHUNK_SIZE;
+      auto partials = std::make_unique<LHS[]>(num_chunks);
+#pragma omp parallel for schedule(dynamic, 1)
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const size_t lo = chunk * DYNAMIC_CHUNK_SIZE;
+        const size_t hi = std::min(lo + DYNAMIC_CHUNK_SIZE, volume);
+        auto partial    = identity;
+        for (size_t idx = lo; idx < hi; ++idx) {
+          kernel(partial, idx, identity, Tag{});
+        }
+        partials[chunk] = partial;
+      }
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        out.reduce(0, partials[chunk]);
+      }
+      return;
+    }
+
     const auto max_threads = omp_get_max_threads();
     ThreadLocalStorage<LHS> locals(max_threads);
     for (auto idx = 0; idx < max_threads; ++idx) {
       locals[idx] = identity;
     }
+    if constexpr (is_range_tag<Tag>::value) {
+      // Each thread takes one contiguous range, in thread order, so the partial results
+      // are folded below in the order of the points they cover
+#pragma omp parallel
+      {
+        const int tid         = omp_get_thread_num();
+        const size_t nthreads = omp_get_num_threads();
+        const size_t chunk    = (volume + nthreads - 1) / nthreads;
+        const size_t lo       = std::min(tid * chunk, volume);
+        const size_t hi       = std::min(lo + chunk, volume);
+        if (lo < hi) {
+          kernel(locals[tid], lo, hi, identity, Tag{});
+        }
+      }
+    } else if constexpr (is_short_circuit<Kernel>::value) {
+      // Chunks are handed out in order, so a hit near the start stops every
+      // thread after at most one more chunk
+      const size_t num_chunks = (volume + SHORT_CIRCUIT_CHUNK_SIZE - 1) / SHORT_CIRCUIT_CHUNK_SIZE;
+      bool finished           = false;
+#pragma omp parallel
+      {
+        const int tid = omp_get_thread_num();
+#pragma omp for schedule(dynamic, 1)
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+          bool stop;
+#pragma omp atomic read
+          stop = finished;
+          if (stop) {
+            continue;
+          }
+          const size_t lo = chunk * SHORT_CIRCUIT_CHUNK_SIZE;
+          const size_t hi = std::min(lo + SHORT_CIRCUIT_CHUNK_SIZE, volume);
+          for (size_t idx = lo; idx < hi; ++idx) {
+            kernel(locals[tid], idx, identity, Tag{});
+          }
+          if (kernel.done(locals[tid])) {
+#pragma omp atomic write
+            finished = true;
+          }
+        }
+      }
+    } else {
 #pragma omp parallel
-    {
-      const int tid = omp_get_thread_num();
+      {
+        const int tid = omp_get_thread_num();
 #pragma omp for schedule(static)
-      for (size_t idx = 0; idx < volume; ++idx) {
-        kernel(locals[tid], idx, identity, Tag{});
+        for (size_t idx = 0; idx < volume; ++idx) {
+          kernel(locals[tid], idx, identity, Tag{});
+        }
       }
     }
     for (auto idx = 0; idx < max_threads; ++idx) {
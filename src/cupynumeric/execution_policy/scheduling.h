@@ -0,0 +1,37 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace cupynumeric {
+
+// Kernels whose cost per point is uneven (e.g., masked or NaN-skipping
+// operations) may pass a tag with `static constexpr bool DYNAMIC = true`.
+// The OpenMP policies then hand out chunks of DYNAMIC_CHUNK_SIZE points on
+// demand instead of splitting the points evenly up front.
+template <class Tag, class = void>
+struct is_dynamic_tag : std::false_type {};
+
+template <class Tag>
+struct is_dynamic_tag<Tag, std::void_t<decltype(Tag::DYNAMIC)>>
+  : std::bool_constant<Tag::DYNAMIC> {};
+
+static constexpr size_t DYNAMIC_CHUNK_SIZE = 1 << 14;
+
+}  // namespace cupynumeric
@@ -104,6 +104,49 @@ struct AdvancedIndexingImplBody<VariantKind::CPU, CODE, DIM, OUT_TYPE> {
   }
 };
 
+template <Type::Code CODE, int DIM, typename OUT_TYPE>
+struct AdvancedIndexingPackedImplBody<VariantKind::CPU, CODE, DIM, OUT_TYPE> {
+  using VAL = type_of<CODE>;
+
+  void operator()(legate::PhysicalStore& out_arr,
+                  const AccessorRO<VAL, DIM>& input,
+                  const PackedMaskRO<DIM>& index,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const size_t volume) const
+  {
+    const int64_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const size_t rows     = volume / row_len;
+
+    size_t size = 0;
+    for (size_t row = 0; row < rows; ++row) {
+      size += index.count(pitches.unflatten(row * row_len, rect.lo), row_len);
+    }
+
+    Point<DIM> extents;
+    Point<DIM> out_p;
+    for (int32_t i = 0; i < DIM; i++) {
+      extents[i] = 1;
+      out_p[i]   = 0;
+    }
+    extents[0] = size;
+
+    auto out = out_arr.create_output_buffer<OUT_TYPE, DIM>(extents, true);
+    if (size == 0) {
+      return;
+    }
+    for (size_t row = 0; row < rows; ++row) {
+      auto p           = pitches.unflatten(row * row_len, rect.lo);
+      const int64_t lo = p[DIM - 1];
+      index.for_each_set(p, row_len, [&](int64_t k) {
+        p[DIM - 1] = lo + k;
+        fill_out(out[out_p], p, input[p]);
+        ++out_p[0];
+      });
+    }
+  }
+};
+
 /*static*/ void AdvancedIndexingTask::cpu_variant(TaskContext context)
 {
   advanced_indexing_template<VariantKind::CPU>(context);
@@ -122,6 +122,88 @@ struct AdvancedIndexingImplBody<VariantKind::OMP, CODE, DIM, OUT_TYPE> {
   }
 };
 
+template <Type::Code CODE, int DIM, typename OUT_TYPE>
+struct AdvancedIndexingPackedImplBody<VariantKind::OMP, CODE, DIM, OUT_TYPE> {
+  using VAL = type_of<CODE>;
+
+  void operator()(PhysicalStore& out_arr,
+                  const AccessorRO<VAL, DIM>& input,
+                  const PackedMaskRO<DIM>& index,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const size_t volume) const
+  {
+    const auto max_threads = omp_get_max_threads();
+
+    const int64_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const int64_t chunks  = (row_len + PACKED_MASK_CHUNK - 1) / PACKED_MASK_CHUNK;
+    const size_t num_work = volume / row_len * chunks;
+
+    // First element of chunk idx, whose number of elements goes to n
+    auto chunk_start = [&](size_t idx, int64_t& n) {
+      const int64_t lo = static_cast<int64_t>(idx % chunks) * PACKED_MASK_CHUNK;
+      auto p           = pitches.unflatten(idx / chunks * row_len, rect.lo);
+      p[DIM - 1] += lo;
+      n = std::min(PACKED_MASK_CHUNK, row_len - lo);
+      return p;
+    };
+
+    ThreadLocalStorage<int64_t> offsets(max_threads);
+    size_t size = 0;
+    {
+      ThreadLocalStorage<int64_t> sizes(max_threads);
+      for (size_t idx = 0; idx < max_threads; ++idx) {
+        sizes[idx] = 0;
+      }
+#pragma omp parallel
+      {
+        const int tid = omp_get_thread_num();
+#pragma omp for schedule(static)
+        for (size_t idx = 0; idx < num_work; ++idx) {
+          int64_t n = 0;
+          auto p    = chunk_start(idx, n);
+          sizes[tid] += index.count(p, n);
+        }
+      }
+      for (size_t idx = 0; idx < max_threads; ++idx) {
+        offsets[idx] = size;
+        size += sizes[idx];
+      }
+    }
+
+    Point<DIM> extents;
+    for (int32_t i = 0; i < DIM; i++) {
+      extents[i] = 1;
+    }
+    extents[0] = size;
+
+    auto out = out_arr.create_output_buffer<OUT_TYPE, DIM>(extents, true);
+    if (size == 0) {
+      return;
+    }
+#pragma omp parallel
+    {
+      const int tid = omp_get_thread_num();
+      Point<DIM> out_p;
+      for (int32_t i = 0; i < DIM; i++) {
+        out_p[i] = 0;
+      }
+      out_p[0] = offsets[tid];
+#pragma omp for schedule(static)
+      for (size_t idx = 0; idx < num_work; ++idx) {
+        int64_t n        = 0;
+        auto p           = chunk_start(idx, n);
+        const int64_t lo = p[DIM - 1];
+        index.for_each_set(p, n, [&](int64_t k) {
+          p[DIM - 1] = lo + k;
+          fill_out(out[out_p], p, input[p]);
+          ++out_p[0];
+        });
+      }
+    }  // end parallel region
+  }
+};
+
 /*static*/ void AdvancedIndexingTask::omp_variant(TaskContext context)
 {
   advanced_indexing_template<VariantKind::OMP>(context);
@@ -18,6 +18,7 @@
 
 // Useful for IDEs
 #include "cupynumeric/index/advanced_indexing.h"
+#include "cupynumeric/bits/packed_mask.h"
 #include "cupynumeric/pitches.h"
 
 namespace cupynumeric {
@@ -27,6 +28,9 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE, int DIM, typename OUT_TYPE>
 struct AdvancedIndexingImplBody;
 
+template <VariantKind KIND, Type::Code CODE, int DIM, typename OUT_TYPE>
+struct AdvancedIndexingPackedImplBody;
+
 template <VariantKind KIND>
 struct AdvancedIndexingImpl {
   // current implementaion of the ND-output regions requires all regions
@@ -40,6 +44,27 @@ struct AdvancedIndexingImpl {
     Pitches<DIM - 1> input_pitches{};
     size_t volume = input_pitches.flatten(input_rect);
 
+    if constexpr (KIND != VariantKind::GPU) {
+      if (is_packed_mask(args.indexing_array)) {
+        // Bit-packed keys always have as many dimensions as the input, so every selected
+        // element becomes one row of the output
+        assert(args.key_dim == DIM);
+        if (volume == 0) {
+          args.output.bind_empty_data();
+          return;
+        }
+        PackedMaskRO<DIM> index_mask{args.indexing_array};
+        if (args.is_set) {
+          AdvancedIndexingPackedImplBody<KIND, CODE, DIM, Point<DIM>>{}(
+            args.output, input_arr, index_mask, input_pitches, input_rect, volume);
+        } else {
+          AdvancedIndexingPackedImplBody<KIND, CODE, DIM, VAL>{}(
+            args.output, input_arr, index_mask, input_pitches, input_rect, volume);
+        }
+        return;
+      }
+    }
+
     auto index_rect = args.indexing_array.shape<DIM>();
     // this task is executed only for the case when index array is a bool type
     auto index_arr = args.indexing_array.read_accessor<bool, DIM>(index_rect);
@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include <legate/utilities/typedefs.h>
 #include "cupynumeric/index/putmask.h"
+#include "cupynumeric/bits/packed_mask.h"
 #include "cupynumeric/pitches.h"
 #include "cupynumeric/execution_policy/indexing/parallel_loop.h"
 
@@ -96,13 +97,60 @@ struct Putmask {
   }
 };
 
-using namespace legate;
+// Putmask with a bit-packed mask, which only visits the set elements of each row segment
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct PutmaskPacked {
+  using T = type_of<CODE>;
+
+  AccessorRW<T, DIM> input;
+  PackedMaskRO<DIM> mask;
+  AccessorRO<T, DIM> values;
+  Pitches<DIM - 1> pitches;
+  Rect<DIM> rect;
+  size_t volume;
+
+  PutmaskPacked(PutmaskArgs& args) : mask(args.mask)
+  {
+    rect   = args.input.shape<DIM>();
+    input  = args.input.read_write_accessor<T, DIM>(rect);
+    values = args.values.read_accessor<T, DIM>(rect);
+    volume = pitches.flatten(rect);
+  }
+
+  void execute() const noexcept
+  {
+    if (volume == 0) {
+      return;
+    }
+    const int64_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const int64_t chunks  = (row_len + PACKED_MASK_CHUNK - 1) / PACKED_MASK_CHUNK;
+    const size_t num_work = volume / row_len * chunks;
+#pragma omp parallel for schedule(static) if (KIND == VariantKind::OMP)
+    for (size_t idx = 0; idx < num_work; ++idx) {
+      const int64_t lo = static_cast<int64_t>(idx % chunks) * PACKED_MASK_CHUNK;
+      auto p           = pitches.unflatten(idx / chunks * row_len, rect.lo);
+      p[DIM - 1] += lo;
+      const int64_t first = p[DIM - 1];
+      mask.for_each_set(p, std::min(PACKED_MASK_CHUNK, row_len - lo), [&](int64_t k) {
+        p[DIM - 1] = first + k;
+        input[p]   = values[p];
+      });
+    }
+  }
+};
 
 template <VariantKind KIND>
 struct PutmaskImpl {
   template <Type::Code CODE, int DIM>
   void operator()(PutmaskArgs& args) const
   {
+    if constexpr (KIND != VariantKind::GPU) {
+      if (is_packed_mask(args.mask)) {
+        PutmaskPacked<KIND, CODE, DIM> putmask(args);
+        putmask.execute();
+        return;
+      }
+    }
     Putmask<KIND, CODE, DIM> putmask(args);
     putmask.execute();
   }
@@ -0,0 +1,52 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cupynumeric/io/file_read.h"
+#include "cupynumeric/io/file_read_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct FileReadImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = type_of<CODE>;
+
+  int operator()(int fd, const FileLayout<DIM>& layout, const AccessorWO<VAL, DIM>& out) const
+  {
+    for (size_t run = 0; run < layout.num_runs(); ++run) {
+      auto start = layout.run_start(run);
+      if (!read_fully(fd, out.ptr(start), layout.run_bytes(), layout.file_offset(start))) {
+        return errno;
+      }
+    }
+    return 0;
+  }
+};
+
+/*static*/ void FileReadTask::cpu_variant(TaskContext context)
+{
+  file_read_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  FileReadTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cupynumeric
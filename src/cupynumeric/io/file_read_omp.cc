@@ -0,0 +1,66 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cupynumeric/io/file_read.h"
+#include "cupynumeric/io/file_read_template.inl"
+
+#include <omp.h>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// Runs larger than this are split between threads
+static constexpr size_t MIN_CHUNK_BYTES = 4 << 20;
+
+// Runs, and large runs split into chunks, are transferred concurrently, which
+// keeps several requests in flight on parallel file systems and NVMe devices
+template <Type::Code CODE, int DIM>
+struct FileReadImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = type_of<CODE>;
+
+  int operator()(int fd, const FileLayout<DIM>& layout, const AccessorWO<VAL, DIM>& out) const
+  {
+    const size_t num_runs  = layout.num_runs();
+    const size_t run_bytes = layout.run_bytes();
+    const size_t num_chunks =
+      std::max<size_t>(1, std::min<size_t>(omp_get_max_threads(), run_bytes / MIN_CHUNK_BYTES));
+    const size_t chunk_bytes = (run_bytes + num_chunks - 1) / num_chunks;
+
+    int error = 0;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t idx = 0; idx < num_runs * num_chunks; ++idx) {
+      const size_t lo = (idx % num_chunks) * chunk_bytes;
+      if (lo >= run_bytes) {
+        continue;
+      }
+      auto start         = layout.run_start(idx / num_chunks);
+      auto ptr           = reinterpret_cast<char*>(out.ptr(start)) + lo;
+      const size_t bytes = std::min(chunk_bytes, run_bytes - lo);
+      if (!read_fully(fd, ptr, bytes, layout.file_offset(start) + lo)) {
+#pragma omp atomic write
+        error = errno;
+      }
+    }
+    return error;
+  }
+};
+
+/*static*/ void FileReadTask::omp_variant(TaskContext context)
+{
+  file_read_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,71 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/io/file_read.h"
+#include "cupynumeric/io/file_util.h"
+
+#include <fcntl.h>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// Returns 0 on success and an errno value otherwise
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct FileReadImplBody;
+
+template <VariantKind KIND>
+struct FileReadImpl {
+  template <Type::Code CODE, int DIM>
+  void operator()(FileReadArgs& args) const
+  {
+    using VAL = type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+    if (rect.empty()) {
+      return;
+    }
+
+    auto out = args.out.write_accessor<VAL, DIM>(rect);
+    assert(out.accessor.is_dense_row_major(rect));
+
+    FileLayout<DIM> layout(rect, args.shape, args.offset, sizeof(VAL));
+
+    const int fd = ::open(args.filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw legate::TaskException(file_error_message("open", args.filename, errno));
+    }
+    const int error = FileReadImplBody<KIND, CODE, DIM>()(fd, layout, out);
+    ::close(fd);
+    if (error != 0) {
+      throw legate::TaskException(file_error_message("read", args.filename, error));
+    }
+  }
+};
+
+template <VariantKind KIND>
+static void file_read_template(TaskContext& context)
+{
+  FileReadArgs args{context.output(0),
+                    context.scalar(0).value<std::string>(),
+                    context.scalar(1).value<int64_t>(),
+                    context.scalar(2).values<int64_t>()};
+  double_dispatch(args.out.dim(), args.out.code(), FileReadImpl<KIND>{}, args);
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,130 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+#include "cupynumeric/pitches.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace cupynumeric {
+
+// Describes where the elements of a C-ordered block `rect` of an array with
+// extents `shape` live in a file whose data starts at byte `offset`. The
+// block is contiguous over the trailing dimensions it covers entirely plus the
+// next one, so it is transferred as `num_runs()` runs of `run_bytes()` each.
+template <int DIM>
+class FileLayout {
+ public:
+  FileLayout(const legate::Rect<DIM>& rect,
+             legate::Span<const int64_t> shape,
+             int64_t offset,
+             size_t elem_size)
+    : rect_(rect), offset_(offset), elem_size_(elem_size)
+  {
+    int64_t stride = 1;
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      strides_[dim] = stride;
+      stride *= shape[dim];
+    }
+
+    run_ = 1;
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      const int64_t extent = rect.hi[dim] - rect.lo[dim] + 1;
+      run_ *= extent;
+      if (extent != shape[dim]) {
+        break;
+      }
+    }
+    num_runs_ = pitches_.flatten(rect) / run_;
+  }
+
+  size_t num_runs() const { return num_runs_; }
+  size_t run_bytes() const { return run_ * elem_size_; }
+  legate::Point<DIM> run_start(size_t run) const
+  {
+    return pitches_.unflatten(run * run_, rect_.lo);
+  }
+
+  off_t file_offset(const legate::Point<DIM>& point) const
+  {
+    int64_t index = 0;
+    for (int32_t dim = 0; dim < DIM; ++dim) {
+      index += point[dim] * strides_[dim];
+    }
+    return static_cast<off_t>(offset_ + index * static_cast<int64_t>(elem_size_));
+  }
+
+ private:
+  legate::Rect<DIM> rect_;
+  Pitches<DIM - 1> pitches_;
+  int64_t strides_[DIM];
+  int64_t offset_;
+  size_t elem_size_;
+  size_t run_;
+  size_t num_runs_;
+};
+
+// pread/pwrite loops that retry on short transfers and interrupts. Both return
+// false on failure and leave the reason in errno.
+inline bool read_fully(int fd, void* buffer, size_t bytes, off_t offset)
+{
+  auto ptr = static_cast<char*>(buffer);
+  while (bytes > 0) {
+    const ssize_t done = ::pread(fd, ptr, bytes, offset);
+    if (done < 0 && errno == EINTR) {
+      continue;
+    }
+    if (done <= 0) {
+      if (done == 0) {
+        errno = EIO;  // unexpected end of file
+      }
+      return false;
+    }
+    ptr += done;
+    bytes -= done;
+    offset += done;
+  }
+  return true;
+}
+
+inline bool write_fully(int fd, const void* buffer, size_t bytes, off_t offset)
+{
+  auto ptr = static_cast<const char*>(buffer);
+  while (bytes > 0) {
+    const ssize_t done = ::pwrite(fd, ptr, bytes, offset);
+    if (done < 0 && errno == EINTR) {
+      continue;
+    }
+    if (done < 0) {
+      return false;
+    }
+    ptr += done;
+    bytes -= done;
+    offset += done;
+  }
+  return true;
+}
+
+inline std::string file_error_message(const char* action, const std::string& filename, int error)
+{
+  return std::string("Unable to ") + action + " " + filename + ": " + std::strerror(error);
+}
+
+}  // namespace cupynumeric
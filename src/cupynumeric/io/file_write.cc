@@ -0,0 +1,52 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cupynumeric/io/file_write.h"
+#include "cupynumeric/io/file_write_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <Type::Code CODE, int DIM>
+struct FileWriteImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = type_of<CODE>;
+
+  int operator()(int fd, const FileLayout<DIM>& layout, const AccessorRO<VAL, DIM>& in) const
+  {
+    for (size_t run = 0; run < layout.num_runs(); ++run) {
+      auto start = layout.run_start(run);
+      if (!write_fully(fd, in.ptr(start), layout.run_bytes(), layout.file_offset(start))) {
+        return errno;
+      }
+    }
+    return 0;
+  }
+};
+
+/*static*/ void FileWriteTask::cpu_variant(TaskContext context)
+{
+  file_write_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  FileWriteTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cupynumeric
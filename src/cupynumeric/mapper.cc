@@ -66,8 +66,17 @@ std::vector<StoreMapping> CuPyNumericMapper::store_mappings(
     }
     case CUPYNUMERIC_MATMUL: {
       std::vector<StoreMapping> mappings;
-      auto inputA = task.input(1);
-      auto inputB = task.input(2);
+      // Replicated launches pass the result as a reduction instead of an output and an input, and
+      // fused epilogues pass it as an input only when they scale it into the product
+      auto reductions = task.reductions();
+      auto replicated = !reductions.empty();
+      auto scalars    = task.scalars();
+      uint32_t first  = replicated ? 0 : 1;
+      if (!scalars.empty()) {
+        first = scalars[1].value<double>() != 0.0 ? 1 : 0;
+      }
+      auto inputA = task.input(first);
+      auto inputB = task.input(first + 1);
 
       mappings.push_back(
         StoreMapping::default_mapping(inputA.data(), options.front(), true /*exact*/));
@@ -76,16 +85,29 @@ std::vector<StoreMapping> CuPyNumericMapper::store_mappings(
         StoreMapping::default_mapping(inputB.data(), options.front(), true /*exact*/));
       mappings.back().policy().redundant = true;
 
-      auto outputC = task.output(0);
+      auto outputC = replicated ? reductions[0] : task.output(0);
       mappings.push_back(
         StoreMapping::default_mapping(outputC.data(), options.front(), true /*exact*/));
 
       return mappings;
     }
-    case CUPYNUMERIC_MATVECMUL:
+    case CUPYNUMERIC_MATVECMUL: {
+      // The task hands arbitrary strides to BLAS as leading dimensions and increments, and has a
+      // strided kernel for matrices without a unit stride, so the inputs can reuse any instance
+      std::vector<StoreMapping> mappings;
+      auto inputs     = task.inputs();
+      auto reductions = task.reductions();
+      for (auto& input : inputs) {
+        mappings.push_back(StoreMapping::default_mapping(input.data(), options.front()));
+      }
+      for (auto& reduction : reductions) {
+        mappings.push_back(
+          StoreMapping::default_mapping(reduction.data(), options.front(), true /*exact*/));
+      }
+      return mappings;
+    }
+    case CUPYNUMERIC_BATCHED_MATMUL:
     case CUPYNUMERIC_UNIQUE_REDUCE: {
-      // TODO: Our actual requirements are a little less strict than this; we require each array or
-      // vector to have a stride of 1 on at least one dimension.
       std::vector<StoreMapping> mappings;
       auto inputs     = task.inputs();
       auto reductions = task.reductions();
@@ -124,8 +146,12 @@ std::vector<StoreMapping> CuPyNumericMapper::store_mappings(
       return mappings;
     }
     // CHANGE: If this code is changed, make sure all layouts are
-    // consistent with those assumed in batched_cholesky.cu, etc
-    case CUPYNUMERIC_BATCHED_CHOLESKY: {
+    // consistent with those assumed in batched_cholesky.cu, syev_template.inl,
+    // file_read_template.inl, etc
+    case CUPYNUMERIC_BATCHED_CHOLESKY:
+    case CUPYNUMERIC_FILE_READ:
+    case CUPYNUMERIC_FILE_WRITE:
+    case CUPYNUMERIC_SYEV: {
       std::vector<StoreMapping> mappings;
       auto inputs  = task.inputs();
       auto outputs = task.outputs();
@@ -0,0 +1,140 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/matrix/batched_matmul.h"
+#include "cupynumeric/matrix/batched_matmul_template.inl"
+
+#include "cupynumeric/cuda_help.h"
+
+namespace cupynumeric {
+
+// Data types handed to cublasGemmStridedBatchedEx, per input type
+template <Type::Code CODE>
+struct cublas_batched_types;
+
+template <>
+struct cublas_batched_types<Type::Code::FLOAT16> {
+  using SCALAR                                 = float;
+  static constexpr cudaDataType_t INPUT        = CUDA_R_16F;
+  static constexpr cudaDataType_t OUTPUT       = CUDA_R_32F;
+  static constexpr cublasComputeType_t COMPUTE = CUBLAS_COMPUTE_32F;
+  static constexpr SCALAR ONE                  = 1.0;
+};
+
+template <>
+struct cublas_batched_types<Type::Code::FLOAT32> {
+  using SCALAR                                 = float;
+  static constexpr cudaDataType_t INPUT        = CUDA_R_32F;
+  static constexpr cudaDataType_t OUTPUT       = CUDA_R_32F;
+  static constexpr cublasComputeType_t COMPUTE = CUBLAS_COMPUTE_32F;
+  static constexpr SCALAR ONE                  = 1.0;
+};
+
+template <>
+struct cublas_batched_types<Type::Code::FLOAT64> {
+  using SCALAR                                 = double;
+  static constexpr cudaDataType_t INPUT        = CUDA_R_64F;
+  static constexpr cudaDataType_t OUTPUT       = CUDA_R_64F;
+  static constexpr cublasComputeType_t COMPUTE = CUBLAS_COMPUTE_64F;
+  static constexpr SCALAR ONE                  = 1.0;
+};
+
+template <>
+struct cublas_batched_types<Type::Code::COMPLEX64> {
+  using SCALAR                                 = cuComplex;
+  static constexpr cudaDataType_t INPUT        = CUDA_C_32F;
+  static constexpr cudaDataType_t OUTPUT       = CUDA_C_32F;
+  static constexpr cublasComputeType_t COMPUTE = CUBLAS_COMPUTE_32F;
+  static constexpr SCALAR ONE                  = {1.0, 0.0};
+};
+
+template <>
+struct cublas_batched_types<Type::Code::COMPLEX128> {
+  using SCALAR                                 = cuDoubleComplex;
+  static constexpr cudaDataType_t INPUT        = CUDA_C_64F;
+  static constexpr cudaDataType_t OUTPUT       = CUDA_C_64F;
+  static constexpr cublasComputeType_t COMPUTE = CUBLAS_COMPUTE_64F;
+  static constexpr SCALAR ONE                  = {1.0, 0.0};
+};
+
+// NOTE:
+// As in matmul.cu, the operands are swapped so that cuBLAS sees column-major matrices and
+// computes NxM = NxK * KxM for every matrix of the batch.
+
+template <Type::Code CODE>
+struct BatchedMatMulImplBody<VariantKind::GPU, CODE> {
+  using VAL   = type_of<CODE>;
+  using ACC   = typename support_matmul<CODE>::ACC_TYPE;
+  using TYPES = cublas_batched_types<CODE>;
+
+  void operator()(size_t batches,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  ACC* lhs,
+                  const VAL* rhs1,
+                  const VAL* rhs2,
+                  size_t lhs_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_stride,
+                  size_t lhs_batch_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs2_batch_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    // The lhs is a reduction buffer, so the products are always accumulated into it
+    const typename TYPES::SCALAR alpha = TYPES::ONE;
+    const typename TYPES::SCALAR beta  = TYPES::ONE;
+
+    CHECK_CUBLAS(cublasGemmStridedBatchedEx(cublas_handle,
+                                            rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                            rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                            n,
+                                            m,
+                                            k,
+                                            &alpha,
+                                            rhs2,
+                                            TYPES::INPUT,
+                                            rhs2_stride,
+                                            rhs2_batch_stride,
+                                            rhs1,
+                                            TYPES::INPUT,
+                                            rhs1_stride,
+                                            rhs1_batch_stride,
+                                            &beta,
+                                            lhs,
+                                            TYPES::OUTPUT,
+                                            lhs_stride,
+                                            lhs_batch_stride,
+                                            batches,
+                                            TYPES::COMPUTE,
+                                            CUBLAS_GEMM_DEFAULT));
+
+    CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+/*static*/ void BatchedMatMulTask::gpu_variant(TaskContext context)
+{
+  batched_matmul_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cupynumeric
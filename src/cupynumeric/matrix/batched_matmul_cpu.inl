@@ -0,0 +1,89 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cupynumeric/matrix/batched_matmul.h"
+#include "cupynumeric/matrix/batched_matmul_template.inl"
+#include "cupynumeric/matrix/matmul_cpu.inl"
+
+#include <cblas.h>
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE>
+struct BatchedMatMulImplBody {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+  void operator()(size_t batches,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  ACC* lhs,
+                  const VAL* rhs1,
+                  const VAL* rhs2,
+                  size_t lhs_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_stride,
+                  size_t lhs_batch_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs2_batch_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto gemm = [&](size_t batch) {
+      MatMulImplBody<KIND, CODE>()(m,
+                                   n,
+                                   k,
+                                   lhs + batch * lhs_batch_stride,
+                                   rhs1 + batch * rhs1_batch_stride,
+                                   rhs2 + batch * rhs2_batch_stride,
+                                   lhs_stride,
+                                   rhs1_stride,
+                                   rhs2_stride,
+                                   rhs1_transposed,
+                                   rhs2_transposed,
+                                   false /*lhs_overwritable*/);
+    };
+
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+    // BLAS parallelizes poorly over small matrices, so the OpenMP variant spreads the batch
+    // across threads when there is a matrix for each of them. Only one level is parallel:
+    // BLAS is single-threaded inside the region, and otherwise gets all the threads itself.
+    if (KIND == VariantKind::OMP && batches >= static_cast<size_t>(omp_get_max_threads())) {
+      const int blas_threads = openblas_get_num_threads();
+      openblas_set_num_threads(1);
+#pragma omp parallel for schedule(static)
+      for (size_t batch = 0; batch < batches; ++batch) {
+        gemm(batch);
+      }
+      openblas_set_num_threads(blas_threads);
+      return;
+    }
+#endif
+    for (size_t batch = 0; batch < batches; ++batch) {
+      gemm(batch);
+    }
+  }
+};
+
+}  // namespace cupynumeric
@@ -0,0 +1,36 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/matrix/batched_matmul.h"
+#include "cupynumeric/matrix/batched_matmul_template.inl"
+#include "cupynumeric/matrix/batched_matmul_cpu.inl"
+
+#include <cblas.h>
+#include <omp.h>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+/*static*/ void BatchedMatMulTask::omp_variant(TaskContext context)
+{
+  // Batches too small to occupy every thread run one GEMM at a time with multithreaded BLAS;
+  // see BatchedMatMulImplBody for the larger ones
+  openblas_set_num_threads(omp_get_max_threads());
+  batched_matmul_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cupynumeric
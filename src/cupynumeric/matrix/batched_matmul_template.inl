@@ -0,0 +1,140 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/matrix/batched_matmul.h"
+#include "cupynumeric/matrix/matmul_template.inl"
+#include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/perf_counters.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, Type::Code CODE>
+struct BatchedMatMulImplBody;
+
+template <VariantKind KIND>
+struct BatchedMatMulImpl {
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<support_matmul<CODE>::value && (DIM >= 4)>* = nullptr>
+  void operator()(BatchedMatMulArgs& args) const
+  {
+    using VAL = type_of<CODE>;
+    using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+    // All three stores are promoted to (batch..., m, n, k), and only the batch dimensions are
+    // partitioned
+    auto shape = args.rhs1.shape<DIM>().intersection(args.rhs2.shape<DIM>());
+
+    if (shape.empty()) {
+      return;
+    }
+
+    const auto m = static_cast<size_t>(shape.hi[DIM - 3] - shape.lo[DIM - 3] + 1);
+    const auto n = static_cast<size_t>(shape.hi[DIM - 2] - shape.lo[DIM - 2] + 1);
+    const auto k = static_cast<size_t>(shape.hi[DIM - 1] - shape.lo[DIM - 1] + 1);
+
+    size_t strides_lhs[DIM];
+    size_t strides_rhs1[DIM];
+    size_t strides_rhs2[DIM];
+
+    auto rhs1 = args.rhs1.read_accessor<VAL, DIM>(shape).ptr(shape, strides_rhs1);
+    auto rhs2 = args.rhs2.read_accessor<VAL, DIM>(shape).ptr(shape, strides_rhs2);
+    auto lhs =
+      args.lhs.reduce_accessor<SumReduction<ACC>, true, DIM>(shape).ptr(shape, strides_lhs);
+
+#ifdef DEBUG_CUPYNUMERIC
+    assert(strides_lhs[DIM - 1] == 0);
+    assert(strides_rhs1[DIM - 2] == 0);
+    assert(strides_rhs2[DIM - 3] == 0);
+#endif
+
+    bool transposed_rhs1;
+    bool transposed_rhs2;
+    size_t stride_rhs1 =
+      stride_for_blas(m, k, strides_rhs1[DIM - 3], strides_rhs1[DIM - 1], transposed_rhs1);
+    size_t stride_rhs2 =
+      stride_for_blas(k, n, strides_rhs2[DIM - 1], strides_rhs2[DIM - 2], transposed_rhs2);
+
+    // The innermost batch dimension is handed to the body as one strided batch; any outer ones
+    // are looped over here
+    constexpr int BATCH_DIM = DIM - 4;
+    const auto batches = static_cast<size_t>(shape.hi[BATCH_DIM] - shape.lo[BATCH_DIM] + 1);
+
+    size_t outer = 1;
+    for (int dim = 0; dim < BATCH_DIM; ++dim) {
+      outer *= static_cast<size_t>(shape.hi[dim] - shape.lo[dim] + 1);
+    }
+
+    for (size_t idx = 0; idx < outer; ++idx) {
+      size_t lhs_offset  = 0;
+      size_t rhs1_offset = 0;
+      size_t rhs2_offset = 0;
+      size_t remainder   = idx;
+      for (int dim = BATCH_DIM - 1; dim >= 0; --dim) {
+        auto extent = static_cast<size_t>(shape.hi[dim] - shape.lo[dim] + 1);
+        auto coord  = remainder % extent;
+        remainder /= extent;
+        lhs_offset += coord * strides_lhs[dim];
+        rhs1_offset += coord * strides_rhs1[dim];
+        rhs2_offset += coord * strides_rhs2[dim];
+      }
+
+      BatchedMatMulImplBody<KIND, CODE>()(batches,
+                                          m,
+                                          n,
+                                          k,
+                                          lhs + lhs_offset,
+                                          rhs1 + rhs1_offset,
+                                          rhs2 + rhs2_offset,
+                                          strides_lhs[DIM - 3],
+                                          stride_rhs1,
+                                          stride_rhs2,
+                                          strides_lhs[BATCH_DIM],
+                                          strides_rhs1[BATCH_DIM],
+                                          strides_rhs2[BATCH_DIM],
+                                          transposed_rhs1,
+                                          transposed_rhs2);
+    }
+  }
+
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<!support_matmul<CODE>::value || (DIM < 4)>* = nullptr>
+  void operator()(BatchedMatMulArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void batched_matmul_template(TaskContext& context)
+{
+  PerfScope perf{context, CUPYNUMERIC_BATCHED_MATMUL, KIND};
+  auto reductions = context.reductions();
+  auto inputs     = context.inputs();
+
+  BatchedMatMulArgs args{reductions[0], inputs[0], inputs[1]};
+  // Note that we can't dispatch on the lhs's type,
+  // as the lhs can have a different type than the rhs'
+  double_dispatch(args.rhs1.dim(), args.rhs1.code(), BatchedMatMulImpl<KIND>{}, args);
+}
+
+}  // namespace cupynumeric
@@ -17,6 +17,7 @@
 #include "cupynumeric/matrix/contract.h"
 #include "cupynumeric/matrix/contract_template.inl"
 #include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/scratch_arena.h"
 
 #include <tblis/tblis.h>
 
@@ -120,17 +121,20 @@ struct ContractImplBody<VariantKind::CPU, Type::Code::FLOAT16> {
 
     std::vector<int64_t> lhs_copy_strides(lhs_ndim);
     int64_t lhs_size     = calculate_volume(lhs_ndim, lhs_shape, lhs_copy_strides.data());
-    float* lhs_copy_data = allocate_buffer(lhs_size);
+    ScratchBuffer<float> lhs_copy(lhs_size);
+    float* lhs_copy_data = lhs_copy.ptr();
     half_tensor_to_float(lhs_copy_data, lhs_data, lhs_ndim, lhs_shape, lhs_strides);
 
     std::vector<int64_t> rhs1_copy_strides(rhs1_ndim);
     int64_t rhs1_size     = calculate_volume(rhs1_ndim, rhs1_shape, rhs1_copy_strides.data());
-    float* rhs1_copy_data = allocate_buffer(rhs1_size);
+    ScratchBuffer<float> rhs1_copy(rhs1_size);
+    float* rhs1_copy_data = rhs1_copy.ptr();
     half_tensor_to_float(rhs1_copy_data, rhs1_data, rhs1_ndim, rhs1_shape, rhs1_strides);
 
     std::vector<int64_t> rhs2_copy_strides(rhs2_ndim);
     int64_t rhs2_size     = calculate_volume(rhs2_ndim, rhs2_shape, rhs2_copy_strides.data());
-    float* rhs2_copy_data = allocate_buffer(rhs2_size);
+    ScratchBuffer<float> rhs2_copy(rhs2_size);
+    float* rhs2_copy_data = rhs2_copy.ptr();
     half_tensor_to_float(rhs2_copy_data, rhs2_data, rhs2_ndim, rhs2_shape, rhs2_strides);
 
     ContractImplBody<VariantKind::CPU, Type::Code::FLOAT32>{}(lhs_copy_data,
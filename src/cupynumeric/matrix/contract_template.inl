@@ -18,6 +18,7 @@
 
 // Useful for IDEs
 #include "cupynumeric/matrix/contract.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 #if 0  // debugging output
 #include "legate/utilities/debug.h"
@@ -211,6 +212,7 @@ struct ContractImpl {
 template <VariantKind KIND>
 static void contract_template(legate::TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_CONTRACT, KIND};
   ContractArgs args{context.reduction(0),
                     context.input(0),
                     context.input(1),
@@ -18,6 +18,7 @@
 
 // Useful for IDEs
 #include "cupynumeric/matrix/dot.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -66,6 +67,7 @@ struct DotImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     DotImplBody<KIND, CODE>()(lhs, rhs1, rhs2, rect, dense);
   }
@@ -74,6 +76,7 @@ struct DotImpl {
 template <VariantKind KIND>
 static void dot_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_DOT, KIND};
   auto inputs = context.inputs();
   DotArgs args{context.reduction(0), inputs[0], inputs[1]};
   type_dispatch(args.rhs1.code(), DotImpl<KIND>{}, args);
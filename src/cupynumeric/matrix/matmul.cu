@@ -250,6 +250,52 @@ struct MatMulImplBody<VariantKind::GPU, Type::Code::COMPLEX128> {
   }
 };
 
+template <typename VAL, typename ACC, typename EPILOGUE>
+__global__ static void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  matmul_epilogue_kernel(size_t volume,
+                         size_t n,
+                         VAL* lhs,
+                         size_t lhs_stride,
+                         const ACC* acc,
+                         const VAL* bias,
+                         size_t bias_row_stride,
+                         size_t bias_col_stride,
+                         EPILOGUE epilogue)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) {
+    return;
+  }
+  const size_t i = idx / n;
+  const size_t j = idx % n;
+  epilogue(lhs + i * lhs_stride + j,
+           acc[idx],
+           bias == nullptr ? nullptr : bias + i * bias_row_stride + j * bias_col_stride);
+}
+
+template <Type::Code CODE>
+struct MatMulEpilogueBody<VariantKind::GPU, CODE> {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+  void operator()(size_t m,
+                  size_t n,
+                  VAL* lhs,
+                  size_t lhs_stride,
+                  const ACC* acc,
+                  const VAL* bias,
+                  const size_t bias_strides[2],
+                  const MatMulEpilogue<CODE>& epilogue)
+  {
+    auto stream         = get_cached_stream();
+    const size_t volume = m * n;
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    matmul_epilogue_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      volume, n, lhs, lhs_stride, acc, bias, bias_strides[0], bias_strides[1], epilogue);
+    CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
+  }
+};
+
 /*static*/ void MatMulTask::gpu_variant(TaskContext context)
 {
   matmul_template<VariantKind::GPU>(context);
@@ -18,12 +18,25 @@
 
 #include "cupynumeric/cupynumeric_task.h"
 
+#include <optional>
+
 namespace cupynumeric {
 
+// Parameters of a fused output epilogue, which overwrites the lhs with
+// activation(alpha * rhs1 @ rhs2 + beta * lhs + bias) in the lhs's own type
+struct MatMulEpilogueArgs {
+  double alpha;
+  double beta;
+  CuPyNumericMatMulActivation activation;
+  std::optional<legate::PhysicalStore> bias;
+};
+
 struct MatMulArgs {
   legate::PhysicalStore lhs;
   legate::PhysicalStore rhs1;
   legate::PhysicalStore rhs2;
+  // Without an epilogue, the product is accumulated into an lhs of the accumulation type
+  std::optional<MatMulEpilogueArgs> epilogue{};
 };
 
 class MatMulTask : public CuPyNumericTask<MatMulTask> {
@@ -19,7 +19,9 @@
 #include "cupynumeric/matrix/matmul.h"
 #include "cupynumeric/matrix/matmul_template.inl"
 #include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/scratch_arena.h"
 
+#include <algorithm>
 #include <cblas.h>
 
 namespace cupynumeric {
@@ -27,6 +29,10 @@ namespace cupynumeric {
 using namespace Legion;
 using namespace legate;
 
+// Staging budget and minimum panel depth for the half-precision GEMM below
+static constexpr size_t HALF_GEMM_PANEL_BYTES = size_t{8} << 20;
+static constexpr size_t HALF_GEMM_MIN_PANEL   = 256;
+
 template <VariantKind KIND>
 struct MatMulImplBody<KIND, Type::Code::FLOAT32> {
   void operator()(size_t m,
@@ -107,35 +113,47 @@ struct MatMulImplBody<KIND, Type::Code::FLOAT16> {
                   bool rhs2_transposed,
                   bool lhs_overwritable)
   {
-    auto rhs1_copy = allocate_buffer(m * k);
-    auto rhs2_copy = allocate_buffer(k * n);
+    // BLAS has no half-precision GEMM, so the operands are widened to single precision one panel
+    // of the contracted dimension at a time. Each panel is consumed by a rank-kc update right
+    // after it is converted, which bounds the staging memory by kc * (m + n) floats rather than
+    // k * (m + n) and keeps the converted panels warm in cache.
+    const size_t kc = std::min(
+      k, std::max(HALF_GEMM_MIN_PANEL, HALF_GEMM_PANEL_BYTES / (sizeof(float) * (m + n))));
+    ScratchBuffer<float> rhs1_buffer(m * kc);
+    ScratchBuffer<float> rhs2_buffer(kc * n);
+    auto rhs1_copy = rhs1_buffer.ptr();
+    auto rhs2_copy = rhs2_buffer.ptr();
 
-    if (rhs1_transposed) {
-      half_matrix_to_float(rhs1_copy, rhs1, k, m, rhs1_stride);
-    } else {
-      half_matrix_to_float(rhs1_copy, rhs1, m, k, rhs1_stride);
-    }
+    for (size_t k0 = 0; k0 < k; k0 += kc) {
+      const size_t width = std::min(kc, k - k0);
 
-    if (rhs2_transposed) {
-      half_matrix_to_float(rhs2_copy, rhs2, n, k, rhs2_stride);
-    } else {
-      half_matrix_to_float(rhs2_copy, rhs2, k, n, rhs2_stride);
-    }
+      if (rhs1_transposed) {
+        half_matrix_to_float(rhs1_copy, rhs1 + k0 * rhs1_stride, width, m, rhs1_stride);
+      } else {
+        half_matrix_to_float(rhs1_copy, rhs1 + k0, m, width, rhs1_stride);
+      }
 
-    cblas_sgemm(CblasRowMajor,
-                rhs1_transposed ? CblasTrans : CblasNoTrans,
-                rhs2_transposed ? CblasTrans : CblasNoTrans,
-                m,
-                n,
-                k,
-                1,
-                rhs1_copy,
-                rhs1_transposed ? m : k,
-                rhs2_copy,
-                rhs2_transposed ? k : n,
-                lhs_overwritable ? 0 : 1,
-                lhs,
-                lhs_stride);
+      if (rhs2_transposed) {
+        half_matrix_to_float(rhs2_copy, rhs2 + k0, n, width, rhs2_stride);
+      } else {
+        half_matrix_to_float(rhs2_copy, rhs2 + k0 * rhs2_stride, width, n, rhs2_stride);
+      }
+
+      cblas_sgemm(CblasRowMajor,
+                  rhs1_transposed ? CblasTrans : CblasNoTrans,
+                  rhs2_transposed ? CblasTrans : CblasNoTrans,
+                  m,
+                  n,
+                  width,
+                  1,
+                  rhs1_copy,
+                  rhs1_transposed ? m : width,
+                  rhs2_copy,
+                  rhs2_transposed ? width : n,
+                  (k0 == 0 && lhs_overwritable) ? 0 : 1,
+                  lhs,
+                  lhs_stride);
+    }
   }
 };
 
@@ -215,4 +233,31 @@ struct MatMulImplBody<KIND, Type::Code::COMPLEX128> {
   }
 };
 
+template <VariantKind KIND, Type::Code CODE>
+struct MatMulEpilogueBody {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+  void operator()(size_t m,
+                  size_t n,
+                  VAL* lhs,
+                  size_t lhs_stride,
+                  const ACC* acc,
+                  const VAL* bias,
+                  const size_t bias_strides[2],
+                  const MatMulEpilogue<CODE>& epilogue)
+  {
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+#pragma omp parallel for schedule(static) if (KIND == VariantKind::OMP)
+#endif
+    for (size_t i = 0; i < m; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        epilogue(lhs + i * lhs_stride + j,
+                 acc[i * n + j],
+                 bias == nullptr ? nullptr : bias + i * bias_strides[0] + j * bias_strides[1]);
+      }
+    }
+  }
+};
+
 }  // namespace cupynumeric
@@ -19,6 +19,9 @@
 // Useful for IDEs
 #include "cupynumeric/matrix/matmul.h"
 #include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/perf_counters.h"
+
+#include <type_traits>
 
 namespace cupynumeric {
 
@@ -50,6 +53,37 @@ struct support_matmul<Type::Code::COMPLEX128> : std::true_type {
   using ACC_TYPE = complex<double>;
 };
 
+// Computes the value an epilogue writes to one element of the lhs from the accumulated product
+template <Type::Code CODE>
+struct MatMulEpilogue {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+  ACC alpha;
+  ACC beta;
+  bool relu;
+
+  __CUDA_HD__ void operator()(VAL* out, ACC value, const VAL* bias) const
+  {
+    value = alpha * value;
+    if (beta != ACC{0}) {
+      value += beta * static_cast<ACC>(*out);
+    }
+    if (bias != nullptr) {
+      value += static_cast<ACC>(*bias);
+    }
+    if constexpr (!legate::is_complex<CODE>::value) {
+      if (relu && value < ACC{0}) {
+        value = ACC{0};
+      }
+    }
+    *out = static_cast<VAL>(value);
+  }
+};
+
+template <VariantKind KIND, Type::Code CODE>
+struct MatMulEpilogueBody;
+
 template <VariantKind KIND>
 struct MatMulImpl {
   template <Type::Code CODE, std::enable_if_t<support_matmul<CODE>::value>* = nullptr>
@@ -82,12 +116,10 @@ struct MatMulImpl {
 
     auto rhs1 = args.rhs1.read_accessor<VAL, 2>(shape_rhs1).ptr(shape_rhs1, strides_rhs1);
     auto rhs2 = args.rhs2.read_accessor<VAL, 2>(shape_rhs2).ptr(shape_rhs2, strides_rhs2);
-    auto lhs  = args.lhs.read_write_accessor<ACC, 2>(shape_lhs).ptr(shape_lhs, strides_lhs);
 
 #ifdef DEBUG_CUPYNUMERIC
     assert(strides_rhs1[0] == 1 || strides_rhs1[1] == 1);
     assert(strides_rhs2[0] == 1 || strides_rhs2[1] == 1);
-    assert(strides_lhs[1] == 1);
 #endif
 
     bool transposed_rhs1;
@@ -95,6 +127,77 @@ struct MatMulImpl {
     size_t stride_rhs1 = stride_for_blas(m, k, strides_rhs1[0], strides_rhs1[1], transposed_rhs1);
     size_t stride_rhs2 = stride_for_blas(k, n, strides_rhs2[0], strides_rhs2[1], transposed_rhs2);
 
+    if (args.epilogue.has_value()) {
+      // The product is formed in a private tile of the accumulation type and written out through
+      // the epilogue, so that e.g. half-precision results need no separate conversion pass
+      const auto& epilogue_args = *args.epilogue;
+      auto lhs = epilogue_args.beta != 0.0
+                   ? args.lhs.read_write_accessor<VAL, 2>(shape_lhs).ptr(shape_lhs, strides_lhs)
+                   : args.lhs.write_accessor<VAL, 2>(shape_lhs).ptr(shape_lhs, strides_lhs);
+      const VAL* bias = nullptr;
+      size_t strides_bias[2] = {0, 0};
+      if (epilogue_args.bias.has_value()) {
+        bias = epilogue_args.bias->read_accessor<VAL, 2>(shape_lhs).ptr(shape_lhs, strides_bias);
+      }
+#ifdef DEBUG_CUPYNUMERIC
+      assert(strides_lhs[1] == 1);
+      assert(!legate::is_complex<CODE>::value ||
+             epilogue_args.activation == CUPYNUMERIC_MATMUL_ACTIVATION_NONE);
+#endif
+
+      // Without anything to apply, a product of the output type is written out directly
+      if constexpr (std::is_same_v<VAL, ACC>) {
+        if (epilogue_args.alpha == 1.0 && epilogue_args.beta == 0.0 && bias == nullptr &&
+            epilogue_args.activation == CUPYNUMERIC_MATMUL_ACTIVATION_NONE) {
+          MatMulImplBody<KIND, CODE>()(m,
+                                       n,
+                                       k,
+                                       lhs,
+                                       rhs1,
+                                       rhs2,
+                                       strides_lhs[0],
+                                       stride_rhs1,
+                                       stride_rhs2,
+                                       transposed_rhs1,
+                                       transposed_rhs2,
+                                       true);
+          return;
+        }
+      }
+
+      auto acc = create_buffer<ACC>(m * n);
+      MatMulImplBody<KIND, CODE>()(m,
+                                   n,
+                                   k,
+                                   acc.ptr(0),
+                                   rhs1,
+                                   rhs2,
+                                   n,
+                                   stride_rhs1,
+                                   stride_rhs2,
+                                   transposed_rhs1,
+                                   transposed_rhs2,
+                                   true);
+
+      MatMulEpilogue<CODE> epilogue{
+        static_cast<ACC>(epilogue_args.alpha),
+        static_cast<ACC>(epilogue_args.beta),
+        epilogue_args.activation == CUPYNUMERIC_MATMUL_ACTIVATION_RELU};
+      MatMulEpilogueBody<KIND, CODE>()(
+        m, n, lhs, strides_lhs[0], acc.ptr(0), bias, strides_bias, epilogue);
+      return;
+    }
+
+    // Replicated launches hand each task a private partial of the lhs to accumulate into
+    auto lhs = args.lhs.is_readable()
+                 ? args.lhs.read_write_accessor<ACC, 2>(shape_lhs).ptr(shape_lhs, strides_lhs)
+                 : args.lhs.reduce_accessor<SumReduction<ACC>, true, 2>(shape_lhs).ptr(
+                     shape_lhs, strides_lhs);
+
+#ifdef DEBUG_CUPYNUMERIC
+    assert(strides_lhs[1] == 1);
+#endif
+
     MatMulImplBody<KIND, CODE>()(m,
                                  n,
                                  k,
@@ -116,13 +219,37 @@ struct MatMulImpl {
   }
 };
 
+static MatMulArgs unpack_matmul_args(TaskContext& context)
+{
+  auto outputs    = context.outputs();
+  auto inputs     = context.inputs();
+  auto reductions = context.reductions();
+
+  if (context.num_scalars() > 0) {
+    // A fused epilogue writes the lhs as a plain output, which is also passed as the first input
+    // when it is scaled into the result; an optional bias follows the operands
+    MatMulEpilogueArgs epilogue{
+      context.scalar(0).value<double>(),
+      context.scalar(1).value<double>(),
+      static_cast<CuPyNumericMatMulActivation>(context.scalar(2).value<int32_t>()),
+      std::nullopt};
+    const size_t first = epilogue.beta != 0.0 ? 1 : 0;
+    if (inputs.size() > first + 2) {
+      epilogue.bias = inputs[first + 2];
+    }
+    return MatMulArgs{outputs[0], inputs[first], inputs[first + 1], std::move(epilogue)};
+  }
+  // The lhs is either passed as an output and an input, or as a sum reduction when the
+  // contraction is split across replicas of the result
+  return reductions.empty() ? MatMulArgs{outputs[0], inputs[1], inputs[2]}
+                            : MatMulArgs{reductions[0], inputs[0], inputs[1]};
+}
+
 template <VariantKind KIND>
 static void matmul_template(TaskContext& context)
 {
-  auto outputs = context.outputs();
-  auto inputs  = context.inputs();
-
-  MatMulArgs args{outputs[0], inputs[1], inputs[2]};
+  PerfScope perf{context, CUPYNUMERIC_MATMUL, KIND};
+  auto args = unpack_matmul_args(context);
   // Note that we can't dispatch on the lhs's type,
   // as the lhs can have a different type than the rhs'
   type_dispatch(args.rhs1.code(), MatMulImpl<KIND>{}, args);
@@ -21,6 +21,56 @@
 
 namespace cupynumeric {
 
+template <typename VAL, typename ACC>
+__global__ static void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  strided_matvecmul_kernel(size_t m,
+                           size_t n,
+                           ACC* lhs,
+                           const VAL* mat,
+                           const VAL* vec,
+                           size_t row_stride,
+                           size_t col_stride,
+                           size_t vec_stride,
+                           size_t lhs_stride,
+                           bool lhs_overwritable)
+{
+  const size_t row = global_tid_1d();
+  if (row >= m) {
+    return;
+  }
+  ACC acc{0};
+  for (size_t col = 0; col < n; ++col) {
+    acc += static_cast<ACC>(mat[row * row_stride + col * col_stride]) *
+           static_cast<ACC>(vec[col * vec_stride]);
+  }
+  auto& out = lhs[row * lhs_stride];
+  out       = lhs_overwritable ? acc : out + acc;
+}
+
+template <Type::Code CODE>
+struct MatVecMulStridedImplBody<VariantKind::GPU, CODE> {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matvecmul<CODE>::ACC_TYPE;
+
+  void operator()(size_t m,
+                  size_t n,
+                  ACC* lhs,
+                  const VAL* mat,
+                  const VAL* vec,
+                  size_t row_stride,
+                  size_t col_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
+                  bool lhs_overwritable)
+  {
+    auto stream         = get_cached_stream();
+    const size_t blocks = (m + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    strided_matvecmul_kernel<VAL, ACC><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      m, n, lhs, mat, vec, row_stride, col_stride, vec_stride, lhs_stride, lhs_overwritable);
+    CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
+  }
+};
+
 template <>
 struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT32> {
   void operator()(size_t m,
@@ -29,6 +79,8 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT32> {
                   const float* mat,
                   const float* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -45,30 +97,42 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT32> {
     // XXX: There is a bug in older versions of cuBLAS that are triggered
     //      by some degenerate matrix-vector multiplications. We simply use
     //      matrix-matrix multiplication all the time unless we're on a recent
-    //      cuBLAS version
+    //      cuBLAS version. The product is formed as the row vector x^T op(A)^T,
+    //      so that the strides of x and y become leading dimensions.
     int32_t version;
     CHECK_CUBLAS(cublasGetVersion(cublas_handle, &version));
     if (version >= 11700) {
       CHECK_CUBLAS(
-        cublasSgemv(cublas_handle, trans, n, m, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1));
+        cublasSgemv(cublas_handle,
+                    trans,
+                    n,
+                    m,
+                    &alpha,
+                    mat,
+                    mat_stride,
+                    vec,
+                    vec_stride,
+                    &beta,
+                    lhs,
+                    lhs_stride));
     } else {
       CHECK_CUBLAS(cublasSgemmEx(cublas_handle,
-                                 trans,
                                  CUBLAS_OP_N,
-                                 transpose_mat ? n : m,
+                                 transpose_mat ? CUBLAS_OP_T : CUBLAS_OP_N,
                                  1,
+                                 transpose_mat ? n : m,
                                  transpose_mat ? m : n,
                                  &alpha,
+                                 vec,
+                                 CUDA_R_32F,
+                                 vec_stride,
                                  mat,
                                  CUDA_R_32F,
                                  mat_stride,
-                                 vec,
-                                 CUDA_R_32F,
-                                 transpose_mat ? m : n,
                                  &beta,
                                  lhs,
                                  CUDA_R_32F,
-                                 transpose_mat ? n : m));
+                                 lhs_stride));
     }
 
     CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
@@ -83,6 +147,8 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT64> {
                   const double* mat,
                   const double* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -101,22 +167,33 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT64> {
     CHECK_CUBLAS(cublasGetVersion(cublas_handle, &version));
     if (version >= 11700) {
       CHECK_CUBLAS(
-        cublasDgemv(cublas_handle, trans, n, m, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1));
+        cublasDgemv(cublas_handle,
+                    trans,
+                    n,
+                    m,
+                    &alpha,
+                    mat,
+                    mat_stride,
+                    vec,
+                    vec_stride,
+                    &beta,
+                    lhs,
+                    lhs_stride));
     } else {
       CHECK_CUBLAS(cublasDgemm(cublas_handle,
-                               trans,
                                CUBLAS_OP_N,
-                               transpose_mat ? n : m,
+                               transpose_mat ? CUBLAS_OP_T : CUBLAS_OP_N,
                                1,
+                               transpose_mat ? n : m,
                                transpose_mat ? m : n,
                                &alpha,
+                               vec,
+                               vec_stride,
                                mat,
                                mat_stride,
-                               vec,
-                               transpose_mat ? m : n,
                                &beta,
                                lhs,
-                               transpose_mat ? n : m));
+                               lhs_stride));
     }
 
     CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
@@ -131,6 +208,8 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT16> {
                   const __half* mat,
                   const __half* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -141,25 +220,25 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::FLOAT16> {
     const float alpha = 1.0;
     const float beta  = lhs_overwritable ? 0.0 : 1.0;
 
-    auto trans = transpose_mat ? CUBLAS_OP_N : CUBLAS_OP_T;
-    // Use SgemmEx here since there is no half precision gemv yet
+    // Use SgemmEx here since there is no half precision gemv yet. As above, the product is formed
+    // as a row vector so that strided vectors can be passed through leading dimensions.
     CHECK_CUBLAS(cublasSgemmEx(cublas_handle,
-                               trans,
                                CUBLAS_OP_N,
-                               transpose_mat ? n : m,
+                               transpose_mat ? CUBLAS_OP_T : CUBLAS_OP_N,
                                1,
+                               transpose_mat ? n : m,
                                transpose_mat ? m : n,
                                &alpha,
+                               vec,
+                               CUDA_R_16F,
+                               vec_stride,
                                mat,
                                CUDA_R_16F,
                                mat_stride,
-                               vec,
-                               CUDA_R_16F,
-                               transpose_mat ? m : n,
                                &beta,
                                lhs,
                                CUDA_R_32F,
-                               transpose_mat ? n : m));
+                               lhs_stride));
 
     CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
   }
@@ -173,6 +252,8 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::COMPLEX64> {
                   const complex<float>* mat_,
                   const complex<float>* vec_,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -195,25 +276,36 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::COMPLEX64> {
     CHECK_CUBLAS(cublasGetVersion(cublas_handle, &version));
     if (version >= 11700) {
       CHECK_CUBLAS(
-        cublasCgemv(cublas_handle, trans, n, m, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1));
+        cublasCgemv(cublas_handle,
+                    trans,
+                    n,
+                    m,
+                    &alpha,
+                    mat,
+                    mat_stride,
+                    vec,
+                    vec_stride,
+                    &beta,
+                    lhs,
+                    lhs_stride));
     } else {
       CHECK_CUBLAS(cublasCgemmEx(cublas_handle,
-                                 trans,
                                  CUBLAS_OP_N,
-                                 transpose_mat ? n : m,
+                                 transpose_mat ? CUBLAS_OP_T : CUBLAS_OP_N,
                                  1,
+                                 transpose_mat ? n : m,
                                  transpose_mat ? m : n,
                                  &alpha,
+                                 vec,
+                                 CUDA_C_32F,
+                                 vec_stride,
                                  mat,
                                  CUDA_C_32F,
                                  mat_stride,
-                                 vec,
-                                 CUDA_C_32F,
-                                 transpose_mat ? m : n,
                                  &beta,
                                  lhs,
                                  CUDA_C_32F,
-                                 transpose_mat ? n : m));
+                                 lhs_stride));
     }
 
     CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
@@ -228,6 +320,8 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::COMPLEX128> {
                   const complex<double>* mat_,
                   const complex<double>* vec_,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -250,22 +344,33 @@ struct MatVecMulImplBody<VariantKind::GPU, Type::Code::COMPLEX128> {
     CHECK_CUBLAS(cublasGetVersion(cublas_handle, &version));
     if (version >= 11700) {
       CHECK_CUBLAS(
-        cublasZgemv(cublas_handle, trans, n, m, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1));
+        cublasZgemv(cublas_handle,
+                    trans,
+                    n,
+                    m,
+                    &alpha,
+                    mat,
+                    mat_stride,
+                    vec,
+                    vec_stride,
+                    &beta,
+                    lhs,
+                    lhs_stride));
     } else {
       CHECK_CUBLAS(cublasZgemm(cublas_handle,
-                               trans,
                                CUBLAS_OP_N,
-                               transpose_mat ? n : m,
+                               transpose_mat ? CUBLAS_OP_T : CUBLAS_OP_N,
                                1,
+                               transpose_mat ? n : m,
                                transpose_mat ? m : n,
                                &alpha,
+                               vec,
+                               vec_stride,
                                mat,
                                mat_stride,
-                               vec,
-                               transpose_mat ? m : n,
                                &beta,
                                lhs,
-                               transpose_mat ? n : m));
+                               lhs_stride));
     }
 
     CUPYNUMERIC_CHECK_CUDA_STREAM(task_stream);
@@ -19,7 +19,9 @@
 #include "cupynumeric/matrix/matvecmul.h"
 #include "cupynumeric/matrix/matvecmul_template.inl"
 #include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/scratch_arena.h"
 
+#include <algorithm>
 #include <cblas.h>
 
 namespace cupynumeric {
@@ -35,13 +37,16 @@ struct MatVecMulImplBody<KIND, Type::Code::FLOAT32> {
                   const float* mat,
                   const float* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
     auto trans = transpose_mat ? CblasTrans : CblasNoTrans;
     // lhs_overwritable being true means that the matvecmul tasks can overwrite the lhs
     float beta = lhs_overwritable ? 0.0 : 1.0;
-    cblas_sgemv(CblasRowMajor, trans, m, n, 1, mat, mat_stride, vec, 1, beta, lhs, 1);
+    cblas_sgemv(
+      CblasRowMajor, trans, m, n, 1, mat, mat_stride, vec, vec_stride, beta, lhs, lhs_stride);
   }
 };
 
@@ -53,12 +58,15 @@ struct MatVecMulImplBody<KIND, Type::Code::FLOAT64> {
                   const double* mat,
                   const double* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
     auto trans  = transpose_mat ? CblasTrans : CblasNoTrans;
     double beta = lhs_overwritable ? 0.0 : 1.0;
-    cblas_dgemv(CblasRowMajor, trans, m, n, 1, mat, mat_stride, vec, 1, beta, lhs, 1);
+    cblas_dgemv(
+      CblasRowMajor, trans, m, n, 1, mat, mat_stride, vec, vec_stride, beta, lhs, lhs_stride);
   }
 };
 
@@ -70,19 +78,29 @@ struct MatVecMulImplBody<KIND, Type::Code::FLOAT16> {
                   const __half* mat,
                   const __half* vec,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
     auto vec_size = transpose_mat ? m : n;
 
-    auto mat_copy = allocate_buffer(m * n);
-    auto vec_copy = allocate_buffer(vec_size);
+    ScratchBuffer<float> mat_buffer(m * n);
+    ScratchBuffer<float> vec_buffer(vec_size);
+    auto mat_copy = mat_buffer.ptr();
+    auto vec_copy = vec_buffer.ptr();
 
     half_matrix_to_float(mat_copy, mat, m, n, mat_stride);
-    half_vector_to_float(vec_copy, vec, vec_size);
+    if (vec_stride == 1) {
+      half_vector_to_float(vec_copy, vec, vec_size);
+    } else {
+      for (size_t idx = 0; idx < vec_size; ++idx) {
+        vec_copy[idx] = vec[idx * vec_stride];
+      }
+    }
 
     MatVecMulImplBody<KIND, Type::Code::FLOAT32>{}(
-      m, n, lhs, mat_copy, vec_copy, n, transpose_mat, lhs_overwritable);
+      m, n, lhs, mat_copy, vec_copy, n, 1, lhs_stride, transpose_mat, lhs_overwritable);
   }
 };
 
@@ -94,6 +112,8 @@ struct MatVecMulImplBody<KIND, Type::Code::COMPLEX64> {
                   const complex<float>* mat_,
                   const complex<float>* vec_,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -104,7 +124,18 @@ struct MatVecMulImplBody<KIND, Type::Code::COMPLEX64> {
     __complex__ float beta       = lhs_overwritable ? 0.0 : 1.0;
 
     auto trans = transpose_mat ? CblasTrans : CblasNoTrans;
-    cblas_cgemv(CblasRowMajor, trans, m, n, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1);
+    cblas_cgemv(CblasRowMajor,
+                trans,
+                m,
+                n,
+                &alpha,
+                mat,
+                mat_stride,
+                vec,
+                vec_stride,
+                &beta,
+                lhs,
+                lhs_stride);
   }
 };
 
@@ -116,6 +147,8 @@ struct MatVecMulImplBody<KIND, Type::Code::COMPLEX128> {
                   const complex<double>* mat_,
                   const complex<double>* vec_,
                   size_t mat_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
                   bool transpose_mat,
                   bool lhs_overwritable)
   {
@@ -126,7 +159,75 @@ struct MatVecMulImplBody<KIND, Type::Code::COMPLEX128> {
     __complex__ double beta       = lhs_overwritable ? 0.0 : 1.0;
 
     auto trans = transpose_mat ? CblasTrans : CblasNoTrans;
-    cblas_zgemv(CblasRowMajor, trans, m, n, &alpha, mat, mat_stride, vec, 1, &beta, lhs, 1);
+    cblas_zgemv(CblasRowMajor,
+                trans,
+                m,
+                n,
+                &alpha,
+                mat,
+                mat_stride,
+                vec,
+                vec_stride,
+                &beta,
+                lhs,
+                lhs_stride);
+  }
+};
+
+// Rows are processed in blocks, each of which is accumulated in registers while the columns are
+// swept along whichever matrix stride is shorter, so consecutive loads stay close in memory.
+static constexpr size_t STRIDED_GEMV_BLOCK = 64;
+
+template <VariantKind KIND, Type::Code CODE>
+struct MatVecMulStridedImplBody {
+  using VAL = type_of<CODE>;
+  using ACC = typename support_matvecmul<CODE>::ACC_TYPE;
+
+  void operator()(size_t m,
+                  size_t n,
+                  ACC* lhs,
+                  const VAL* mat,
+                  const VAL* vec,
+                  size_t row_stride,
+                  size_t col_stride,
+                  size_t vec_stride,
+                  size_t lhs_stride,
+                  bool lhs_overwritable)
+  {
+    const size_t blocks = (m + STRIDED_GEMV_BLOCK - 1) / STRIDED_GEMV_BLOCK;
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP)
+#pragma omp parallel for schedule(static) if (KIND == VariantKind::OMP)
+#endif
+    for (size_t block = 0; block < blocks; ++block) {
+      const size_t lo = block * STRIDED_GEMV_BLOCK;
+      const size_t hi = std::min(m, lo + STRIDED_GEMV_BLOCK);
+      ACC acc[STRIDED_GEMV_BLOCK];
+      for (size_t i = lo; i < hi; ++i) {
+        acc[i - lo] = ACC{0};
+      }
+
+      if (row_stride < col_stride) {
+        for (size_t j = 0; j < n; ++j) {
+          const ACC x = static_cast<ACC>(vec[j * vec_stride]);
+          for (size_t i = lo; i < hi; ++i) {
+            acc[i - lo] += static_cast<ACC>(mat[i * row_stride + j * col_stride]) * x;
+          }
+        }
+      } else {
+        for (size_t i = lo; i < hi; ++i) {
+          for (size_t j = 0; j < n; ++j) {
+            acc[i - lo] +=
+              static_cast<ACC>(mat[i * row_stride + j * col_stride]) *
+              static_cast<ACC>(vec[j * vec_stride]);
+          }
+        }
+      }
+
+      for (size_t i = lo; i < hi; ++i) {
+        auto& out = lhs[i * lhs_stride];
+        out       = lhs_overwritable ? acc[i - lo] : out + acc[i - lo];
+      }
+    }
   }
 };
 
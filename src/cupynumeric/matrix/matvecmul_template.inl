@@ -19,6 +19,9 @@
 // Useful for IDEs
 #include "cupynumeric/matrix/matvecmul.h"
 #include "cupynumeric/matrix/util.h"
+#include "cupynumeric/utilities/perf_counters.h"
+
+#include <algorithm>
 
 namespace cupynumeric {
 
@@ -50,47 +53,112 @@ struct support_matvecmul<Type::Code::COMPLEX128> : std::true_type {
   using ACC_TYPE = complex<double>;
 };
 
+// Fallback for matrices without a unit stride in either dimension, which BLAS cannot consume
+template <VariantKind KIND, Type::Code CODE>
+struct MatVecMulStridedImplBody;
+
 template <VariantKind KIND>
 struct MatVecMulImpl {
-  template <Type::Code CODE, std::enable_if_t<support_matvecmul<CODE>::value>* = nullptr>
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<support_matvecmul<CODE>::value && (DIM >= 2)>* = nullptr>
   void operator()(MatVecMulArgs& args) const
   {
     using VAL = type_of<CODE>;
     using ACC = typename support_matvecmul<CODE>::ACC_TYPE;
 
-    auto shape = args.rhs1.shape<2>().intersection(args.rhs2.shape<2>());
+    auto shape = args.rhs1.shape<DIM>().intersection(args.rhs2.shape<DIM>());
 
     if (shape.empty()) {
       return;
     }
 
-    auto m = static_cast<size_t>(shape.hi[0] - shape.lo[0] + 1);
-    auto n = static_cast<size_t>(shape.hi[1] - shape.lo[1] + 1);
-
-    size_t mat_strides[2];
-    size_t vec_strides[2];
-    const VAL* mat = args.rhs1.read_accessor<VAL, 2>(shape).ptr(shape, mat_strides);
-    const VAL* vec = args.rhs2.read_accessor<VAL, 2>(shape).ptr(shape, vec_strides);
-
-    bool transpose_mat;
-    size_t mat_stride = stride_for_blas(m, n, mat_strides[0], mat_strides[1], transpose_mat);
-    if (transpose_mat) {
-      std::swap(m, n);
-    }
+    // The last two dimensions hold the matrix; any leading ones index independent products
+    auto m = static_cast<size_t>(shape.hi[DIM - 2] - shape.lo[DIM - 2] + 1);
+    auto n = static_cast<size_t>(shape.hi[DIM - 1] - shape.lo[DIM - 1] + 1);
 
-    size_t lhs_strides[2];
-    auto lhs = args.lhs.reduce_accessor<SumReduction<ACC>, true, 2>().ptr(shape, lhs_strides);
+    size_t mat_strides[DIM];
+    size_t vec_strides[DIM];
+    size_t lhs_strides[DIM];
+    const VAL* mat = args.rhs1.read_accessor<VAL, DIM>(shape).ptr(shape, mat_strides);
+    const VAL* vec = args.rhs2.read_accessor<VAL, DIM>(shape).ptr(shape, vec_strides);
+    auto lhs = args.lhs.reduce_accessor<SumReduction<ACC>, true, DIM>().ptr(shape, lhs_strides);
 
 #ifdef DEBUG_CUPYNUMERIC
-    assert(vec_strides[0] == 0 && vec_strides[1] == 1);
-    assert(lhs_strides[0] == 1 && lhs_strides[1] == 0);
+    assert(vec_strides[DIM - 2] == 0);
+    assert(lhs_strides[DIM - 1] == 0);
 #endif
 
-    MatVecMulImplBody<KIND, CODE>()(
-      m, n, lhs, mat, vec, mat_stride, transpose_mat, args.lhs.is_readable());
+    // The vector and the output can be views with any stride, which BLAS takes as increments. A
+    // stride is only meaningless (and possibly zero) when the extent is 1.
+    auto vec_stride = std::max<size_t>(vec_strides[DIM - 1], 1);
+    auto lhs_stride = std::max<size_t>(lhs_strides[DIM - 2], 1);
+
+    auto row_stride = mat_strides[DIM - 2];
+    auto col_stride = mat_strides[DIM - 1];
+    bool blas_compatible = m == 1 || n == 1 || row_stride == 1 || col_stride == 1;
+    bool transpose_mat   = false;
+    size_t mat_stride    = 0;
+    size_t blas_m        = m;
+    size_t blas_n        = n;
+    // Matrices without a unit stride take the strided kernel instead of BLAS
+    PerfScope::note_dense(blas_compatible);
+    if (blas_compatible) {
+      mat_stride = stride_for_blas(m, n, row_stride, col_stride, transpose_mat);
+      if (transpose_mat) {
+        std::swap(blas_m, blas_n);
+      }
+    }
+
+    size_t batches = 1;
+    for (int dim = 0; dim < DIM - 2; ++dim) {
+      batches *= static_cast<size_t>(shape.hi[dim] - shape.lo[dim] + 1);
+    }
+
+    bool lhs_overwritable = args.lhs.is_readable();
+    for (size_t batch = 0; batch < batches; ++batch) {
+      size_t mat_offset = 0;
+      size_t vec_offset = 0;
+      size_t lhs_offset = 0;
+      size_t remainder  = batch;
+      for (int dim = DIM - 3; dim >= 0; --dim) {
+        auto extent = static_cast<size_t>(shape.hi[dim] - shape.lo[dim] + 1);
+        auto idx    = remainder % extent;
+        remainder /= extent;
+        mat_offset += idx * mat_strides[dim];
+        vec_offset += idx * vec_strides[dim];
+        lhs_offset += idx * lhs_strides[dim];
+      }
+
+      if (blas_compatible) {
+        MatVecMulImplBody<KIND, CODE>()(blas_m,
+                                        blas_n,
+                                        lhs + lhs_offset,
+                                        mat + mat_offset,
+                                        vec + vec_offset,
+                                        mat_stride,
+                                        vec_stride,
+                                        lhs_stride,
+                                        transpose_mat,
+                                        lhs_overwritable);
+      } else {
+        MatVecMulStridedImplBody<KIND, CODE>()(m,
+                                               n,
+                                               lhs + lhs_offset,
+                                               mat + mat_offset,
+                                               vec + vec_offset,
+                                               row_stride,
+                                               col_stride,
+                                               vec_stride,
+                                               lhs_stride,
+                                               lhs_overwritable);
+      }
+    }
   }
 
-  template <Type::Code CODE, std::enable_if_t<!support_matvecmul<CODE>::value>* = nullptr>
+  template <Type::Code CODE,
+            int DIM,
+            std::enable_if_t<!support_matvecmul<CODE>::value || (DIM < 2)>* = nullptr>
   void operator()(MatVecMulArgs& args) const
   {
     assert(false);
@@ -100,13 +168,14 @@ struct MatVecMulImpl {
 template <VariantKind KIND>
 static void matvecmul_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_MATVECMUL, KIND};
   auto reductions = context.reductions();
   auto inputs     = context.inputs();
 
   MatVecMulArgs args{reductions[0], inputs[0], inputs[1]};
   // Note that we can't dispatch on the lhs's type,
   // as the lhs can have a different type than the rhs'
-  type_dispatch(args.rhs1.code(), MatVecMulImpl<KIND>{}, args);
+  double_dispatch(args.rhs1.dim(), args.rhs1.code(), MatVecMulImpl<KIND>{}, args);
 }
 
 }  // namespace cupynumeric
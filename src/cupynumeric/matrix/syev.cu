@@ -0,0 +1,183 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/matrix/syev.h"
+#include "cupynumeric/matrix/syev_template.inl"
+
+#include "cupynumeric/cuda_help.h"
+#include <vector>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// cuSOLVER sees the row major input as its (conjugate) transpose; see the
+// comment on syev_fixup_eigenvectors in syev_cpu.inl
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  syev_fixup_eigenvectors_kernel(VAL* v, int32_t n, size_t volume)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) {
+    return;
+  }
+  const auto r = static_cast<int32_t>(idx / n);
+  const auto c = static_cast<int32_t>(idx % n);
+  if (r > c) {
+    return;
+  }
+
+  if constexpr (legate::is_complex_type<VAL>::value) {
+    auto upper = v[r * n + c];
+    auto lower = v[c * n + r];
+    if (r == c) {
+      v[r * n + c] = VAL{upper.real(), -upper.imag()};
+    } else {
+      v[r * n + c] = VAL{lower.real(), -lower.imag()};
+      v[c * n + r] = VAL{upper.real(), -upper.imag()};
+    }
+  } else if (r != c) {
+    auto upper   = v[r * n + c];
+    v[r * n + c] = v[c * n + r];
+    v[c * n + r] = upper;
+  }
+}
+
+template <typename VAL, typename DataType>
+static inline void syev_template(DataType valTypeC,
+                                 DataType valTypeR,
+                                 int32_t n,
+                                 bool lower,
+                                 const VAL* a,
+                                 void* w,
+                                 VAL* v,
+                                 VAL* scratch)
+{
+  auto handle = get_cusolver();
+  auto stream = get_cached_stream();
+
+  // cuSOLVER overwrites its input with the eigenvectors, so we work in the
+  // output when we have one and in the caller's scratch buffer otherwise
+  VAL* work_a = v == nullptr ? scratch : v;
+  CUPYNUMERIC_CHECK_CUDA(
+    cudaMemcpyAsync(work_a, a, sizeof(VAL) * n * n, cudaMemcpyDeviceToDevice, stream));
+
+  CHECK_CUSOLVER(cusolverDnSetStream(handle, stream));
+
+  auto jobz = v == nullptr ? CUSOLVER_EIG_MODE_NOVECTOR : CUSOLVER_EIG_MODE_VECTOR;
+  auto uplo = lower ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER;
+
+  size_t lwork_device, lwork_host;
+  CHECK_CUSOLVER(cusolverDnXsyevd_bufferSize(handle,
+                                             nullptr,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             valTypeC,
+                                             reinterpret_cast<void*>(work_a),
+                                             n,
+                                             valTypeR,
+                                             w,
+                                             valTypeC,
+                                             &lwork_device,
+                                             &lwork_host));
+
+  auto buffer = create_buffer<char>(lwork_device, Memory::Kind::GPU_FB_MEM);
+  std::vector<char> buffer_host(std::max(1ul, lwork_host));
+  auto info = create_buffer<int32_t>(1, Memory::Kind::Z_COPY_MEM);
+
+  CHECK_CUSOLVER(cusolverDnXsyevd(handle,
+                                  nullptr,
+                                  jobz,
+                                  uplo,
+                                  n,
+                                  valTypeC,
+                                  reinterpret_cast<void*>(work_a),
+                                  n,
+                                  valTypeR,
+                                  w,
+                                  valTypeC,
+                                  buffer.ptr(0),
+                                  lwork_device,
+                                  buffer_host.data(),
+                                  lwork_host,
+                                  info.ptr(0)));
+
+  CUPYNUMERIC_CHECK_CUDA(cudaStreamSynchronize(stream));
+
+  if (info[0] != 0) {
+    throw legate::TaskException(SyevTask::ERROR_MESSAGE);
+  }
+
+  if (v != nullptr) {
+    const size_t volume = static_cast<size_t>(n) * n;
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    syev_fixup_eigenvectors_kernel<VAL><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(v, n, volume);
+  }
+
+  CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
+}
+
+template <>
+struct SyevImplBody<VariantKind::GPU, Type::Code::FLOAT32> {
+  void operator()(
+    int32_t n, bool lower, const float* a, float* w, float* v, float* scratch)
+  {
+    syev_template<float>(CUDA_R_32F, CUDA_R_32F, n, lower, a, w, v, scratch);
+  }
+};
+
+template <>
+struct SyevImplBody<VariantKind::GPU, Type::Code::FLOAT64> {
+  void operator()(
+    int32_t n, bool lower, const double* a, double* w, double* v, double* scratch)
+  {
+    syev_template<double>(CUDA_R_64F, CUDA_R_64F, n, lower, a, w, v, scratch);
+  }
+};
+
+template <>
+struct SyevImplBody<VariantKind::GPU, Type::Code::COMPLEX64> {
+  void operator()(int32_t n,
+                  bool lower,
+                  const complex<float>* a,
+                  float* w,
+                  complex<float>* v,
+                  complex<float>* scratch)
+  {
+    syev_template<complex<float>>(CUDA_C_32F, CUDA_R_32F, n, lower, a, w, v, scratch);
+  }
+};
+
+template <>
+struct SyevImplBody<VariantKind::GPU, Type::Code::COMPLEX128> {
+  void operator()(int32_t n,
+                  bool lower,
+                  const complex<double>* a,
+                  double* w,
+                  complex<double>* v,
+                  complex<double>* scratch)
+  {
+    syev_template<complex<double>>(CUDA_C_64F, CUDA_R_64F, n, lower, a, w, v, scratch);
+  }
+};
+
+/*static*/ void SyevTask::gpu_variant(TaskContext context)
+{
+  syev_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cupynumeric
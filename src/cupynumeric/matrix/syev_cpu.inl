@@ -0,0 +1,181 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cblas.h>
+#include <lapack.h>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// LAPACK sees the row major input as its (conjugate) transpose, so the triangle
+// requested by the caller is the opposite one from LAPACK's point of view, and
+// the eigenvectors it produces come back as the conjugate of the columns we
+// want. This turns the column major result into row major columns in place.
+template <typename VAL>
+static inline void syev_fixup_eigenvectors(VAL* v, int32_t n)
+{
+  for (int32_t i = 0; i < n; ++i) {
+    for (int32_t j = i + 1; j < n; ++j) {
+      std::swap(v[i * n + j], v[j * n + i]);
+    }
+  }
+  if constexpr (legate::is_complex_type<VAL>::value) {
+    const int64_t size = static_cast<int64_t>(n) * n;
+    for (int64_t idx = 0; idx < size; ++idx) {
+      v[idx] = VAL{v[idx].real(), -v[idx].imag()};
+    }
+  }
+}
+
+// LAPACK overwrites its input with the eigenvectors, so we work in the output
+// when we have one and in the caller's scratch buffer otherwise
+template <typename VAL>
+static inline VAL* syev_copy_input(int32_t n, const VAL* a, VAL* v, VAL* scratch)
+{
+  VAL* work_a = v == nullptr ? scratch : v;
+  std::memcpy(work_a, a, sizeof(VAL) * n * n);
+  return work_a;
+}
+
+template <typename Syevd, typename VAL>
+static inline void syev_template(
+  Syevd syevd, int32_t n, bool lower, const VAL* a, VAL* w, VAL* v, VAL* scratch)
+{
+  VAL* work_a      = syev_copy_input(n, a, v, scratch);
+  const char* jobz = v == nullptr ? "N" : "V";
+  const char* uplo = lower ? "U" : "L";
+
+  int32_t info   = 0;
+  int32_t lwork  = -1;
+  int32_t liwork = -1;
+  VAL wkopt      = 0;
+  int32_t iwkopt = 0;
+  syevd(jobz, uplo, &n, work_a, &n, w, &wkopt, &lwork, &iwkopt, &liwork, &info);
+  lwork  = static_cast<int32_t>(wkopt);
+  liwork = iwkopt;
+
+  std::vector<VAL> work(std::max(1, lwork));
+  std::vector<int32_t> iwork(std::max(1, liwork));
+  syevd(jobz, uplo, &n, work_a, &n, w, work.data(), &lwork, iwork.data(), &liwork, &info);
+
+  if (info != 0) {
+    throw legate::TaskException(SyevTask::ERROR_MESSAGE);
+  }
+
+  if (v != nullptr) {
+    syev_fixup_eigenvectors(v, n);
+  }
+}
+
+template <typename Heevd, typename VAL, typename VAL_REAL>
+static inline void heev_template(
+  Heevd heevd, int32_t n, bool lower, const VAL* a, VAL_REAL* w, VAL* v, VAL* scratch)
+{
+  using LAPACK_VAL = __complex__ VAL_REAL;
+
+  auto work_a      = reinterpret_cast<LAPACK_VAL*>(syev_copy_input(n, a, v, scratch));
+  const char* jobz = v == nullptr ? "N" : "V";
+  const char* uplo = lower ? "U" : "L";
+
+  int32_t info     = 0;
+  int32_t lwork    = -1;
+  int32_t lrwork   = -1;
+  int32_t liwork   = -1;
+  LAPACK_VAL wkopt = 0;
+  VAL_REAL rwkopt  = 0;
+  int32_t iwkopt   = 0;
+  heevd(jobz, uplo, &n, work_a, &n, w, &wkopt, &lwork, &rwkopt, &lrwork, &iwkopt, &liwork, &info);
+  lwork  = static_cast<int32_t>(*reinterpret_cast<VAL_REAL*>(&wkopt));
+  lrwork = static_cast<int32_t>(rwkopt);
+  liwork = iwkopt;
+
+  std::vector<LAPACK_VAL> work(std::max(1, lwork));
+  std::vector<VAL_REAL> rwork(std::max(1, lrwork));
+  std::vector<int32_t> iwork(std::max(1, liwork));
+  heevd(jobz,
+        uplo,
+        &n,
+        work_a,
+        &n,
+        w,
+        work.data(),
+        &lwork,
+        rwork.data(),
+        &lrwork,
+        iwork.data(),
+        &liwork,
+        &info);
+
+  if (info != 0) {
+    throw legate::TaskException(SyevTask::ERROR_MESSAGE);
+  }
+
+  if (v != nullptr) {
+    syev_fixup_eigenvectors(v, n);
+  }
+}
+
+template <VariantKind KIND>
+struct SyevImplBody<KIND, Type::Code::FLOAT32> {
+  void operator()(
+    int32_t n, bool lower, const float* a, float* w, float* v, float* scratch)
+  {
+    syev_template(LAPACK_ssyevd, n, lower, a, w, v, scratch);
+  }
+};
+
+template <VariantKind KIND>
+struct SyevImplBody<KIND, Type::Code::FLOAT64> {
+  void operator()(
+    int32_t n, bool lower, const double* a, double* w, double* v, double* scratch)
+  {
+    syev_template(LAPACK_dsyevd, n, lower, a, w, v, scratch);
+  }
+};
+
+template <VariantKind KIND>
+struct SyevImplBody<KIND, Type::Code::COMPLEX64> {
+  void operator()(int32_t n,
+                  bool lower,
+                  const complex<float>* a,
+                  float* w,
+                  complex<float>* v,
+                  complex<float>* scratch)
+  {
+    heev_template(LAPACK_cheevd, n, lower, a, w, v, scratch);
+  }
+};
+
+template <VariantKind KIND>
+struct SyevImplBody<KIND, Type::Code::COMPLEX128> {
+  void operator()(int32_t n,
+                  bool lower,
+                  const complex<double>* a,
+                  double* w,
+                  complex<double>* v,
+                  complex<double>* scratch)
+  {
+    heev_template(LAPACK_zheevd, n, lower, a, w, v, scratch);
+  }
+};
+
+}  // namespace cupynumeric
@@ -0,0 +1,157 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/matrix/syev.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// Computes the eigenvalues (and optionally the eigenvectors) of a single dense
+// n x n matrix stored in row major order. On return, the eigenvectors are the
+// columns of the row major matrix `v`, matching the layout NumPy returns. When
+// `v` is null, the solver works in the n x n `scratch` buffer instead.
+template <VariantKind KIND, Type::Code CODE>
+struct SyevImplBody;
+
+template <Type::Code CODE>
+struct support_syev : std::false_type {};
+template <>
+struct support_syev<Type::Code::FLOAT64> : std::true_type {};
+template <>
+struct support_syev<Type::Code::FLOAT32> : std::true_type {};
+template <>
+struct support_syev<Type::Code::COMPLEX64> : std::true_type {};
+template <>
+struct support_syev<Type::Code::COMPLEX128> : std::true_type {};
+
+template <Type::Code CODE>
+struct syev_real_type {
+  using TYPE = float;
+};
+template <>
+struct syev_real_type<Type::Code::FLOAT64> {
+  using TYPE = double;
+};
+template <>
+struct syev_real_type<Type::Code::COMPLEX128> {
+  using TYPE = double;
+};
+
+template <VariantKind KIND>
+struct SyevImpl {
+  template <Type::Code CODE,
+            int32_t DIM,
+            std::enable_if_t<(DIM >= 2) && support_syev<CODE>::value>* = nullptr>
+  void operator()(SyevArgs& args) const
+  {
+    using VAL      = type_of<CODE>;
+    using VAL_REAL = typename syev_real_type<CODE>::TYPE;
+
+    auto shape = args.a.shape<DIM>();
+    if (shape.empty()) {
+      return;
+    }
+
+    const auto n = static_cast<int32_t>(shape.hi[DIM - 1] - shape.lo[DIM - 1] + 1);
+    if (n != shape.hi[DIM - 2] - shape.lo[DIM - 2] + 1) {
+      throw legate::TaskException("Last 2 dimensions of the array must be square");
+    }
+
+    // Every batch is solved independently, so the mapper hands us row major
+    // instances where each n x n block (and each n-vector of eigenvalues) is
+    // contiguous and the blocks are laid out back to back.
+    // CHANGE: If this code is changed, please make sure all changes
+    // are consistent with those found in mapper.cc.
+    size_t a_strides[DIM];
+    auto a = args.a.read_accessor<VAL, DIM>(shape).ptr(shape, a_strides);
+    if (a_strides[DIM - 2] != static_cast<size_t>(n) || a_strides[DIM - 1] != 1) {
+      throw legate::TaskException(
+        "Bad input accessor in syev, last two dimensions must be non-transformed and "
+        "dense with stride == 1");
+    }
+
+    auto w_shape = args.w.shape<DIM - 1>();
+    size_t w_strides[DIM - 1];
+    auto w = args.w.write_accessor<VAL_REAL, DIM - 1>(w_shape).ptr(w_shape, w_strides);
+    if (w_strides[DIM - 2] != 1) {
+      throw legate::TaskException(
+        "Bad eigenvalue accessor in syev, last dimension must be dense with stride == 1");
+    }
+
+    VAL* v = nullptr;
+    if (args.compute_vectors) {
+      size_t v_strides[DIM];
+      v = args.v.write_accessor<VAL, DIM>(shape).ptr(shape, v_strides);
+      if (v_strides[DIM - 2] != static_cast<size_t>(n) || v_strides[DIM - 1] != 1) {
+        throw legate::TaskException(
+          "Bad eigenvector accessor in syev, last two dimensions must be non-transformed and "
+          "dense with stride == 1");
+      }
+    }
+
+    int64_t num_batches = 1;
+    for (int32_t dim = 0; dim < DIM - 2; ++dim) {
+      num_batches *= shape.hi[dim] - shape.lo[dim] + 1;
+    }
+
+    const int64_t block_stride = static_cast<int64_t>(n) * n;
+    // The solvers overwrite their input, so without an output for the
+    // eigenvectors every batch reuses the same scratch copy
+    VAL* scratch = nullptr;
+    if (v == nullptr) {
+      scratch = create_buffer<VAL>(static_cast<size_t>(block_stride)).ptr(0);
+    }
+    for (int64_t batch = 0; batch < num_batches; ++batch) {
+      SyevImplBody<KIND, CODE>()(n,
+                                 args.lower,
+                                 a + batch * block_stride,
+                                 w + batch * n,
+                                 v == nullptr ? nullptr : v + batch * block_stride,
+                                 scratch);
+    }
+  }
+
+  template <Type::Code CODE,
+            int32_t DIM,
+            std::enable_if_t<(DIM < 2) || !support_syev<CODE>::value>* = nullptr>
+  void operator()(SyevArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void syev_template(TaskContext& context)
+{
+  auto outputs = context.outputs();
+
+  SyevArgs args;
+  args.a               = context.input(0);
+  args.w               = std::move(outputs[0]);
+  args.compute_vectors = outputs.size() > 1;
+  if (args.compute_vectors) {
+    args.v = std::move(outputs[1]);
+  }
+  args.lower = context.scalar(0).value<bool>();
+
+  double_dispatch(args.a.dim(), args.a.type().code(), SyevImpl<KIND>{}, args);
+}
+
+}  // namespace cupynumeric
@@ -14,7 +14,7 @@
  *
  */
 
-#include "legate/data/buffer.h"
+#include "legate.h"
 #include "cupynumeric/matrix/util.h"
 #include "legate/utilities/macros.h"
 #include "legate_defines.h"
@@ -77,12 +77,6 @@ int64_t calculate_volume(size_t ndim, const int64_t* shape, int64_t* strides)
   return volume;
 }
 
-float* allocate_buffer(size_t size)
-{
-  auto buffer = legate::create_buffer<float, 1>(size);
-  return buffer.ptr(0);
-}
-
 void half_vector_to_float(float* out, const __half* ptr, size_t n)
 {
 #if LEGATE_DEFINED(LEGATE_USE_OPENMP)
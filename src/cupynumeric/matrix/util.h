@@ -41,9 +41,7 @@ inline int64_t unflatten_with_strides(int64_t flat_idx,
 
 int64_t calculate_volume(size_t ndim, const int64_t* shape, int64_t* strides = nullptr);
 
-float* allocate_buffer(size_t size);
-
-// The following assume that the float array was created using allocate_buffer
+// The following assume that the float array is dense and row-major
 
 void half_vector_to_float(float* out, const __half* ptr, size_t n);
 
@@ -140,6 +140,11 @@ NDArray::NDArray(legate::LogicalStore&& store) : store_(std::forward<legate::Log
 {
 }
 
+NDArray::NDArray(legate::LogicalStore&& store, std::shared_ptr<EagerStorage> eager)
+  : store_(std::forward<legate::LogicalStore>(store)), eager_(std::move(eager))
+{
+}
+
 int32_t NDArray::dim() const { return store_.dim(); }
 
 const std::vector<uint64_t>& NDArray::shape() const { return store_.extents().data(); }
@@ -166,8 +171,7 @@ NDArray NDArray::operator+(const NDArray& other) const { return add(*this, other
 NDArray NDArray::operator+(const legate::Scalar& other) const
 {
   auto runtime = CuPyNumericRuntime::get_runtime();
-  auto scalar  = runtime->create_scalar_store(other);
-  return operator+(NDArray(std::move(scalar)));
+  return operator+(runtime->create_scalar_array(other));
 }
 
 NDArray& NDArray::operator+=(const NDArray& other)
@@ -181,8 +185,7 @@ NDArray NDArray::operator*(const NDArray& other) const { return multiply(*this,
 NDArray NDArray::operator*(const legate::Scalar& other) const
 {
   auto runtime = CuPyNumericRuntime::get_runtime();
-  auto scalar  = runtime->create_scalar_store(other);
-  return operator*(NDArray(std::move(scalar)));
+  return operator*(runtime->create_scalar_array(other));
 }
 
 NDArray& NDArray::operator*=(const NDArray& other)
@@ -200,7 +203,7 @@ NDArray NDArray::operator[](std::initializer_list<slice> slices) const
   }
 
   uint32_t dim = 0;
-  auto sliced  = store_;
+  auto sliced  = store();
   for (const auto& sl : slices) {
     sliced = sliced.slice(0, sl);
     ++dim;
@@ -219,8 +222,7 @@ void NDArray::assign(const NDArray& other)
 void NDArray::assign(const legate::Scalar& other)
 {
   auto runtime = CuPyNumericRuntime::get_runtime();
-  auto scalar  = runtime->create_scalar_store(other);
-  assign(NDArray(std::move(scalar)));
+  assign(runtime->create_scalar_array(other));
 }
 
 void NDArray::random(int32_t gen_code)
@@ -233,7 +235,7 @@ void NDArray::random(int32_t gen_code)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_RAND);
 
-  task.add_output(store_);
+  task.add_output(store());
   task.add_scalar_arg(legate::Scalar(static_cast<int32_t>(RandGenCode::UNIFORM)));
   task.add_scalar_arg(legate::Scalar(runtime->get_next_random_epoch()));
   auto strides = compute_strides(shape());
@@ -244,14 +246,14 @@ void NDArray::random(int32_t gen_code)
 
 void NDArray::fill(const Scalar& value)
 {
-  if (size() == 0) {
+  if (size() == 0 || eager_fill(value)) {
     return;
   }
 
   auto runtime = CuPyNumericRuntime::get_runtime();
 
-  if (!store_.transformed()) {
-    legate::Runtime::get_runtime()->issue_fill(store_, value);
+  if (!store().transformed()) {
+    legate::Runtime::get_runtime()->issue_fill(store(), value);
     return;
   }
 
@@ -259,7 +261,7 @@ void NDArray::fill(const Scalar& value)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_FILL);
 
-  task.add_output(store_);
+  task.add_output(store());
   task.add_input(fill_value);
 
   runtime->submit(std::move(task));
@@ -279,7 +281,7 @@ void NDArray::_fill(legate::LogicalStore const& value)
 
   auto runtime = CuPyNumericRuntime::get_runtime();
   auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_FILL);
-  task.add_output(store_);
+  task.add_output(store());
   task.add_input(value);
   task.add_scalar_arg(Scalar(false));
   runtime->submit(std::move(task));
@@ -300,8 +302,8 @@ void NDArray::eye(int32_t k)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_EYE);
 
-  task.add_input(store_);
-  task.add_output(store_);
+  task.add_input(store());
+  task.add_output(store());
   task.add_scalar_arg(legate::Scalar(k));
 
   runtime->submit(std::move(task));
@@ -327,11 +329,11 @@ void NDArray::bincount(NDArray rhs, std::optional<NDArray> weights /*=std::nullo
   auto task                     = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_BINCOUNT);
   legate::ReductionOpKind redop = legate::ReductionOpKind::ADD;
 
-  auto p_lhs = task.add_reduction(store_, redop);
-  auto p_rhs = task.add_input(rhs.store_);
+  auto p_lhs = task.add_reduction(store(), redop);
+  auto p_rhs = task.add_input(rhs.store());
   task.add_constraint(legate::broadcast(p_lhs, {0}));
   if (weights.has_value()) {
-    auto p_weight = task.add_input(weights.value().store_);
+    auto p_weight = task.add_input(weights.value().store());
     task.add_constraint(legate::align(p_rhs, p_weight));
   }
 
@@ -342,7 +344,7 @@ void NDArray::sort_task(NDArray rhs, bool argsort, bool stable)
 {
   auto runtime = CuPyNumericRuntime::get_runtime();
   auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_SORT);
-  auto p_rhs   = task.add_input(rhs.store_);
+  auto p_rhs   = task.add_input(rhs.store());
 
   auto machine             = legate::Runtime::get_runtime()->get_machine();
   bool uses_unbound_output = machine.count() > 1 and rhs.dim() == 1;
@@ -351,7 +353,7 @@ void NDArray::sort_task(NDArray rhs, bool argsort, bool stable)
     unbound = runtime->create_array(type());
     task.add_output(unbound.value().get_store());
   } else {
-    auto p_lhs = task.add_output(store_);
+    auto p_lhs = task.add_output(store());
     task.add_constraint(align(p_lhs, p_rhs));
   }
 
@@ -367,6 +369,7 @@ void NDArray::sort_task(NDArray rhs, bool argsort, bool stable)
   runtime->submit(std::move(task));
   if (uses_unbound_output) {
     store_ = unbound.value().get_store();
+    eager_.reset();
   }
 }
 
@@ -383,9 +386,11 @@ void NDArray::sort_swapped(NDArray rhs, bool argsort, int32_t sort_axis, bool st
     auto sort_result = runtime->create_array(swapped_copy.shape(), type());
     sort_result.sort(swapped_copy, argsort, -1, stable);
     store_ = sort_result.swapaxes(rhs.dim() - 1, sort_axis).get_store();
+    eager_.reset();
   } else {
     swapped_copy.sort(swapped_copy, argsort, -1, stable);
     store_ = swapped_copy.swapaxes(rhs.dim() - 1, sort_axis).get_store();
+    eager_.reset();
   }
 }
 
@@ -435,13 +440,13 @@ void NDArray::trilu(NDArray rhs, int32_t k, bool lower)
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_TRILU);
 
   auto& out_shape = shape();
-  rhs             = rhs.broadcast(out_shape, rhs.store_);
+  rhs             = rhs.broadcast(out_shape, rhs.store());
 
   task.add_scalar_arg(legate::Scalar(lower));
   task.add_scalar_arg(legate::Scalar(k));
 
-  auto p_lhs = task.add_output(store_);
-  auto p_rhs = task.add_input(rhs.store_);
+  auto p_lhs = task.add_output(store());
+  auto p_rhs = task.add_input(rhs.store());
 
   task.add_constraint(align(p_lhs, p_rhs));
 
@@ -454,7 +459,7 @@ void NDArray::binary_op(int32_t op_code, NDArray rhs1, NDArray rhs2)
     throw std::invalid_argument("Operands must have the same type");
   }
 
-  if (size() == 0) {
+  if (size() == 0 || eager_binary_op(op_code, rhs1, rhs2)) {
     return;
   }
 
@@ -463,10 +468,10 @@ void NDArray::binary_op(int32_t op_code, NDArray rhs1, NDArray rhs2)
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_BINARY_OP);
 
   auto& out_shape = shape();
-  auto rhs1_store = broadcast(out_shape, rhs1.store_);
-  auto rhs2_store = broadcast(out_shape, rhs2.store_);
+  auto rhs1_store = broadcast(out_shape, rhs1.store());
+  auto rhs2_store = broadcast(out_shape, rhs2.store());
 
-  auto p_lhs  = task.add_output(store_);
+  auto p_lhs  = task.add_output(store());
   auto p_rhs1 = task.add_input(rhs1_store);
   auto p_rhs2 = task.add_input(rhs2_store);
   task.add_scalar_arg(legate::Scalar(op_code));
@@ -498,7 +503,7 @@ void NDArray::binary_reduction(int32_t op_code, NDArray rhs1, NDArray rhs2)
   }
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_BINARY_RED);
 
-  task.add_reduction(store_, redop);
+  task.add_reduction(store(), redop);
   auto p_rhs1 = task.add_input(rhs1_store);
   auto p_rhs2 = task.add_input(rhs2_store);
   task.add_scalar_arg(legate::Scalar(op_code));
@@ -512,7 +517,7 @@ void NDArray::unary_op(int32_t op_code,
                        NDArray input,
                        const std::vector<legate::Scalar>& extra_args /*= {}*/)
 {
-  if (size() == 0) {
+  if (size() == 0 || eager_unary_op(op_code, input, extra_args)) {
     return;
   }
 
@@ -520,9 +525,9 @@ void NDArray::unary_op(int32_t op_code,
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_UNARY_OP);
 
-  auto rhs = broadcast(shape(), input.store_);
+  auto rhs = broadcast(shape(), input.store());
 
-  auto p_out = task.add_output(store_);
+  auto p_out = task.add_output(store());
   auto p_in  = task.add_input(rhs);
   task.add_scalar_arg(legate::Scalar(op_code));
 
@@ -537,7 +542,7 @@ void NDArray::unary_op(int32_t op_code,
 
 void NDArray::unary_reduction(int32_t op_code_, NDArray input)
 {
-  if (size() == 0) {
+  if (size() == 0 || eager_unary_reduction(op_code_, input)) {
     return;
   }
 
@@ -549,8 +554,8 @@ void NDArray::unary_reduction(int32_t op_code_, NDArray input)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_SCALAR_UNARY_RED);
 
-  task.add_reduction(store_, get_reduction_op(op_code));
-  task.add_input(input.store_);
+  task.add_reduction(store(), get_reduction_op(op_code));
+  task.add_input(input.store());
   task.add_scalar_arg(legate::Scalar(op_code_));
   task.add_scalar_arg(legate::Scalar(input.shape()));
   task.add_scalar_arg(legate::Scalar(false));  // has_where
@@ -599,9 +604,9 @@ void NDArray::dot(NDArray rhs1, NDArray rhs2)
   std::vector<std::uint64_t> tile_shape_rhs2 = {k_batch_size, tile_shape[1]};
   auto color_k                               = ceildiv(k, k_batch_size);
 
-  auto p_lhs  = store_.partition_by_tiling(tile_shape);
-  auto p_rhs1 = rhs1.store_.partition_by_tiling(tile_shape_rhs1);
-  auto p_rhs2 = rhs2.store_.partition_by_tiling(tile_shape_rhs2);
+  auto p_lhs  = store().partition_by_tiling(tile_shape);
+  auto p_rhs1 = rhs1.store().partition_by_tiling(tile_shape_rhs1);
+  auto p_rhs2 = rhs2.store().partition_by_tiling(tile_shape_rhs2);
 
   for (std::uint64_t i = 0; i < color_k; ++i) {
     auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_MATMUL, color_shape);
@@ -631,7 +636,7 @@ void NDArray::arange(Scalar start, Scalar stop, Scalar step)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_ARANGE);
 
-  task.add_output(store_);
+  task.add_output(store());
 
   task.add_scalar_arg(start);
   task.add_scalar_arg(step);
@@ -652,9 +657,10 @@ std::vector<NDArray> NDArray::nonzero()
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_NONZERO);
 
   for (auto& output : outputs) {
-    task.add_output(output.store_);
+    task.add_output(output.store());
   }
-  auto p_rhs = task.add_input(store_);
+  auto p_rhs = task.add_input(store());
+  task.add_scalar_arg(legate::Scalar(false));  // packed
 
   if (ndim > 1) {
     task.add_constraint(legate::broadcast(p_rhs, legate::from_range<uint32_t>(1, ndim)));
@@ -676,8 +682,8 @@ NDArray NDArray::unique()
   auto task     = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_UNIQUE);
   auto part_out = task.declare_partition();
   auto part_in  = task.declare_partition();
-  task.add_output(result.store_, part_out);
-  task.add_input(store_, part_in);
+  task.add_output(result.store(), part_out);
+  task.add_input(store(), part_in);
   task.add_communicator("nccl");
   if (!has_gpus) {
     task.add_constraint(legate::broadcast(part_in, legate::from_range<uint32_t>(0, dim())));
@@ -707,7 +713,7 @@ NDArray NDArray::swapaxes(int32_t axis1, int32_t axis2)
 
   std::swap(dims[axis1], dims[axis2]);
 
-  auto transposed = store_.transpose(std::move(dims));
+  auto transposed = store().transpose(std::move(dims));
   auto runtime    = CuPyNumericRuntime::get_runtime();
   return runtime->create_array(std::move(transposed));
 }
@@ -738,7 +744,7 @@ void NDArray::create_window(int32_t op_code, int64_t M, std::vector<double> args
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_WINDOW);
 
-  task.add_output(store_);
+  task.add_output(store());
   task.add_scalar_arg(legate::Scalar(op_code));
   task.add_scalar_arg(legate::Scalar(M));
 
@@ -755,11 +761,11 @@ void NDArray::convolve(NDArray input, NDArray filter)
 
   auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_CONVOLVE);
 
-  auto p_filter = task.add_input(filter.store_);
-  auto p_input  = task.add_input(input.store_);
+  auto p_filter = task.add_input(filter.store());
+  auto p_input  = task.add_input(input.store());
   auto p_halo   = task.declare_partition();
-  task.add_input(input.store_, p_halo);
-  auto p_output = task.add_output(store_);
+  task.add_input(input.store(), p_halo);
+  auto p_output = task.add_output(store());
   task.add_scalar_arg(legate::Scalar(shape()));
 
   auto offsets = (filter.store_.extents() + 1) / 2;
@@ -774,7 +780,7 @@ void NDArray::convolve(NDArray input, NDArray filter)
 NDArray NDArray::transpose()
 {
   if (dim() == 1) {
-    return NDArray(legate::LogicalStore(store_));
+    return NDArray(legate::LogicalStore(store()));
   }
   std::vector<int32_t> axes;
   for (int32_t i = dim() - 1; i > -1; --i) {
@@ -786,12 +792,12 @@ NDArray NDArray::transpose()
 NDArray NDArray::transpose(std::vector<int32_t> axes)
 {
   if (dim() == 1) {
-    return NDArray(legate::LogicalStore(store_));
+    return NDArray(legate::LogicalStore(store()));
   }
   if (static_cast<int32_t>(axes.size()) != dim()) {
     throw std::invalid_argument("axes must be the same size as ndim for transpose");
   }
-  return NDArray(store_.transpose(std::move(axes)));
+  return NDArray(store().transpose(std::move(axes)));
 }
 
 NDArray NDArray::argwhere()
@@ -813,8 +819,8 @@ NDArray NDArray::argwhere()
   auto task     = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_ARGWHERE);
   auto part_out = task.declare_partition();
   auto part_in  = task.declare_partition();
-  task.add_output(result.store_, part_out);
-  task.add_input(store_, part_in);
+  task.add_output(result.store(), part_out);
+  task.add_input(store(), part_in);
   if (dim() > 1) {
     task.add_constraint(legate::broadcast(part_in, legate::from_range<uint32_t>(1, dim())));
   }
@@ -834,8 +840,8 @@ NDArray NDArray::flip(std::optional<std::vector<int32_t>> axis)
 
 void NDArray::flip(NDArray rhs, std::optional<std::vector<int32_t>> axis)
 {
-  auto input  = rhs.store_;
-  auto output = (*this).store_;
+  auto input  = rhs.store();
+  auto output = (*this).store();
 
   std::vector<int32_t> axes;
   if (!axis.has_value()) {
@@ -1023,7 +1029,7 @@ void NDArray::unary_reduction(int32_t op,
     assert(axes.empty() || lhs_array.dim() == (rhs_array.dim() -
                                                (keepdims ? 0 : static_cast<int32_t>(axes.size()))));
 
-    auto p_lhs = lhs_array.store_;
+    auto p_lhs = lhs_array.store();
     while (p_lhs.dim() > 1) {
       p_lhs = p_lhs.project(0, 0);
     }
@@ -1031,7 +1037,7 @@ void NDArray::unary_reduction(int32_t op,
     auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_SCALAR_UNARY_RED);
 
     task.add_reduction(p_lhs, get_reduction_op(op_code));
-    auto p_rhs = task.add_input(rhs_array.store_);
+    auto p_rhs = task.add_input(rhs_array.store());
     task.add_scalar_arg(legate::Scalar(op));
     if (rhs_array.dim() > 0) {
       task.add_scalar_arg(legate::Scalar(rhs_array.shape()));
@@ -1040,17 +1046,17 @@ void NDArray::unary_reduction(int32_t op,
     }
     task.add_scalar_arg(legate::Scalar(is_where));
     if (is_where) {
-      auto p_where = task.add_input(where.value().store_);
+      auto p_where = task.add_input(where.value().store());
       task.add_constraint(align(p_rhs, p_where));
     }
     for (auto& arg : args) {
-      task.add_input(arg.store_);
+      task.add_input(arg.store());
     }
 
     runtime->submit(std::move(task));
   } else {
     assert(!axes.empty());
-    auto result = lhs_array.store_;
+    auto result = lhs_array.store();
     if (keepdims) {
       for (auto axis : axes) {
         result = result.project(axis, 0);
@@ -1068,16 +1074,16 @@ void NDArray::unary_reduction(int32_t op,
     auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_UNARY_RED);
 
     auto p_lhs = task.add_reduction(result, get_reduction_op(op_code));
-    auto p_rhs = task.add_input(rhs_array.store_);
+    auto p_rhs = task.add_input(rhs_array.store());
     task.add_scalar_arg(legate::Scalar(axes[0]));
     task.add_scalar_arg(legate::Scalar(op));
     task.add_scalar_arg(legate::Scalar(is_where));
     if (is_where) {
-      auto p_where = task.add_input(where.value().store_);
+      auto p_where = task.add_input(where.value().store());
       task.add_constraint(align(p_rhs, p_where));
     }
     for (auto& arg : args) {
-      task.add_input(arg.store_);
+      task.add_input(arg.store());
     }
     task.add_constraint(align(p_lhs, p_rhs));
 
@@ -1092,7 +1098,7 @@ NDArray NDArray::broadcast_where(NDArray where, NDArray source)
   }
 
   auto where_shape = broadcast_shapes({where, source});
-  auto where_store = broadcast(where_shape, where.store_);
+  auto where_store = broadcast(where_shape, where.store());
 
   auto runtime = CuPyNumericRuntime::get_runtime();
   return runtime->create_array(std::move(where_store));
@@ -1104,8 +1110,12 @@ void NDArray::convert(NDArray rhs, int32_t nan_op)
   NDArray rhs_array(rhs);
   assert(lhs_array.type() != rhs_array.type());
 
-  auto lhs_s = lhs_array.store_;
-  auto rhs_s = rhs_array.store_;
+  if (eager_convert(rhs, nan_op)) {
+    return;
+  }
+
+  auto lhs_s = lhs_array.store();
+  auto rhs_s = rhs_array.store();
 
   auto runtime = CuPyNumericRuntime::get_runtime();
   auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_CONVERT);
@@ -1248,8 +1258,8 @@ void NDArray::diag_task(NDArray rhs, int32_t offset, int32_t naxes, bool extract
   fill(zero);
 
   if (extract) {
-    diag       = store_;
-    matrix     = rhs.store_;
+    diag       = store();
+    matrix     = rhs.store();
     auto ndim  = rhs.dim();
     auto start = matrix.dim() - naxes;
     auto n     = ndim - 1;
@@ -1279,8 +1289,8 @@ void NDArray::diag_task(NDArray rhs, int32_t offset, int32_t naxes, bool extract
       }
     }
   } else {
-    matrix = store_;
-    diag   = rhs.store_;
+    matrix = store();
+    diag   = rhs.store();
     if (offset > 0) {
       matrix = matrix.slice(1, slice(offset));
     } else if (offset < 0) {
@@ -1345,19 +1355,19 @@ void NDArray::put(NDArray indices, NDArray values, std::string mode)
     indices = indices.clip_indices(Scalar(int64_t(0)), Scalar(int64_t(size() - 1)));
   }
 
-  if (indices.store_.has_scalar_storage() || indices.store_.transformed()) {
-    bool change_shape = indices.store_.has_scalar_storage();
+  if (indices.store().has_scalar_storage() || indices.store().transformed()) {
+    bool change_shape = indices.store().has_scalar_storage();
     indices           = indices._convert_future_to_regionfield(change_shape);
   }
-  if (values.store_.has_scalar_storage() || values.store_.transformed()) {
-    bool change_shape = values.store_.has_scalar_storage();
+  if (values.store().has_scalar_storage() || values.store().transformed()) {
+    bool change_shape = values.store().has_scalar_storage();
     values            = values._convert_future_to_regionfield(change_shape);
   }
   bool need_copy = false;
   auto self_tmp  = *this;
-  if (self_tmp.store_.has_scalar_storage() || self_tmp.store_.transformed()) {
+  if (self_tmp.store().has_scalar_storage() || self_tmp.store().transformed()) {
     need_copy         = true;
-    bool change_shape = self_tmp.store_.has_scalar_storage();
+    bool change_shape = self_tmp.store().has_scalar_storage();
     self_tmp          = self_tmp._convert_future_to_regionfield(change_shape);
   }
 
@@ -1365,8 +1375,8 @@ void NDArray::put(NDArray indices, NDArray values, std::string mode)
   bool check_bounds = (mode == "raise");
   auto task         = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_WRAP);
   auto indirect = runtime->create_array(indices.shape(), legate::point_type(self_tmp.dim()), false);
-  auto p_indirect = task.add_output(indirect.store_);
-  auto p_indices  = task.add_input(indices.store_);
+  auto p_indirect = task.add_output(indirect.store());
+  auto p_indices  = task.add_input(indices.store());
   task.add_scalar_arg(legate::Scalar(self_tmp.shape()));
   task.add_scalar_arg(legate::Scalar(true));  // has_input
   task.add_scalar_arg(legate::Scalar(check_bounds));
@@ -1375,11 +1385,11 @@ void NDArray::put(NDArray indices, NDArray values, std::string mode)
   runtime->submit(std::move(task));
 
   auto legate_runtime = legate::Runtime::get_runtime();
-  legate_runtime->issue_scatter(self_tmp.store_, indirect.store_, values.store_);
+  legate_runtime->issue_scatter(self_tmp.store(), indirect.store(), values.store());
 
   if (need_copy) {
-    if (store_.has_scalar_storage()) {
-      self_tmp = runtime->create_array(std::move(self_tmp.store_.project(0, 0)));
+    if (store().has_scalar_storage()) {
+      self_tmp = runtime->create_array(std::move(self_tmp.store().project(0, 0)));
     }
     assign(self_tmp);
   }
@@ -1390,8 +1400,8 @@ NDArray NDArray::copy()
   auto runtime        = CuPyNumericRuntime::get_runtime();
   auto legate_runtime = legate::Runtime::get_runtime();
   auto out            = runtime->create_array(shape(), type());
-  if (store_.has_scalar_storage() && out.store_.has_scalar_storage()) {
-    legate_runtime->issue_fill(out.store_, store_);
+  if (store().has_scalar_storage() && out.store().has_scalar_storage()) {
+    legate_runtime->issue_fill(out.store(), store());
   } else {
     out.assign(*this);
   }
@@ -1412,7 +1422,7 @@ NDArray NDArray::repeat(int64_t repeats, std::optional<int32_t> axis)
       throw std::invalid_argument("axis is out of bounds for array of dimension 0");
     }
     auto out = runtime->create_array({static_cast<size_t>(repeats)}, type());
-    out._fill(store_);
+    out._fill(store());
     return out;
   }
 
@@ -1444,8 +1454,8 @@ NDArray NDArray::repeat(int64_t repeats, std::optional<int32_t> axis)
   auto out    = runtime->create_array(out_shape, src.type());
   auto p_self = task.declare_partition();
   auto p_out  = task.declare_partition();
-  task.add_input(src.store_, p_self);
-  task.add_output(out.store_, p_out);
+  task.add_input(src.store(), p_self);
+  task.add_output(out.store(), p_out);
   std::vector<std::uint64_t> factors(src.dim(), 1);
   factors[axis_int] = uint64_t(repeats);
   task.add_constraint(legate::scale(legate::tuple<std::uint64_t>(factors), p_self, p_out));
@@ -1505,12 +1515,12 @@ NDArray NDArray::repeat(NDArray repeats, std::optional<int32_t> axis)
   auto legate_runtime = legate::Runtime::get_runtime();
   auto out_store      = legate_runtime->create_store(src.type(), src.dim());
   auto task           = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_REPEAT);
-  auto p_src          = task.add_input(src.store_);
+  auto p_src          = task.add_input(src.store());
   task.add_output(out_store);
   task.add_scalar_arg(Scalar(axis_int));
   task.add_scalar_arg(Scalar(false));  // scalar_repeats
   auto shape         = src.shape();
-  auto repeats_store = repeats.store_;
+  auto repeats_store = repeats.store();
   for (int32_t dim = 0; dim < src.dim(); ++dim) {
     if (dim == axis_int) {
       continue;
@@ -1548,7 +1558,7 @@ NDArray NDArray::_wrap(size_t new_len)
     throw std::invalid_argument("Unable to wrap an empty array to a length greater than 0.");
   }
   if (1 == new_len) {
-    auto tmp_store = store_;
+    auto tmp_store = store();
     for (int32_t i = 0; i < dim(); ++i) {
       tmp_store = tmp_store.project(0, 0);
     }
@@ -1559,14 +1569,14 @@ NDArray NDArray::_wrap(size_t new_len)
   }
 
   auto src = *this;
-  if (src.store_.has_scalar_storage() || src.store_.transformed()) {
-    bool change_shape = src.store_.has_scalar_storage();
+  if (src.store().has_scalar_storage() || src.store().transformed()) {
+    bool change_shape = src.store().has_scalar_storage();
     src               = src._convert_future_to_regionfield(change_shape);
   }
 
   auto task     = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_WRAP);
   auto indirect = runtime->create_array({new_len}, legate::point_type(src.dim()), false);
-  task.add_output(indirect.store_);
+  task.add_output(indirect.store());
   task.add_scalar_arg(legate::Scalar(src.shape()));
   task.add_scalar_arg(legate::Scalar(false));  // has_input
   task.add_scalar_arg(legate::Scalar(false));  // check bounds
@@ -1574,7 +1584,7 @@ NDArray NDArray::_wrap(size_t new_len)
 
   auto legate_runtime = legate::Runtime::get_runtime();
   auto out            = runtime->create_array({new_len}, src.type(), false);
-  legate_runtime->issue_gather(out.store_, src.store_, indirect.store_);
+  legate_runtime->issue_gather(out.store(), src.store(), indirect.store());
 
   return out;
 }
@@ -1604,8 +1614,8 @@ NDArray NDArray::clip_indices(Scalar const& min, Scalar const& max)
   auto runtime = CuPyNumericRuntime::get_runtime();
   auto out     = runtime->create_array(shape(), type());
   auto task    = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_UNARY_OP);
-  auto p_out   = task.add_output(out.store_);
-  auto p_in    = task.add_input(store_);
+  auto p_out   = task.add_output(out.store());
+  auto p_in    = task.add_input(store());
   task.add_scalar_arg(legate::Scalar(static_cast<int32_t>(UnaryOpCode::CLIP)));
   task.add_scalar_arg(min);
   task.add_scalar_arg(max);
@@ -1785,7 +1795,7 @@ NDArray NDArray::reshape(std::vector<int64_t> newshape)
 NDArray NDArray::squeeze(
   std::optional<std::reference_wrapper<std::vector<int32_t> const>> axis) const
 {
-  auto result = store_;
+  auto result = store();
   if (!axis.has_value()) {
     int shift = 0;
     for (int d = 0; d < dim(); d++) {
@@ -1818,9 +1828,9 @@ NDArray NDArray::squeeze(
 void NDArray::where(NDArray rhs1, NDArray rhs2, NDArray rhs3)
 {
   const auto& out_shape = shape();
-  auto rhs1_store       = broadcast(out_shape, rhs1.store_);
-  auto rhs2_store       = broadcast(out_shape, rhs2.store_);
-  auto rhs3_store       = broadcast(out_shape, rhs3.store_);
+  auto rhs1_store       = broadcast(out_shape, rhs1.store());
+  auto rhs2_store       = broadcast(out_shape, rhs2.store());
+  auto rhs3_store       = broadcast(out_shape, rhs3.store());
   assert(store_.type() == rhs2.store_.type());
   assert(store_.type() == rhs3.store_.type());
 
@@ -1832,7 +1842,7 @@ void NDArray::where(NDArray rhs1, NDArray rhs2, NDArray rhs3)
   auto p_rhs2 = task.declare_partition();
   auto p_rhs3 = task.declare_partition();
 
-  task.add_output(store_, p_lhs);
+  task.add_output(store(), p_lhs);
   task.add_input(rhs1_store, p_rhs1);
   task.add_input(rhs2_store, p_rhs2);
   task.add_input(rhs3_store, p_rhs3);
@@ -1853,7 +1863,7 @@ NDArray NDArray::_maybe_convert(const legate::Type& type) const
   }
 }
 
-legate::LogicalStore NDArray::get_store() { return store_; }
+legate::LogicalStore NDArray::get_store() { return store(); }
 
 legate::LogicalStore NDArray::broadcast(const std::vector<uint64_t>& shape,
                                         legate::LogicalStore& store) const
@@ -1889,10 +1899,10 @@ legate::LogicalStore NDArray::broadcast(const std::vector<uint64_t>& shape,
 legate::LogicalStore NDArray::broadcast(NDArray rhs1, NDArray rhs2)
 {
   if (rhs1.shape() == rhs2.shape()) {
-    return rhs1.store_;
+    return rhs1.store();
   }
   auto out_shape = broadcast_shapes({rhs1, rhs2});
-  return broadcast(out_shape, rhs1.store_);
+  return broadcast(out_shape, rhs1.store());
 }
 
 /*static*/ legate::Library NDArray::get_library()
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <initializer_list>
 
@@ -25,11 +26,14 @@
 
 namespace cupynumeric {
 
+struct EagerStorage;
+
 class NDArray {
   friend class CuPyNumericRuntime;
 
  private:
   NDArray(legate::LogicalStore&& store);
+  NDArray(legate::LogicalStore&& store, std::shared_ptr<EagerStorage> eager);
 
  public:
   NDArray(const NDArray&)            = default;
@@ -163,11 +167,29 @@ class NDArray {
                       std::optional<NDArray> out              = std::nullopt);
   void _fill(legate::LogicalStore const& value);
 
+ private:
+  // Run the operation on the host values of eager arrays (see eager.h). They return false,
+  // leaving the arrays untouched, when any operand is not eager.
+  bool eager_fill(const Scalar& value);
+  bool eager_binary_op(int32_t op_code, const NDArray& rhs1, const NDArray& rhs2);
+  bool eager_unary_op(int32_t op_code,
+                      const NDArray& input,
+                      const std::vector<legate::Scalar>& extra_args);
+  bool eager_unary_reduction(int32_t op_code, const NDArray& input);
+  bool eager_convert(const NDArray& rhs, int32_t nan_op);
+  std::byte* eager_output();
+  void eager_discard(bool fresh);
+  const std::byte* eager_input() const;
+  // The store holding the values of this array, into which an eager array is promoted first
+  legate::LogicalStore& store() const;
+
  public:
   static legate::Library get_library();
 
  private:
-  legate::LogicalStore store_;
+  // Both are updated by store() when an eager array gets promoted
+  mutable legate::LogicalStore store_;
+  mutable std::shared_ptr<EagerStorage> eager_{};
 };
 
 }  // namespace cupynumeric
@@ -19,14 +19,14 @@ namespace cupynumeric {
 template <typename T, int32_t DIM>
 legate::AccessorRO<T, DIM> NDArray::get_read_accessor()
 {
-  auto mapped = store_.get_physical_store();
+  auto mapped = store().get_physical_store();
   return mapped.read_accessor<T, DIM>();
 }
 
 template <typename T, int32_t DIM>
 legate::AccessorWO<T, DIM> NDArray::get_write_accessor()
 {
-  auto mapped = store_.get_physical_store();
+  auto mapped = store().get_physical_store();
   return mapped.write_accessor<T, DIM>();
 }
 
@@ -21,6 +21,7 @@
 #include "cupynumeric/arg.h"
 #include "cupynumeric/arg.inl"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -53,6 +54,7 @@ struct FillImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
     FillImplBody<KIND, VAL, DIM>{}(out, fill_value, pitches, rect, dense);
   }
 
@@ -67,6 +69,7 @@ struct FillImpl {
 template <VariantKind KIND>
 static void fill_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_FILL, KIND};
   FillArgs args{context.output(0), context.input(0)};
   double_dispatch(std::max<int32_t>(args.out.dim(), 1), args.out.code(), FillImpl<KIND>{}, args);
 }
@@ -16,6 +16,7 @@
 
 #include "cupynumeric/operators.h"
 
+#include "cupynumeric/csr_matrix.h"
 #include "cupynumeric/runtime.h"
 #include "cupynumeric/binary/binary_op_util.h"
 #include "cupynumeric/unary/unary_op_util.h"
@@ -291,6 +292,8 @@ NDArray dot(NDArray rhs1, NDArray rhs2)
   return out;
 }
 
+NDArray dot(const CsrMatrix& rhs1, NDArray rhs2) { return rhs1.dot(std::move(rhs2)); }
+
 NDArray all(NDArray input,
             std::vector<int32_t> axis,
             std::optional<NDArray> out,
@@ -368,6 +371,20 @@ NDArray as_array(legate::LogicalStore store)
   return CuPyNumericRuntime::get_runtime()->create_array(std::move(store));
 }
 
+NDArray memmap(std::string filename,
+               std::vector<uint64_t> shape,
+               const legate::Type& type,
+               int64_t offset)
+{
+  if (offset < 0) {
+    throw std::invalid_argument("offset must be non-negative");
+  }
+  if (!type.is_primitive()) {
+    throw std::invalid_argument("Type must be a primitive type");
+  }
+  return CuPyNumericRuntime::get_runtime()->create_array(filename, std::move(shape), type, offset);
+}
+
 NDArray array_equal(NDArray input0, NDArray input1)
 {
   auto dst = CuPyNumericRuntime::get_runtime()->create_array({1}, legate::bool_());
@@ -25,6 +25,8 @@
 
 namespace cupynumeric {
 
+class CsrMatrix;
+
 legate::Logger& cupynumeric_log();
 
 void initialize(int32_t argc, char** argv);
@@ -39,6 +41,8 @@ NDArray multiply(NDArray rhs1, NDArray rhs2, std::optional<NDArray> out = std::n
 
 NDArray dot(NDArray rhs1, NDArray rhs2);
 
+NDArray dot(const CsrMatrix& rhs1, NDArray rhs2);
+
 NDArray negative(NDArray input);
 
 NDArray random(std::vector<uint64_t> shape);
@@ -82,6 +86,15 @@ NDArray arange(Scalar start, Scalar stop = legate::Scalar{}, Scalar step = legat
 
 NDArray as_array(legate::LogicalStore store);
 
+// Maps `shape` elements of `type` stored in C order at byte `offset` of a raw
+// file (e.g., past the header of a .npy file) into a read-only array without
+// copying. Pages are faulted in on first access and shared through the page
+// cache with every other process mapping the same file.
+NDArray memmap(std::string filename,
+               std::vector<uint64_t> shape,
+               const legate::Type& type,
+               int64_t offset = 0);
+
 NDArray array_equal(NDArray input0, NDArray input1);
 
 std::vector<NDArray> nonzero(NDArray input);
@@ -17,13 +17,21 @@
 #include "env_defaults.h"
 #include "cupynumeric/runtime.h"
 
+#include "cupynumeric/eager.h"
 #include "cupynumeric/ndarray.h"
 #include "cupynumeric/unary/unary_red_util.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 #include <charconv>
 #include <cstdlib>
+#include <cstring>
 #include <string_view>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace cupynumeric {
 
 /*static*/ CuPyNumericRuntime* CuPyNumericRuntime::runtime_;
@@ -49,7 +57,16 @@ NDArray CuPyNumericRuntime::create_array(std::vector<uint64_t> shape,
                                          const legate::Type& type,
                                          bool optimize_scalar)
 {
+  uint64_t volume = 1;
+  for (auto extent : shape) {
+    volume *= extent;
+  }
   auto store = legate_runtime_->create_store(legate::Shape{shape}, type, optimize_scalar);
+  // Arrays that must not be backed by a future stay out of the eager path, as a promoted
+  // 1-element eager array is
+  if (optimize_scalar && volume > 0 && volume <= max_eager_volume() && is_eager_type(type)) {
+    return NDArray(std::move(store), std::make_shared<EagerStorage>());
+  }
   return NDArray(std::move(store));
 }
 
@@ -64,11 +81,73 @@ NDArray CuPyNumericRuntime::create_array(const legate::Type& type, int32_t dim)
   return NDArray(std::move(store));
 }
 
+NDArray CuPyNumericRuntime::create_array(const std::string& filename,
+                                         std::vector<uint64_t> shape,
+                                         const legate::Type& type,
+                                         int64_t offset)
+{
+  size_t nbytes = type.size();
+  for (auto extent : shape) {
+    nbytes *= extent;
+  }
+  if (nbytes == 0) {
+    return create_array(std::move(shape), type, false /*optimize_scalar*/);
+  }
+
+  auto fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + filename + ": " + std::strerror(errno));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<uint64_t>(st.st_size) < static_cast<uint64_t>(offset) + nbytes) {
+    close(fd);
+    throw std::invalid_argument(filename + " is too small for an array of the requested shape");
+  }
+
+  // mmap offsets must be page aligned, so map from the enclosing page
+  const auto page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  const auto skip      = static_cast<size_t>(offset % page_size);
+  const auto length    = skip + nbytes;
+  auto base            = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, offset - skip);
+  // The mapping holds its own reference to the file
+  close(fd);
+  if (base == MAP_FAILED) {
+    throw std::runtime_error("Failed to map " + filename + ": " + std::strerror(errno));
+  }
+
+  auto alloc = legate::ExternalAllocation::create_sysmem(
+    static_cast<int8_t*>(base) + skip,
+    nbytes,
+    true /*read_only*/,
+    [base, length](void*) { munmap(base, length); });
+  auto store = legate_runtime_->create_store(legate::Shape{shape}, type, alloc);
+  return NDArray(std::move(store));
+}
+
 legate::LogicalStore CuPyNumericRuntime::create_scalar_store(const Scalar& value)
 {
   return legate_runtime_->create_store(value);
 }
 
+NDArray CuPyNumericRuntime::create_scalar_array(const Scalar& value)
+{
+  if (max_eager_volume() > 0 && is_eager_type(value.type())) {
+    auto array = create_array({1}, value.type());
+    array.fill(value);
+    return array;
+  }
+  return NDArray(create_scalar_store(value));
+}
+
+uint64_t CuPyNumericRuntime::max_eager_volume()
+{
+  if (!max_eager_volume_.has_value()) {
+    max_eager_volume_ = cupynumeric_max_eager_volume();
+  }
+  return max_eager_volume_.value();
+}
+
 legate::Type CuPyNumericRuntime::get_argred_type(const legate::Type& value_type)
 {
   auto finder = argred_types_.find(value_type.code());
@@ -83,12 +162,14 @@ legate::Type CuPyNumericRuntime::get_argred_type(const legate::Type& value_type)
 
 legate::AutoTask CuPyNumericRuntime::create_task(CuPyNumericOpCode op_code)
 {
+  perf_counters_record_launch(op_code);
   return legate_runtime_->create_task(library_, legate::LocalTaskID{op_code});
 }
 
 legate::ManualTask CuPyNumericRuntime::create_task(CuPyNumericOpCode op_code,
                                                    const legate::tuple<std::uint64_t>& launch_shape)
 {
+  perf_counters_record_launch(op_code);
   return legate_runtime_->create_task(library_, legate::LocalTaskID{op_code}, launch_shape);
 }
 
@@ -102,6 +183,15 @@ void CuPyNumericRuntime::submit(legate::ManualTask&& task)
   legate_runtime_->submit(std::move(task));
 }
 
+void CuPyNumericRuntime::enable_perf_counters(bool enable) { perf_counters_enable(enable); }
+
+void CuPyNumericRuntime::reset_perf_counters() { perf_counters_reset(); }
+
+std::vector<CuPyNumericPerfRecord> CuPyNumericRuntime::get_perf_counters() const
+{
+  return perf_counters_snapshot();
+}
+
 uint32_t CuPyNumericRuntime::get_next_random_epoch() { return next_epoch_++; }
 
 /*static*/ CuPyNumericRuntime* CuPyNumericRuntime::get_runtime() { return runtime_; }
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "legate.h"
 
@@ -38,7 +39,17 @@ class CuPyNumericRuntime {
                        bool optimize_scalar = true);
   NDArray create_array(legate::LogicalStore&& store);
   NDArray create_array(const legate::Type& type, int32_t dim);
+  NDArray create_array(const std::string& filename,
+                       std::vector<uint64_t> shape,
+                       const legate::Type& type,
+                       int64_t offset);
   legate::LogicalStore create_scalar_store(const Scalar& value);
+  // A 1-element array holding the value, eager when such arrays are (see eager.h)
+  NDArray create_scalar_array(const Scalar& value);
+
+ public:
+  // Arrays created with at most this many elements start out eager
+  uint64_t max_eager_volume();
 
  public:
   legate::Type get_argred_type(const legate::Type& value_type);
@@ -50,6 +61,13 @@ class CuPyNumericRuntime {
   void submit(legate::AutoTask&& task);
   void submit(legate::ManualTask&& task);
 
+ public:
+  // Performance counters of the tasks executed in this process, one record per op code and
+  // variant, plus records of variant -1 for the launches created through create_task
+  void enable_perf_counters(bool enable);
+  void reset_perf_counters();
+  std::vector<CuPyNumericPerfRecord> get_perf_counters() const;
+
  public:
   uint32_t get_next_random_epoch();
 
@@ -68,6 +86,7 @@ class CuPyNumericRuntime {
   legate::Library library_;
   uint32_t next_epoch_{0};
   std::unordered_map<legate::Type::Code, legate::Type> argred_types_;
+  std::optional<uint64_t> max_eager_volume_{};
 };
 
 }  // namespace cupynumeric
@@ -48,7 +48,28 @@ struct ScanGlobalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
       return;
     }
 
-    auto stride = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
+    auto stride         = out_rect.hi[DIM - 1] - out_rect.lo[DIM - 1] + 1;
+    const auto num_rows = volume / stride;
+
+    if (num_rows >= static_cast<size_t>(omp_get_max_threads())) {
+      // enough rows to occupy every thread: fix up each row sequentially
+#pragma omp parallel for schedule(static)
+      for (size_t row = 0; row < num_rows; ++row) {
+        const uint64_t index = row * stride;
+        auto sum_valsp       = out_pitches.unflatten(index, out_rect.lo);
+        sum_valsp[DIM - 1]   = 0;
+        VAL global_prefix    = sum_vals[sum_valsp];
+        for (coord_t part = 1; part < partition_index[DIM - 1]; ++part) {
+          sum_valsp[DIM - 1] = part;
+          global_prefix      = func(global_prefix, sum_vals[sum_valsp]);
+        }
+        for (uint64_t i = index; i < index + stride; i++) {
+          outptr[i] = func(outptr[i], global_prefix);
+        }
+      }
+      return;
+    }
+
     for (uint64_t index = 0; index < volume; index += stride) {
       // get the corresponding ND index to use for sum_val
       auto sum_valsp = out_pitches.unflatten(index, out_rect.lo);
@@ -59,7 +80,7 @@ struct ScanGlobalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
       auto global_prefix     = thrust::reduce(thrust::omp::par,
                                           &sum_vals[sum_valsp],
                                           &sum_vals[sum_valsp_end],
-                                          (VAL)ScanOp<OP_CODE, CODE>::nan_identity,
+                                          OP::identity(),
                                           func);
       // apply global_prefix to out
 #pragma omp parallel for schedule(static)
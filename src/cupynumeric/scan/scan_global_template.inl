@@ -26,7 +26,7 @@ struct ScanGlobalImplBody;
 
 template <VariantKind KIND, ScanCode OP_CODE>
 struct ScanGlobalImpl {
-  template <Type::Code CODE, int DIM>
+  template <Type::Code CODE, int DIM, std::enable_if_t<ScanOp<OP_CODE, CODE>::valid>* = nullptr>
   void operator()(ScanGlobalArgs& args) const
   {
     using OP  = ScanOp<OP_CODE, CODE>;
@@ -56,6 +56,12 @@ struct ScanGlobalImpl {
                                                    sum_vals_rect,
                                                    args.partition_index);
   }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!ScanOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(ScanGlobalArgs& args) const
+  {
+    assert(false);
+  }
 };
 
 template <VariantKind KIND>
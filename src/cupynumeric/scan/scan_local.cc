@@ -18,14 +18,48 @@
 #include "cupynumeric/scan/scan_local_template.inl"
 #include "cupynumeric/unary/isnan.h"
 
-#include <thrust/scan.h>
-#include <thrust/execution_policy.h>
 #include <thrust/iterator/transform_iterator.h>
 
 namespace cupynumeric {
 
 using namespace legate;
 
+template <typename OP, typename InputIt, typename VAL, int DIM>
+static void scan_local_rows(OP func,
+                            InputIt inptr,
+                            VAL* outptr,
+                            legate::PhysicalStore* sum_vals,
+                            const Pitches<DIM - 1>& pitches,
+                            const Rect<DIM>& rect,
+                            bool exclusive)
+{
+  auto volume = rect.volume();
+  auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+
+  if (sum_vals == nullptr) {
+    // the scan axis is not partitioned, so the rows are already final
+    for (uint64_t index = 0; index < volume; index += stride) {
+      sequential_scan(func, inptr + index, outptr + index, stride, exclusive);
+    }
+    return;
+  }
+
+  Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+  extents[DIM - 1]   = 1;  // one element along scan axis
+
+  auto sum_valsptr = sum_vals->create_output_buffer<VAL, DIM>(extents, true);
+
+  for (uint64_t index = 0; index < volume; index += stride) {
+    auto total = sequential_scan(func, inptr + index, outptr + index, stride, exclusive);
+    // get the corresponding ND index with base zero to use for sum_val
+    auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
+    // only one element on scan axis
+    sum_valp[DIM - 1] = 0;
+    // write out the partition sum
+    sum_valsptr[sum_valp] = total;
+  }
+}
+
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
 struct ScanLocalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
@@ -34,31 +68,12 @@ struct ScanLocalImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
+    scan_local_rows(func, in.ptr(rect.lo), out.ptr(rect.lo), sum_vals, pitches, rect, exclusive);
   }
 };
 
@@ -68,44 +83,24 @@ struct ScanLocalNanImplBody<VariantKind::CPU, OP_CODE, CODE, DIM> {
   using VAL = type_of<CODE>;
 
   struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cupynumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
-    }
+    VAL operator()(VAL x) const { return cupynumeric::is_nan(x) ? OP::identity() : x; }
   };
 
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::host,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
+    scan_local_rows(func,
+                    thrust::make_transform_iterator(in.ptr(rect.lo), convert_nan_func()),
+                    out.ptr(rect.lo),
+                    sum_vals,
+                    pitches,
+                    rect,
+                    exclusive);
   }
 };
 
@@ -19,7 +19,9 @@
 #include "cupynumeric/unary/isnan.h"
 #include "cupynumeric/utilities/thrust_util.h"
 
+#include <thrust/functional.h>
 #include <thrust/scan.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include "cupynumeric/cuda_help.h"
@@ -28,15 +30,108 @@ namespace cupynumeric {
 
 using namespace legate;
 
-template <typename RES>
+template <typename InputIt, typename VAL>
 static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
-  lazy_kernel(RES* out, RES* sum_val)
+  row_last_kernel(InputIt in, VAL* last_vals, size_t num_rows, size_t stride)
 {
-  const size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
-  if (idx >= 1) {
+  const size_t row = global_tid_1d();
+  if (row >= num_rows) {
     return;
   }
-  sum_val[0] = out[0];
+  last_vals[row] = in[row * stride + stride - 1];
+}
+
+template <typename OP, typename VAL, int DIM>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  row_sums_kernel(OP func,
+                  const VAL* out,
+                  const VAL* last_vals,
+                  Buffer<VAL, DIM> sum_vals,
+                  const Pitches<DIM - 1> pitches,
+                  size_t num_rows,
+                  size_t stride)
+{
+  const size_t row = global_tid_1d();
+  if (row >= num_rows) {
+    return;
+  }
+  const size_t index = row * stride;
+  // get the corresponding ND index with base zero to use for sum_val
+  auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
+  // only one element on scan axis
+  sum_valp[DIM - 1] = 0;
+  // write out the partition sum; an exclusive scan has not folded in the
+  // last element of the row yet
+  VAL total = out[index + stride - 1];
+  if (last_vals != nullptr) {
+    total = func(total, last_vals[row]);
+  }
+  sum_vals[sum_valp] = total;
+}
+
+struct row_key_func {
+  size_t stride;
+  __host__ __device__ size_t operator()(size_t idx) const { return idx / stride; }
+};
+
+// Scans every row of the local rectangle with a single segmented scan instead
+// of one launch per row, which matters when there are many short rows.
+template <typename OP, typename InputIt, typename VAL, int DIM>
+static void scan_local_rows(OP func,
+                            InputIt inptr,
+                            VAL* outptr,
+                            legate::PhysicalStore* sum_vals,
+                            const Pitches<DIM - 1>& pitches,
+                            const Rect<DIM>& rect,
+                            bool exclusive)
+{
+  const size_t volume   = rect.volume();
+  const size_t stride   = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  const size_t num_rows = volume / stride;
+  const size_t blocks   = (num_rows + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+
+  auto stream = get_cached_stream();
+
+  // The input and output may alias, so the last input element of each row
+  // must be saved before an exclusive scan overwrites it
+  Buffer<VAL> last_buffer;
+  VAL* last_vals = nullptr;
+  if (sum_vals != nullptr && exclusive) {
+    last_buffer = create_buffer<VAL>(num_rows, Memory::Kind::GPU_FB_MEM);
+    last_vals   = last_buffer.ptr(0);
+    row_last_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(inptr, last_vals, num_rows, stride);
+  }
+
+  auto policy = DEFAULT_POLICY.on(stream);
+  auto keys   = thrust::make_transform_iterator(thrust::make_counting_iterator<size_t>(0),
+                                              row_key_func{stride});
+  if (num_rows == 1 && exclusive) {
+    thrust::exclusive_scan(policy, inptr, inptr + volume, outptr, OP::identity(), func);
+  } else if (num_rows == 1) {
+    thrust::inclusive_scan(policy, inptr, inptr + volume, outptr, func);
+  } else if (exclusive) {
+    thrust::exclusive_scan_by_key(policy,
+                                  keys,
+                                  keys + volume,
+                                  inptr,
+                                  outptr,
+                                  OP::identity(),
+                                  thrust::equal_to<size_t>{},
+                                  func);
+  } else {
+    thrust::inclusive_scan_by_key(
+      policy, keys, keys + volume, inptr, outptr, thrust::equal_to<size_t>{}, func);
+  }
+
+  if (sum_vals != nullptr) {
+    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+    extents[DIM - 1]   = 1;  // one element along scan axis
+
+    auto sum_valsptr = sum_vals->create_output_buffer<VAL, DIM>(extents, true);
+    row_sums_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+      func, outptr, last_vals, sum_valsptr, pitches, num_rows, stride);
+  }
+  CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
 }
 
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
@@ -47,35 +142,12 @@ struct ScanLocalImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    auto stream = get_cached_stream();
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        DEFAULT_POLICY.on(stream), inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      lazy_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(&outptr[index + stride - 1],
-                                                       &sum_valsptr[sum_valp]);
-    }
-    CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
+    scan_local_rows(func, in.ptr(rect.lo), out.ptr(rect.lo), sum_vals, pitches, rect, exclusive);
   }
 };
 
@@ -85,48 +157,24 @@ struct ScanLocalNanImplBody<VariantKind::GPU, OP_CODE, CODE, DIM> {
   using VAL = type_of<CODE>;
 
   struct convert_nan_func {
-    __device__ VAL operator()(VAL x)
-    {
-      return cupynumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
-    }
+    __device__ VAL operator()(VAL x) { return cupynumeric::is_nan(x) ? OP::identity() : x; }
   };
 
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    auto stream = get_cached_stream();
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        DEFAULT_POLICY.on(stream),
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      lazy_kernel<<<1, THREADS_PER_BLOCK, 0, stream>>>(&outptr[index + stride - 1],
-                                                       &sum_valsptr[sum_valp]);
-    }
-    CUPYNUMERIC_CHECK_CUDA_STREAM(stream);
+    scan_local_rows(func,
+                    thrust::make_transform_iterator(in.ptr(rect.lo), convert_nan_func()),
+                    out.ptr(rect.lo),
+                    sum_vals,
+                    pitches,
+                    rect,
+                    exclusive);
   }
 };
 
@@ -22,11 +22,15 @@
 namespace cupynumeric {
 
 struct ScanLocalArgs {
-  legate::PhysicalStore out;
-  legate::PhysicalStore in;
-  legate::PhysicalStore sum_vals;
+  legate::PhysicalStore out{nullptr};
+  legate::PhysicalStore in{nullptr};
+  // Per-row totals consumed by SCAN_GLOBAL. Only present when the scan axis is
+  // partitioned; otherwise each task scans whole rows and the result is final.
+  legate::PhysicalStore sum_vals{nullptr};
+  bool has_sum_vals;
   ScanCode op_code;
   bool nan_to_identity;
+  bool exclusive;
 };
 
 class ScanLocalTask : public CuPyNumericTask<ScanLocalTask> {
@@ -18,16 +18,121 @@
 #include "cupynumeric/scan/scan_local_template.inl"
 #include "cupynumeric/unary/isnan.h"
 
-#include <thrust/scan.h>
-#include <thrust/execution_policy.h>
 #include <thrust/iterator/transform_iterator.h>
-#include <thrust/system/omp/execution_policy.h>
 #include <omp.h>
 
 namespace cupynumeric {
 
 using namespace legate;
 
+// Rows shorter than this are never split between threads
+static constexpr size_t MIN_SCAN_BLOCK_SIZE = 1 << 14;
+
+// Scans `volume / stride` contiguous rows of length `stride` and stores the
+// total of each row in `row_totals` when it is not null. When there are
+// enough rows to keep every thread busy (or the rows are short), each thread
+// scans whole rows; otherwise every row is split into per-thread blocks and
+// scanned in two passes: a local scan of each block, then a fixup that folds
+// in the totals of the preceding blocks.
+template <typename OP, typename InputIt, typename VAL>
+static void omp_scan(OP func,
+                     InputIt inptr,
+                     VAL* outptr,
+                     size_t volume,
+                     size_t stride,
+                     bool exclusive,
+                     VAL* row_totals)
+{
+  const size_t num_rows    = volume / stride;
+  const size_t num_threads = omp_get_max_threads();
+
+  if (num_rows >= num_threads || stride < 2 * MIN_SCAN_BLOCK_SIZE) {
+#pragma omp parallel for schedule(static)
+    for (size_t row = 0; row < num_rows; ++row) {
+      auto total =
+        sequential_scan(func, inptr + row * stride, outptr + row * stride, stride, exclusive);
+      if (row_totals != nullptr) {
+        row_totals[row] = total;
+      }
+    }
+    return;
+  }
+
+  size_t num_blocks =
+    std::min(num_threads, (stride + MIN_SCAN_BLOCK_SIZE - 1) / MIN_SCAN_BLOCK_SIZE);
+  const size_t block_size = (stride + num_blocks - 1) / num_blocks;
+  num_blocks              = (stride + block_size - 1) / block_size;
+
+  auto block_totals = create_buffer<VAL>(num_blocks);
+  for (size_t row = 0; row < num_rows; ++row) {
+    auto row_in  = inptr + row * stride;
+    auto row_out = outptr + row * stride;
+
+#pragma omp parallel for schedule(static)
+    for (size_t block = 0; block < num_blocks; ++block) {
+      const size_t lo = block * block_size;
+      const size_t hi = std::min(lo + block_size, stride);
+      block_totals[block] = sequential_scan(func, row_in + lo, row_out + lo, hi - lo, exclusive);
+    }
+
+    for (size_t block = 1; block < num_blocks; ++block) {
+      block_totals[block] = func(block_totals[block - 1], block_totals[block]);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (size_t block = 1; block < num_blocks; ++block) {
+      const size_t lo  = block * block_size;
+      const size_t hi  = std::min(lo + block_size, stride);
+      const VAL prefix = block_totals[block - 1];
+      for (size_t idx = lo; idx < hi; ++idx) {
+        row_out[idx] = func(prefix, row_out[idx]);
+      }
+    }
+
+    if (row_totals != nullptr) {
+      row_totals[row] = block_totals[num_blocks - 1];
+    }
+  }
+}
+
+template <typename OP, typename InputIt, typename VAL, int DIM>
+static void scan_local_rows(OP func,
+                            InputIt inptr,
+                            VAL* outptr,
+                            legate::PhysicalStore* sum_vals,
+                            const Pitches<DIM - 1>& pitches,
+                            const Rect<DIM>& rect,
+                            bool exclusive)
+{
+  auto volume = rect.volume();
+  auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+
+  if (sum_vals == nullptr) {
+    // the scan axis is not partitioned, so the rows are already final
+    omp_scan(func, inptr, outptr, volume, stride, exclusive, static_cast<VAL*>(nullptr));
+    return;
+  }
+
+  const size_t num_rows = volume / stride;
+  auto row_totals       = create_buffer<VAL>(num_rows);
+  omp_scan(func, inptr, outptr, volume, stride, exclusive, row_totals.ptr(0));
+
+  Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+  extents[DIM - 1]   = 1;  // one element along scan axis
+
+  auto sum_valsptr = sum_vals->create_output_buffer<VAL, DIM>(extents, true);
+
+#pragma omp parallel for schedule(static)
+  for (size_t row = 0; row < num_rows; ++row) {
+    // get the corresponding ND index with base zero to use for sum_val
+    auto sum_valp = pitches.unflatten(row * stride, Point<DIM>::ZEROES());
+    // only one element on scan axis
+    sum_valp[DIM - 1] = 0;
+    // write out the partition sum
+    sum_valsptr[sum_valp] = row_totals[row];
+  }
+}
+
 template <ScanCode OP_CODE, Type::Code CODE, int DIM>
 struct ScanLocalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using OP  = ScanOp<OP_CODE, CODE>;
@@ -36,31 +141,12 @@ struct ScanLocalImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par, inptr + index, inptr + index + stride, outptr + index, func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
+    scan_local_rows(func, in.ptr(rect.lo), out.ptr(rect.lo), sum_vals, pitches, rect, exclusive);
   }
 };
 
@@ -70,44 +156,24 @@ struct ScanLocalNanImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using VAL = type_of<CODE>;
 
   struct convert_nan_func {
-    VAL operator()(VAL x) const
-    {
-      return cupynumeric::is_nan(x) ? (VAL)ScanOp<OP_CODE, CODE>::nan_identity : x;
-    }
+    VAL operator()(VAL x) const { return cupynumeric::is_nan(x) ? OP::identity() : x; }
   };
 
   void operator()(OP func,
                   const AccessorWO<VAL, DIM>& out,
                   const AccessorRO<VAL, DIM>& in,
-                  legate::PhysicalStore& sum_vals,
+                  legate::PhysicalStore* sum_vals,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool exclusive) const
   {
-    auto outptr = out.ptr(rect.lo);
-    auto inptr  = in.ptr(rect.lo);
-    auto volume = rect.volume();
-
-    auto stride = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
-
-    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
-    extents[DIM - 1]   = 1;  // one element along scan axis
-
-    auto sum_valsptr = sum_vals.create_output_buffer<VAL, DIM>(extents, true);
-
-    for (uint64_t index = 0; index < volume; index += stride) {
-      thrust::inclusive_scan(
-        thrust::omp::par,
-        thrust::make_transform_iterator(inptr + index, convert_nan_func()),
-        thrust::make_transform_iterator(inptr + index + stride, convert_nan_func()),
-        outptr + index,
-        func);
-      // get the corresponding ND index with base zero to use for sum_val
-      auto sum_valp = pitches.unflatten(index, Point<DIM>::ZEROES());
-      // only one element on scan axis
-      sum_valp[DIM - 1] = 0;
-      // write out the partition sum
-      sum_valsptr[sum_valp] = outptr[index + stride - 1];
-    }
+    scan_local_rows(func,
+                    thrust::make_transform_iterator(in.ptr(rect.lo), convert_nan_func()),
+                    out.ptr(rect.lo),
+                    sum_vals,
+                    pitches,
+                    rect,
+                    exclusive);
   }
 };
 
@@ -29,11 +29,14 @@ struct ScanLocalNanImplBody;
 
 template <VariantKind KIND, ScanCode OP_CODE, bool NAN_TO_IDENTITY>
 struct ScanLocalImpl {
+  template <Type::Code CODE>
+  static constexpr bool TRANSFORM_NANS =
+    NAN_TO_IDENTITY && (legate::is_floating_point<CODE>::value || legate::is_complex<CODE>::value);
+
   // Case where NANs are transformed
   template <Type::Code CODE,
             int DIM,
-            std::enable_if_t<NAN_TO_IDENTITY && (legate::is_floating_point<CODE>::value ||
-                                                 legate::is_complex<CODE>::value)>* = nullptr>
+            std::enable_if_t<ScanOp<OP_CODE, CODE>::valid && TRANSFORM_NANS<CODE>>* = nullptr>
   void operator()(ScanLocalArgs& args) const
   {
     using OP  = ScanOp<OP_CODE, CODE>;
@@ -45,7 +48,9 @@ struct ScanLocalImpl {
     size_t volume = pitches.flatten(rect);
 
     if (volume == 0) {
-      args.sum_vals.bind_empty_data();
+      if (args.has_sum_vals) {
+        args.sum_vals.bind_empty_data();
+      }
       return;
     }
 
@@ -53,13 +58,18 @@ struct ScanLocalImpl {
     auto in  = args.in.read_accessor<VAL, DIM>(rect);
 
     OP func;
-    ScanLocalNanImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+    ScanLocalNanImplBody<KIND, OP_CODE, CODE, DIM>()(func,
+                                                     out,
+                                                     in,
+                                                     args.has_sum_vals ? &args.sum_vals : nullptr,
+                                                     pitches,
+                                                     rect,
+                                                     args.exclusive);
   }
   // Case where NANs are as is
   template <Type::Code CODE,
             int DIM,
-            std::enable_if_t<!(NAN_TO_IDENTITY && (legate::is_floating_point<CODE>::value ||
-                                                   legate::is_complex<CODE>::value))>* = nullptr>
+            std::enable_if_t<ScanOp<OP_CODE, CODE>::valid && !TRANSFORM_NANS<CODE>>* = nullptr>
   void operator()(ScanLocalArgs& args) const
   {
     using OP  = ScanOp<OP_CODE, CODE>;
@@ -71,7 +81,9 @@ struct ScanLocalImpl {
     size_t volume = pitches.flatten(rect);
 
     if (volume == 0) {
-      args.sum_vals.bind_empty_data();
+      if (args.has_sum_vals) {
+        args.sum_vals.bind_empty_data();
+      }
       return;
     }
 
@@ -79,7 +91,19 @@ struct ScanLocalImpl {
     auto in  = args.in.read_accessor<VAL, DIM>(rect);
 
     OP func;
-    ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, args.sum_vals, pitches, rect);
+    ScanLocalImplBody<KIND, OP_CODE, CODE, DIM>()(func,
+                                                  out,
+                                                  in,
+                                                  args.has_sum_vals ? &args.sum_vals : nullptr,
+                                                  pitches,
+                                                  rect,
+                                                  args.exclusive);
+  }
+
+  template <Type::Code CODE, int DIM, std::enable_if_t<!ScanOp<OP_CODE, CODE>::valid>* = nullptr>
+  void operator()(ScanLocalArgs& args) const
+  {
+    assert(false);
   }
 };
 
@@ -96,11 +120,18 @@ struct ScanLocalDispatch {
 template <VariantKind KIND>
 static void scan_local_template(TaskContext& context)
 {
-  ScanLocalArgs args{context.output(0),
-                     context.input(0),
-                     context.output(1),
-                     context.scalar(0).value<ScanCode>(),
-                     context.scalar(1).value<bool>()};
+  auto outputs = context.outputs();
+
+  ScanLocalArgs args;
+  args.out          = std::move(outputs[0]);
+  args.in           = context.input(0);
+  args.has_sum_vals = outputs.size() > 1;
+  if (args.has_sum_vals) {
+    args.sum_vals = std::move(outputs[1]);
+  }
+  args.op_code         = context.scalar(0).value<ScanCode>();
+  args.nan_to_identity = context.scalar(1).value<bool>();
+  args.exclusive       = context.scalar(2).value<bool>();
   op_dispatch(args.op_code, args.nan_to_identity, ScanLocalDispatch<KIND>{}, args);
 }
 
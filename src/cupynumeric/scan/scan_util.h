@@ -17,20 +17,34 @@
 #pragma once
 
 #include "cupynumeric/cupynumeric_task.h"
+#include "cupynumeric/unary/isnan.h"
 
 #include <thrust/functional.h>
 
 namespace cupynumeric {
 
 enum class ScanCode : int {
-  PROD = CUPYNUMERIC_SCAN_PROD,
-  SUM  = CUPYNUMERIC_SCAN_SUM,
+  LOGICAL_AND = CUPYNUMERIC_SCAN_LOGICAL_AND,
+  LOGICAL_OR  = CUPYNUMERIC_SCAN_LOGICAL_OR,
+  LOGICAL_XOR = CUPYNUMERIC_SCAN_LOGICAL_XOR,
+  MAX         = CUPYNUMERIC_SCAN_MAX,
+  MIN         = CUPYNUMERIC_SCAN_MIN,
+  PROD        = CUPYNUMERIC_SCAN_PROD,
+  SUM         = CUPYNUMERIC_SCAN_SUM,
 };
 
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) op_dispatch(ScanCode op_code, Functor f, Fnargs&&... args)
 {
   switch (op_code) {
+    case ScanCode::LOGICAL_AND:
+      return f.template operator()<ScanCode::LOGICAL_AND>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGICAL_OR:
+      return f.template operator()<ScanCode::LOGICAL_OR>(std::forward<Fnargs>(args)...);
+    case ScanCode::LOGICAL_XOR:
+      return f.template operator()<ScanCode::LOGICAL_XOR>(std::forward<Fnargs>(args)...);
+    case ScanCode::MAX: return f.template operator()<ScanCode::MAX>(std::forward<Fnargs>(args)...);
+    case ScanCode::MIN: return f.template operator()<ScanCode::MIN>(std::forward<Fnargs>(args)...);
     case ScanCode::PROD:
       return f.template operator()<ScanCode::PROD>(std::forward<Fnargs>(args)...);
     case ScanCode::SUM: return f.template operator()<ScanCode::SUM>(std::forward<Fnargs>(args)...);
@@ -47,6 +61,36 @@ constexpr decltype(auto) op_dispatch(ScanCode op_code,
                                      Fnargs&&... args)
 {
   switch (op_code) {
+    case ScanCode::LOGICAL_AND:
+      if (nan_to_identity) {
+        return f.template operator()<ScanCode::LOGICAL_AND, true>(std::forward<Fnargs>(args)...);
+      } else {
+        return f.template operator()<ScanCode::LOGICAL_AND, false>(std::forward<Fnargs>(args)...);
+      }
+    case ScanCode::LOGICAL_OR:
+      if (nan_to_identity) {
+        return f.template operator()<ScanCode::LOGICAL_OR, true>(std::forward<Fnargs>(args)...);
+      } else {
+        return f.template operator()<ScanCode::LOGICAL_OR, false>(std::forward<Fnargs>(args)...);
+      }
+    case ScanCode::LOGICAL_XOR:
+      if (nan_to_identity) {
+        return f.template operator()<ScanCode::LOGICAL_XOR, true>(std::forward<Fnargs>(args)...);
+      } else {
+        return f.template operator()<ScanCode::LOGICAL_XOR, false>(std::forward<Fnargs>(args)...);
+      }
+    case ScanCode::MAX:
+      if (nan_to_identity) {
+        return f.template operator()<ScanCode::MAX, true>(std::forward<Fnargs>(args)...);
+      } else {
+        return f.template operator()<ScanCode::MAX, false>(std::forward<Fnargs>(args)...);
+      }
+    case ScanCode::MIN:
+      if (nan_to_identity) {
+        return f.template operator()<ScanCode::MIN, true>(std::forward<Fnargs>(args)...);
+      } else {
+        return f.template operator()<ScanCode::MIN, false>(std::forward<Fnargs>(args)...);
+      }
     case ScanCode::PROD:
       if (nan_to_identity) {
         return f.template operator()<ScanCode::PROD, true>(std::forward<Fnargs>(args)...);
@@ -65,26 +109,106 @@ constexpr decltype(auto) op_dispatch(ScanCode op_code,
   return f.template operator()<ScanCode::SUM, false>(std::forward<Fnargs>(args)...);
 }
 
+// Every scan operator is associative and exposes an identity, which seeds
+// exclusive scans and the fixup of the first partition along the scan axis.
+// NaNs are replaced by the identity in the nan-aware variants.
 template <ScanCode OP_CODE, legate::Type::Code CODE>
 struct ScanOp;
 
 template <legate::Type::Code CODE>
 struct ScanOp<ScanCode::SUM, CODE> : thrust::plus<legate::type_of<CODE>> {
-  using T                           = legate::type_of<CODE>;
-  static constexpr int nan_identity = 0;
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = true;
+  __CUDA_HD__ static T identity() { return T(0); }
 };
 
 template <legate::Type::Code CODE>
 struct ScanOp<ScanCode::PROD, CODE> : thrust::multiplies<legate::type_of<CODE>> {
-  using T                           = legate::type_of<CODE>;
-  static constexpr int nan_identity = 1;
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = true;
+  __CUDA_HD__ static T identity() { return T(1); }
 };
 
 template <>
 struct ScanOp<ScanCode::PROD, legate::Type::Code::BOOL> {
-  using T                            = bool;
-  static constexpr bool nan_identity = true;
+  using T                     = bool;
+  static constexpr bool valid = true;
+  __CUDA_HD__ static T identity() { return true; }
   constexpr T operator()(const bool& lhs, const bool& rhs) const { return lhs && rhs; }
 };
 
+// Like np.maximum and np.minimum, NaNs propagate through the running extremum
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::MAX, CODE> {
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = !legate::is_complex<CODE>::value;
+  __CUDA_HD__ static T identity() { return legate::MaxReduction<T>::identity; }
+  __CUDA_HD__ T operator()(const T& lhs, const T& rhs) const
+  {
+    return (is_nan(lhs) || lhs > rhs) ? lhs : rhs;
+  }
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::MIN, CODE> {
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = !legate::is_complex<CODE>::value;
+  __CUDA_HD__ static T identity() { return legate::MinReduction<T>::identity; }
+  __CUDA_HD__ T operator()(const T& lhs, const T& rhs) const
+  {
+    return (is_nan(lhs) || lhs < rhs) ? lhs : rhs;
+  }
+};
+
+// Logical scans always run on booleans; the Python layer converts the input
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_AND, CODE> {
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+  __CUDA_HD__ static T identity() { return true; }
+  constexpr T operator()(const T& lhs, const T& rhs) const { return lhs && rhs; }
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_OR, CODE> {
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+  __CUDA_HD__ static T identity() { return false; }
+  constexpr T operator()(const T& lhs, const T& rhs) const { return lhs || rhs; }
+};
+
+template <legate::Type::Code CODE>
+struct ScanOp<ScanCode::LOGICAL_XOR, CODE> {
+  using T                     = legate::type_of<CODE>;
+  static constexpr bool valid = CODE == legate::Type::Code::BOOL;
+  __CUDA_HD__ static T identity() { return false; }
+  constexpr T operator()(const T& lhs, const T& rhs) const { return lhs != rhs; }
+};
+
+// Sequential scan of a contiguous run of `n > 0` elements, inclusive or
+// exclusive. Returns the total of the run. Each input element is read before
+// the corresponding output is written, so `in` and `out` may alias. The CPU
+// and OpenMP variants use this as their building block and parallelize across
+// rows or row blocks.
+template <typename OP, typename InputIt, typename VAL>
+inline VAL sequential_scan(OP func, InputIt in, VAL* out, size_t n, bool exclusive)
+{
+  if (exclusive) {
+    VAL acc = OP::identity();
+    for (size_t idx = 0; idx < n; ++idx) {
+      const VAL val = in[idx];
+      out[idx]      = acc;
+      acc           = func(acc, val);
+    }
+    return acc;
+  }
+  VAL acc = in[0];
+  out[0]  = acc;
+  for (size_t idx = 1; idx < n; ++idx) {
+    acc      = func(acc, in[idx]);
+    out[idx] = acc;
+  }
+  return acc;
+}
+
 }  // namespace cupynumeric
@@ -58,6 +58,45 @@ struct NonzeroImplBody<VariantKind::CPU, CODE, DIM> {
   }
 };
 
+template <int32_t DIM>
+struct NonzeroPackedImplBody<VariantKind::CPU, DIM> {
+  void operator()(std::vector<Array>& outputs,
+                  const PackedMaskRO<DIM>& mask,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const size_t volume)
+  {
+    const int64_t row_bytes = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const size_t rows       = volume / row_bytes;
+
+    int64_t size = 0;
+    for (size_t row = 0; row < rows; ++row) {
+      auto p = pitches.unflatten(row * row_bytes, rect.lo);
+      p[DIM - 1] *= 8;
+      size += mask.count(p, row_bytes * 8);
+    }
+
+    std::vector<Buffer<int64_t>> results;
+    for (auto& output : outputs) {
+      results.push_back(output.create_output_buffer<int64_t, 1>(Point<1>(size), true));
+    }
+
+    int64_t out_idx = 0;
+    for (size_t row = 0; row < rows; ++row) {
+      auto p = pitches.unflatten(row * row_bytes, rect.lo);
+      p[DIM - 1] *= 8;
+      mask.for_each_set(p, row_bytes * 8, [&](int64_t k) {
+        for (int32_t dim = 0; dim < DIM - 1; ++dim) {
+          results[dim][out_idx] = p[dim];
+        }
+        results[DIM - 1][out_idx] = p[DIM - 1] + k;
+        ++out_idx;
+      });
+    }
+    assert(size == out_idx);
+  }
+};
+
 /*static*/ void NonzeroTask::cpu_variant(TaskContext context)
 {
   nonzero_template<VariantKind::CPU>(context);
@@ -88,6 +88,85 @@ struct NonzeroImplBody<VariantKind::OMP, CODE, DIM> {
   }
 };
 
+template <int32_t DIM>
+struct NonzeroPackedImplBody<VariantKind::OMP, DIM> {
+  void operator()(std::vector<Array>& outputs,
+                  const PackedMaskRO<DIM>& mask,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const size_t volume)
+  {
+    const auto max_threads = omp_get_max_threads();
+
+    // Rows are split into chunks so that one-dimensional masks also spread across threads
+    const int64_t row_bytes   = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const int64_t chunk_bytes = PACKED_MASK_CHUNK / 8;
+    const int64_t chunks      = (row_bytes + chunk_bytes - 1) / chunk_bytes;
+    const size_t num_work     = volume / row_bytes * chunks;
+
+    // First element of chunk idx, whose number of elements goes to n
+    auto chunk_start = [&](size_t idx, int64_t& n) {
+      const int64_t lo = static_cast<int64_t>(idx % chunks) * chunk_bytes;
+      auto p           = pitches.unflatten(idx / chunks * row_bytes, rect.lo);
+      p[DIM - 1]       = (p[DIM - 1] + lo) * 8;
+      n                = std::min(chunk_bytes, row_bytes - lo) * 8;
+      return p;
+    };
+
+    int64_t size = 0;
+    ThreadLocalStorage<int64_t> offsets(max_threads);
+
+    {
+      ThreadLocalStorage<int64_t> sizes(max_threads);
+      for (auto idx = 0; idx < max_threads; ++idx) {
+        sizes[idx] = 0;
+      }
+#pragma omp parallel
+      {
+        const int tid = omp_get_thread_num();
+#pragma omp for schedule(static)
+        for (size_t idx = 0; idx < num_work; ++idx) {
+          int64_t n = 0;
+          auto p    = chunk_start(idx, n);
+          sizes[tid] += mask.count(p, n);
+        }
+      }
+
+      for (auto idx = 0; idx < max_threads; ++idx) {
+        size += sizes[idx];
+      }
+
+      offsets[0] = 0;
+      for (auto idx = 1; idx < max_threads; ++idx) {
+        offsets[idx] = offsets[idx - 1] + sizes[idx - 1];
+      }
+    }
+
+    std::vector<Buffer<int64_t>> results;
+    for (auto& output : outputs) {
+      results.push_back(output.create_output_buffer<int64_t, 1>(Point<1>(size), true));
+    }
+
+#pragma omp parallel
+    {
+      const int tid   = omp_get_thread_num();
+      int64_t out_idx = offsets[tid];
+#pragma omp for schedule(static)
+      for (size_t idx = 0; idx < num_work; ++idx) {
+        int64_t n = 0;
+        auto p    = chunk_start(idx, n);
+        mask.for_each_set(p, n, [&](int64_t k) {
+          for (int32_t dim = 0; dim < DIM - 1; ++dim) {
+            results[dim][out_idx] = p[dim];
+          }
+          results[DIM - 1][out_idx] = p[DIM - 1] + k;
+          ++out_idx;
+        });
+      }
+    }
+  }
+};
+
 /*static*/ void NonzeroTask::omp_variant(TaskContext context)
 {
   nonzero_template<VariantKind::OMP>(context);
@@ -18,6 +18,7 @@
 
 // Useful for IDEs
 #include "cupynumeric/search/nonzero.h"
+#include "cupynumeric/bits/packed_mask.h"
 #include "cupynumeric/pitches.h"
 
 namespace cupynumeric {
@@ -27,6 +28,9 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE, int32_t DIM>
 struct NonzeroImplBody;
 
+template <VariantKind KIND, int32_t DIM>
+struct NonzeroPackedImplBody;
+
 template <VariantKind KIND>
 struct NonzeroImpl {
   template <Type::Code CODE, int32_t DIM>
@@ -51,6 +55,30 @@ struct NonzeroImpl {
   }
 };
 
+template <VariantKind KIND>
+struct NonzeroPackedImpl {
+  template <int32_t DIM>
+  void operator()(NonzeroArgs& args) const
+  {
+    // The rectangle of the packed bytes; element coordinates along the last axis are 8 times
+    // larger, and the padding bits past the end of a row are never set
+    auto rect = args.input.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    if (volume == 0) {
+      for (auto& store : args.results) {
+        store.bind_empty_data();
+      }
+      return;
+    }
+
+    PackedMaskRO<DIM> mask{args.input};
+    NonzeroPackedImplBody<KIND, DIM>()(args.results, mask, pitches, rect, volume);
+  }
+};
+
 template <VariantKind KIND>
 static void nonzero_template(TaskContext& context)
 {
@@ -59,6 +87,15 @@ static void nonzero_template(TaskContext& context)
     outputs.emplace_back(output);
   }
   NonzeroArgs args{context.input(0), std::move(outputs)};
+  // Set when the input is a bit-packed mask (see bits/packed_mask.h)
+  auto packed = context.scalar(0).value<bool>();
+  if constexpr (KIND != VariantKind::GPU) {
+    if (packed) {
+      dim_dispatch(args.input.dim(), NonzeroPackedImpl<KIND>{}, args);
+      return;
+    }
+  }
+  assert(!packed);
   double_dispatch(args.input.dim(), args.input.code(), NonzeroImpl<KIND>{}, args);
 }
 
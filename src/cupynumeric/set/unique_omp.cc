@@ -53,7 +53,7 @@ struct UniqueImplBody<VariantKind::OMP, CODE, DIM> {
     size_t remaining = max_threads;
     size_t radix     = (max_threads + 1) / 2;
     while (remaining > 1) {
-#pragma omp for schedule(static, 1)
+#pragma omp parallel for schedule(static, 1)
       for (size_t idx = 0; idx < radix; ++idx) {
         if (idx + radix < remaining) {
           auto& my_set    = dedup_set[idx];
@@ -0,0 +1,57 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/sparse/csr_halo.h"
+#include "cupynumeric/sparse/csr_halo_template.inl"
+
+#include <algorithm>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <int32_t DIM>
+struct CsrHaloImplBody<VariantKind::OMP, DIM> {
+  void operator()(const AccessorWO<Rect<DIM>, 1>& halo,
+                  const AccessorRO<Rect<1>, 1>& pos,
+                  const AccessorRO<int64_t, 1>& crd,
+                  const Rect<1>& rect,
+                  int64_t width) const
+  {
+#pragma omp parallel for schedule(static)
+    for (int64_t row = rect.lo[0]; row <= rect.hi[0]; ++row) {
+      const auto& nnz = pos[row];
+      if (nnz.empty()) {
+        halo[row] = make_halo<DIM>(1, 0, width);
+        continue;
+      }
+      int64_t lo = crd[nnz.lo];
+      int64_t hi = lo;
+      for (int64_t idx = nnz.lo[0] + 1; idx <= nnz.hi[0]; ++idx) {
+        lo = std::min(lo, crd[idx]);
+        hi = std::max(hi, crd[idx]);
+      }
+      halo[row] = make_halo<DIM>(lo, hi, width);
+    }
+  }
+};
+
+/*static*/ void CsrHaloTask::omp_variant(TaskContext context)
+{
+  csr_halo_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,78 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/sparse/csr_halo.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <VariantKind KIND, int32_t DIM>
+struct CsrHaloImplBody;
+
+// The range of rows of the right-hand side of a product that a row of a CSR matrix reads, i.e.,
+// the span of its column indices. An image constraint over these ranges gives each task exactly
+// the halo of x (or of the rows of X, when DIM is 2 and `width` columns are read per row) that its
+// block of rows needs.
+template <int32_t DIM>
+inline Rect<DIM> make_halo(int64_t lo, int64_t hi, int64_t width)
+{
+  if constexpr (DIM == 1) {
+    return Rect<1>(lo, hi);
+  } else {
+    return Rect<2>(Point<2>(lo, 0), Point<2>(hi, width - 1));
+  }
+}
+
+template <VariantKind KIND>
+struct CsrHaloImpl {
+  template <int32_t DIM>
+  void operator()(legate::PhysicalStore output,
+                  legate::PhysicalStore pos_store,
+                  legate::PhysicalStore crd_store,
+                  int64_t width) const
+  {
+    auto rect = output.shape<1>();
+    if (rect.empty()) {
+      return;
+    }
+
+    auto halo = output.write_accessor<Rect<DIM>, 1>(rect);
+    auto pos  = pos_store.read_accessor<Rect<1>, 1>(rect);
+    auto crd  = crd_store.read_accessor<int64_t, 1>();
+    CsrHaloImplBody<KIND, DIM>{}(halo, pos, crd, rect, width);
+  }
+};
+
+template <VariantKind KIND>
+static void csr_halo_template(TaskContext& context)
+{
+  legate::PhysicalStore output = context.output(0);
+  legate::PhysicalStore pos    = context.input(0);
+  legate::PhysicalStore crd    = context.input(1);
+  auto width                   = context.scalar(0).value<int64_t>();
+
+  if (width == 0) {
+    CsrHaloImpl<KIND>{}.template operator()<1>(output, pos, crd, width);
+  } else {
+    CsrHaloImpl<KIND>{}.template operator()<2>(output, pos, crd, width);
+  }
+}
+
+}  // namespace cupynumeric
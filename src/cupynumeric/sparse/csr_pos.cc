@@ -0,0 +1,47 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/sparse/csr_pos.h"
+#include "cupynumeric/sparse/csr_pos_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <>
+struct CsrPosImplBody<VariantKind::CPU> {
+  void operator()(const AccessorWO<Rect<1>, 1>& pos,
+                  const AccessorRO<int64_t, 1>& starts,
+                  const AccessorRO<int64_t, 1>& stops,
+                  const Rect<1>& rect) const
+  {
+    for (int64_t row = rect.lo[0]; row <= rect.hi[0]; ++row) {
+      pos[row] = Rect<1>(starts[row], stops[row] - 1);
+    }
+  }
+};
+
+/*static*/ void CsrPosTask::cpu_variant(TaskContext context)
+{
+  csr_pos_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { CsrPosTask::register_variants(); }
+}  // namespace
+
+}  // namespace cupynumeric
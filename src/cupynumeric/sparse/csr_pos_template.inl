@@ -0,0 +1,49 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/sparse/csr_pos.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <VariantKind KIND>
+struct CsrPosImplBody;
+
+// Turns the row pointers of a CSR matrix into one range of nonzeros per row. The ranges are what
+// the image constraints of the sparse tasks partition the column indices and values with.
+template <VariantKind KIND>
+static void csr_pos_template(TaskContext& context)
+{
+  legate::PhysicalStore output = context.output(0);
+  legate::PhysicalStore lo     = context.input(0);
+  legate::PhysicalStore hi     = context.input(1);
+
+  auto rect = output.shape<1>();
+  if (rect.empty()) {
+    return;
+  }
+
+  auto pos    = output.write_accessor<Rect<1>, 1>(rect);
+  auto starts = lo.read_accessor<int64_t, 1>(rect);
+  auto stops  = hi.read_accessor<int64_t, 1>(rect);
+  CsrPosImplBody<KIND>{}(pos, starts, stops, rect);
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,74 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "legate.h"
+
+#include <type_traits>
+
+namespace cupynumeric {
+
+// Value types of CSR matrices
+template <legate::Type::Code CODE>
+struct support_sparse : std::false_type {};
+template <>
+struct support_sparse<legate::Type::Code::FLOAT32> : std::true_type {};
+template <>
+struct support_sparse<legate::Type::Code::FLOAT64> : std::true_type {};
+template <>
+struct support_sparse<legate::Type::Code::COMPLEX64> : std::true_type {};
+template <>
+struct support_sparse<legate::Type::Code::COMPLEX128> : std::true_type {};
+
+// How many nonzeros ahead of the current one the SpMV and SpMM loops prefetch the right-hand
+// side. Column indices within a row are gathered from arbitrary places in x, which the hardware
+// prefetchers cannot predict.
+constexpr int64_t SPARSE_PREFETCH_DISTANCE = 16;
+
+// Splits the rows [row_lo, row_hi] into `num_blocks` contiguous blocks holding about the same
+// number of nonzeros, and returns the first row of block `block`. `nnz` maps a row to its range of
+// nonzeros. Splitting by rows alone would leave the threads that get the dense rows of a
+// power-law matrix with most of the work.
+template <typename NNZ>
+int64_t nnz_balanced_row_split(
+  NNZ&& nnz, int64_t row_lo, int64_t row_hi, int64_t block, int64_t num_blocks)
+{
+  if (block <= 0) {
+    return row_lo;
+  }
+  if (block >= num_blocks) {
+    return row_hi + 1;
+  }
+  // Rows are stored in order, so the ranges are sorted and the first row past the target
+  // number of nonzeros can be binary searched
+  const int64_t first  = nnz(row_lo).lo[0];
+  const int64_t last   = nnz(row_hi).hi[0] + 1;
+  const int64_t target = first + (last - first) * block / num_blocks;
+  int64_t lo           = row_lo;
+  int64_t hi           = row_hi + 1;
+  while (lo < hi) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    if (nnz(mid).lo[0] < target) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,54 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/sparse/spmm.h"
+#include "cupynumeric/sparse/spmm_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct SpmmImplBody<VariantKind::CPU, CODE> {
+  using VAL = type_of<CODE>;
+
+  void operator()(const AccessorWO<VAL, 2>& y,
+                  const AccessorRO<Rect<1>, 2>& pos,
+                  const AccessorRO<int64_t, 1>& crd,
+                  const AccessorRO<VAL, 1>& vals,
+                  const AccessorRO<VAL, 2>& x,
+                  const Rect<2>& rect) const
+  {
+    const int64_t col         = rect.lo[1];
+    const int64_t prefetch_hi = pos[Point<2>(rect.hi[0], col)].hi[0];
+    std::vector<VAL> acc(rect.hi[1] - col + 1);
+    for (int64_t row = rect.lo[0]; row <= rect.hi[0]; ++row) {
+      spmm_row(y, crd, vals, x, acc.data(), pos[Point<2>(row, col)], row, rect, prefetch_hi);
+    }
+  }
+};
+
+/*static*/ void SpmmTask::cpu_variant(TaskContext context)
+{
+  spmm_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { SpmmTask::register_variants(); }
+}  // namespace
+
+}  // namespace cupynumeric
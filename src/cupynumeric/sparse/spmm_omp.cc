@@ -0,0 +1,64 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/sparse/spmm.h"
+#include "cupynumeric/sparse/spmm_template.inl"
+
+#include <omp.h>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct SpmmImplBody<VariantKind::OMP, CODE> {
+  using VAL = type_of<CODE>;
+
+  void operator()(const AccessorWO<VAL, 2>& y,
+                  const AccessorRO<Rect<1>, 2>& pos,
+                  const AccessorRO<int64_t, 1>& crd,
+                  const AccessorRO<VAL, 1>& vals,
+                  const AccessorRO<VAL, 2>& x,
+                  const Rect<2>& rect) const
+  {
+    const int64_t col = rect.lo[1];
+    // Same nnz-balanced row blocks as SPMV
+#pragma omp parallel
+    {
+      const int64_t num_threads = omp_get_num_threads();
+      const int64_t tid         = omp_get_thread_num();
+      auto nnz                  = [&pos, col](int64_t row) { return pos[Point<2>(row, col)]; };
+      const int64_t row_lo =
+        nnz_balanced_row_split(nnz, rect.lo[0], rect.hi[0], tid, num_threads);
+      const int64_t row_hi =
+        nnz_balanced_row_split(nnz, rect.lo[0], rect.hi[0], tid + 1, num_threads) - 1;
+      if (row_lo <= row_hi) {
+        const int64_t prefetch_hi = nnz(row_hi).hi[0];
+        std::vector<VAL> acc(rect.hi[1] - col + 1);
+        for (int64_t row = row_lo; row <= row_hi; ++row) {
+          spmm_row(y, crd, vals, x, acc.data(), nnz(row), row, rect, prefetch_hi);
+        }
+      }
+    }
+  }
+};
+
+/*static*/ void SpmmTask::omp_variant(TaskContext context)
+{
+  spmm_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cupynumeric
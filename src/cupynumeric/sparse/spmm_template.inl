@@ -0,0 +1,116 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/sparse/spmm.h"
+#include "cupynumeric/sparse/sparse_util.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cupynumeric {
+
+using namespace legate;
+
+struct SpmmArgs {
+  legate::PhysicalStore y{nullptr};
+  legate::PhysicalStore pos{nullptr};
+  legate::PhysicalStore crd{nullptr};
+  legate::PhysicalStore vals{nullptr};
+  legate::PhysicalStore x{nullptr};
+};
+
+template <VariantKind KIND, Type::Code CODE>
+struct SpmmImplBody;
+
+template <VariantKind KIND>
+struct SpmmImpl {
+  template <Type::Code CODE, std::enable_if_t<support_sparse<CODE>::value>* = nullptr>
+  void operator()(SpmmArgs& args) const
+  {
+    using VAL = type_of<CODE>;
+
+    auto rect = args.y.shape<2>();
+    if (rect.empty()) {
+      return;
+    }
+
+    auto y    = args.y.write_accessor<VAL, 2>(rect);
+    auto pos  = args.pos.read_accessor<Rect<1>, 2>(rect);
+    auto crd  = args.crd.read_accessor<int64_t, 1>();
+    auto vals = args.vals.read_accessor<VAL, 1>();
+    auto x    = args.x.read_accessor<VAL, 2>();
+    SpmmImplBody<KIND, CODE>{}(y, pos, crd, vals, x, rect);
+  }
+
+  template <Type::Code CODE, std::enable_if_t<!support_sparse<CODE>::value>* = nullptr>
+  void operator()(SpmmArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+// Y = A X for a CSR matrix A, over the rows of Y in this task; the columns of Y and X are never
+// partitioned. The inputs are laid out as for SPMV, except that the row ranges and halos are
+// promoted to the shape of Y.
+template <VariantKind KIND>
+static void spmm_template(TaskContext& context)
+{
+  SpmmArgs args;
+  args.y    = context.output(0);
+  args.pos  = context.input(0);
+  args.crd  = context.input(2);
+  args.vals = context.input(3);
+  args.x    = context.input(4);
+
+  type_dispatch(args.y.code(), SpmmImpl<KIND>{}, args);
+}
+
+// Computes one row of Y into `acc`, which holds one element per column of Y, and then writes it
+// out. The row is accumulated one nonzero at a time, so the inner loop runs along a row of X,
+// contiguous in the row-major layout.
+template <typename VAL>
+inline void spmm_row(const AccessorWO<VAL, 2>& y,
+                     const AccessorRO<int64_t, 1>& crd,
+                     const AccessorRO<VAL, 1>& vals,
+                     const AccessorRO<VAL, 2>& x,
+                     VAL* acc,
+                     const Rect<1>& nnz,
+                     int64_t row,
+                     const Rect<2>& rect,
+                     int64_t prefetch_hi)
+{
+  const int64_t col_lo   = rect.lo[1];
+  const int64_t num_cols = rect.hi[1] - col_lo + 1;
+  std::fill(acc, acc + num_cols, VAL{0});
+  for (int64_t idx = nnz.lo[0]; idx <= nnz.hi[0]; ++idx) {
+    if (idx + SPARSE_PREFETCH_DISTANCE <= prefetch_hi) {
+      __builtin_prefetch(&x[Point<2>(crd[idx + SPARSE_PREFETCH_DISTANCE], col_lo)]);
+    }
+    const auto val    = vals[idx];
+    const int64_t src = crd[idx];
+    for (int64_t col = 0; col < num_cols; ++col) {
+      acc[col] += val * x[Point<2>(src, col_lo + col)];
+    }
+  }
+  for (int64_t col = 0; col < num_cols; ++col) {
+    y[Point<2>(row, col_lo + col)] = acc[col];
+  }
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,54 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/sparse/spmv.h"
+#include "cupynumeric/sparse/spmv_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+template <Type::Code CODE>
+struct SpmvImplBody<VariantKind::CPU, CODE> {
+  using VAL = type_of<CODE>;
+
+  void operator()(const AccessorWO<VAL, 1>& y,
+                  const AccessorRO<Rect<1>, 1>& pos,
+                  const AccessorRO<int64_t, 1>& crd,
+                  const AccessorRO<VAL, 1>& vals,
+                  const AccessorRO<VAL, 1>& x,
+                  const Rect<1>& rect) const
+  {
+    // The nonzeros of consecutive rows are contiguous, so the prefetches may run ahead into the
+    // next rows up to the last nonzero of the block
+    const int64_t prefetch_hi = pos[rect.hi].hi[0];
+    for (int64_t row = rect.lo[0]; row <= rect.hi[0]; ++row) {
+      y[row] = spmv_row(crd, vals, x, pos[row], prefetch_hi);
+    }
+  }
+};
+
+/*static*/ void SpmvTask::cpu_variant(TaskContext context)
+{
+  spmv_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { SpmvTask::register_variants(); }
+}  // namespace
+
+}  // namespace cupynumeric
@@ -0,0 +1,101 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/sparse/spmv.h"
+#include "cupynumeric/sparse/sparse_util.h"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+struct SpmvArgs {
+  legate::PhysicalStore y{nullptr};
+  legate::PhysicalStore pos{nullptr};
+  legate::PhysicalStore crd{nullptr};
+  legate::PhysicalStore vals{nullptr};
+  legate::PhysicalStore x{nullptr};
+};
+
+template <VariantKind KIND, Type::Code CODE>
+struct SpmvImplBody;
+
+template <VariantKind KIND>
+struct SpmvImpl {
+  template <Type::Code CODE, std::enable_if_t<support_sparse<CODE>::value>* = nullptr>
+  void operator()(SpmvArgs& args) const
+  {
+    using VAL = type_of<CODE>;
+
+    auto rect = args.y.shape<1>();
+    if (rect.empty()) {
+      return;
+    }
+
+    // The column indices, values and x are partitioned by images, so only the elements named by
+    // this block of rows are valid in them
+    auto y    = args.y.write_accessor<VAL, 1>(rect);
+    auto pos  = args.pos.read_accessor<Rect<1>, 1>(rect);
+    auto crd  = args.crd.read_accessor<int64_t, 1>();
+    auto vals = args.vals.read_accessor<VAL, 1>();
+    auto x    = args.x.read_accessor<VAL, 1>();
+    SpmvImplBody<KIND, CODE>{}(y, pos, crd, vals, x, rect);
+  }
+
+  template <Type::Code CODE, std::enable_if_t<!support_sparse<CODE>::value>* = nullptr>
+  void operator()(SpmvArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+// y = A x for a CSR matrix A, over the rows of y in this task. The inputs are, in order, the
+// nonzero range of every row, the column halo of every row (only used for partitioning x), the
+// column indices, the values and x.
+template <VariantKind KIND>
+static void spmv_template(TaskContext& context)
+{
+  SpmvArgs args;
+  args.y    = context.output(0);
+  args.pos  = context.input(0);
+  args.crd  = context.input(2);
+  args.vals = context.input(3);
+  args.x    = context.input(4);
+
+  type_dispatch(args.y.code(), SpmvImpl<KIND>{}, args);
+}
+
+// The dot product of a row of A with x
+template <typename VAL>
+inline VAL spmv_row(const AccessorRO<int64_t, 1>& crd,
+                    const AccessorRO<VAL, 1>& vals,
+                    const AccessorRO<VAL, 1>& x,
+                    const Rect<1>& nnz,
+                    int64_t prefetch_hi)
+{
+  VAL sum{0};
+  for (int64_t idx = nnz.lo[0]; idx <= nnz.hi[0]; ++idx) {
+    if (idx + SPARSE_PREFETCH_DISTANCE <= prefetch_hi) {
+      __builtin_prefetch(&x[crd[idx + SPARSE_PREFETCH_DISTANCE]]);
+    }
+    sum += vals[idx] * x[crd[idx]];
+  }
+  return sum;
+}
+
+}  // namespace cupynumeric
@@ -16,7 +16,9 @@
 
 #include "cupynumeric/stat/bincount.h"
 #include "cupynumeric/stat/bincount_template.inl"
+#include "cupynumeric/utilities/scratch_arena.h"
 
+#include <algorithm>
 #include <omp.h>
 
 namespace cupynumeric {
@@ -27,55 +29,47 @@ template <Type::Code CODE>
 struct BincountImplBody<VariantKind::OMP, CODE> {
   using VAL = type_of<CODE>;
 
-  std::vector<std::vector<int64_t>> _bincount(const AccessorRO<VAL, 1>& rhs,
-                                              const Rect<1>& rect,
-                                              const Rect<1>& lhs_rect) const
+  // Accumulates into one private row of bins per thread and then reduces the rows into `lhs`.
+  // The rows come from the scratch arena, so repeated calls with similar bin counts reuse them.
+  // Each row starts on its own cache line, so that threads updating neighbouring rows never
+  // share one.
+  template <typename BIN, typename WeightFn>
+  void _bincount(AccessorRD<SumReduction<BIN>, true, 1> lhs,
+                 const AccessorRO<VAL, 1>& rhs,
+                 const Rect<1>& rect,
+                 const Rect<1>& lhs_rect,
+                 WeightFn&& weight) const
   {
     const int max_threads   = omp_get_max_threads();
     const size_t lhs_volume = lhs_rect.volume();
-    std::vector<std::vector<int64_t>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<int64_t>::identity;
-      local_bins = std::vector<int64_t>(lhs_volume, init);
-    }
+    // Arena blocks are cache line aligned, so padding the rows keeps every row aligned too
+    constexpr size_t CACHE_LINE_BYTES = 64;
+    constexpr size_t BINS_PER_LINE    = std::max<size_t>(CACHE_LINE_BYTES / sizeof(BIN), 1);
+    const size_t stride = (lhs_volume + BINS_PER_LINE - 1) / BINS_PER_LINE * BINS_PER_LINE;
+    ScratchBuffer<BIN> all_local_bins(max_threads * stride);
+    int num_threads = 1;
 #pragma omp parallel
     {
-      auto tid                         = omp_get_thread_num();
-      std::vector<int64_t>& local_bins = all_local_bins[tid];
+      const auto tid = omp_get_thread_num();
+#pragma omp single
+      num_threads = omp_get_num_threads();
+      // Each thread initializes its own row so that, in a newly allocated block, the row is
+      // first touched, and thus placed, on the NUMA node of the thread that updates it
+      BIN* local_bins = all_local_bins.ptr() + tid * stride;
+      std::fill(local_bins, local_bins + lhs_volume, SumReduction<BIN>::identity);
 #pragma omp for schedule(static)
       for (int64_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
         auto value = rhs[idx];
         assert(lhs_rect.contains(value));
-        SumReduction<int64_t>::fold<true>(local_bins[value], 1);
+        SumReduction<BIN>::template fold<true>(local_bins[value], weight(idx));
       }
     }
-    return all_local_bins;
-  }
-
-  std::vector<std::vector<double>> _bincount(const AccessorRO<VAL, 1>& rhs,
-                                             const AccessorRO<double, 1>& weights,
-                                             const Rect<1>& rect,
-                                             const Rect<1>& lhs_rect) const
-  {
-    const int max_threads   = omp_get_max_threads();
-    const size_t lhs_volume = lhs_rect.volume();
-    std::vector<std::vector<double>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<double>::identity;
-      local_bins = std::vector<double>(lhs_volume, init);
-    }
-#pragma omp parallel
-    {
-      auto tid                        = omp_get_thread_num();
-      std::vector<double>& local_bins = all_local_bins[tid];
-#pragma omp for schedule(static)
-      for (int64_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
-        auto value = rhs[idx];
-        assert(lhs_rect.contains(value));
-        SumReduction<double>::fold<true>(local_bins[value], weights[idx]);
+    for (int tid = 0; tid < num_threads; ++tid) {
+      const BIN* local_bins = all_local_bins.ptr() + tid * stride;
+      for (size_t bin_num = 0; bin_num < lhs_volume; ++bin_num) {
+        lhs.reduce(bin_num, local_bins[bin_num]);
       }
     }
-    return all_local_bins;
   }
 
   void operator()(AccessorRD<SumReduction<int64_t>, true, 1> lhs,
@@ -83,12 +77,7 @@ struct BincountImplBody<VariantKind::OMP, CODE> {
                   const Rect<1>& rect,
                   const Rect<1>& lhs_rect) const
   {
-    auto all_local_bins = _bincount(rhs, rect, lhs_rect);
-    for (auto& local_bins : all_local_bins) {
-      for (size_t bin_num = 0; bin_num < local_bins.size(); ++bin_num) {
-        lhs.reduce(bin_num, local_bins[bin_num]);
-      }
-    }
+    _bincount(lhs, rhs, rect, lhs_rect, [](int64_t) { return int64_t{1}; });
   }
 
   void operator()(AccessorRD<SumReduction<double>, true, 1> lhs,
@@ -97,12 +86,7 @@ struct BincountImplBody<VariantKind::OMP, CODE> {
                   const Rect<1>& rect,
                   const Rect<1>& lhs_rect) const
   {
-    auto all_local_bins = _bincount(rhs, weights, rect, lhs_rect);
-    for (auto& local_bins : all_local_bins) {
-      for (size_t bin_num = 0; bin_num < local_bins.size(); ++bin_num) {
-        lhs.reduce(bin_num, local_bins[bin_num]);
-      }
-    }
+    _bincount(lhs, rhs, rect, lhs_rect, [&weights](int64_t idx) { return weights[idx]; });
   }
 };
 
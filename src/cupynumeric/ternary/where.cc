@@ -52,6 +52,27 @@ struct WhereImplBody<VariantKind::CPU, CODE, DIM> {
   }
 };
 
+template <Type::Code CODE, int DIM>
+struct WherePackedImplBody<VariantKind::CPU, CODE, DIM> {
+  using VAL = type_of<CODE>;
+
+  void operator()(AccessorWO<VAL, DIM> out,
+                  const PackedMaskRO<DIM>& mask,
+                  AccessorRO<VAL, DIM> in1,
+                  AccessorRO<VAL, DIM> in2,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    const int64_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const size_t rows     = rect.volume() / row_len;
+    for (size_t row = 0; row < rows; ++row) {
+      auto p = pitches.unflatten(row * row_len, rect.lo);
+      where_packed_row(out, mask, in1, in2, p, row_len, dense);
+    }
+  }
+};
+
 /*static*/ void WhereTask::cpu_variant(TaskContext context)
 {
   where_template<VariantKind::CPU>(context);
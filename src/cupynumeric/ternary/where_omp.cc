@@ -54,6 +54,32 @@ struct WhereImplBody<VariantKind::OMP, CODE, DIM> {
   }
 };
 
+template <Type::Code CODE, int DIM>
+struct WherePackedImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = type_of<CODE>;
+
+  void operator()(AccessorWO<VAL, DIM> out,
+                  const PackedMaskRO<DIM>& mask,
+                  AccessorRO<VAL, DIM> in1,
+                  AccessorRO<VAL, DIM> in2,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  bool dense) const
+  {
+    const int64_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+    const int64_t chunks  = (row_len + PACKED_MASK_CHUNK - 1) / PACKED_MASK_CHUNK;
+    const size_t num_work = rect.volume() / row_len * chunks;
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < num_work; ++idx) {
+      const int64_t lo = static_cast<int64_t>(idx % chunks) * PACKED_MASK_CHUNK;
+      auto p           = pitches.unflatten(idx / chunks * row_len, rect.lo);
+      p[DIM - 1] += lo;
+      where_packed_row(
+        out, mask, in1, in2, p, std::min(PACKED_MASK_CHUNK, row_len - lo), dense);
+    }
+  }
+};
+
 /*static*/ void WhereTask::omp_variant(TaskContext context)
 {
   where_template<VariantKind::OMP>(context);
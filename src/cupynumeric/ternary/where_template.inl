@@ -18,7 +18,9 @@
 
 // Useful for IDEs
 #include "cupynumeric/ternary/where.h"
+#include "cupynumeric/bits/packed_mask.h"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -27,6 +29,40 @@ using namespace legate;
 template <VariantKind KIND, Type::Code CODE, int DIM>
 struct WhereImplBody;
 
+template <VariantKind KIND, Type::Code CODE, int DIM>
+struct WherePackedImplBody;
+
+// Fills the `n` elements that start at `p` along the last axis from in2, then overwrites the
+// ones selected by the packed mask with those of in1
+template <typename VAL, int DIM>
+inline void where_packed_row(const AccessorWO<VAL, DIM>& out,
+                             const PackedMaskRO<DIM>& mask,
+                             const AccessorRO<VAL, DIM>& in1,
+                             const AccessorRO<VAL, DIM>& in2,
+                             Point<DIM> p,
+                             int64_t n,
+                             bool dense)
+{
+  if (dense) {
+    auto outptr = out.ptr(p);
+    auto in1ptr = in1.ptr(p);
+    auto in2ptr = in2.ptr(p);
+    std::copy(in2ptr, in2ptr + n, outptr);
+    mask.for_each_set(p, n, [&](int64_t k) { outptr[k] = in1ptr[k]; });
+  } else {
+    const int64_t lo = p[DIM - 1];
+    for (int64_t k = 0; k < n; ++k) {
+      p[DIM - 1] = lo + k;
+      out[p]     = in2[p];
+    }
+    p[DIM - 1] = lo;
+    mask.for_each_set(p, n, [&](int64_t k) {
+      p[DIM - 1] = lo + k;
+      out[p]     = in1[p];
+    });
+  }
+}
+
 template <VariantKind KIND>
 struct WhereImpl {
   template <Type::Code CODE, int DIM>
@@ -43,10 +79,27 @@ struct WhereImpl {
       return;
     }
 
-    auto out  = args.out.write_accessor<VAL, DIM>(rect);
+    auto out = args.out.write_accessor<VAL, DIM>(rect);
+    auto in1 = args.in1.read_accessor<VAL, DIM>(rect);
+    auto in2 = args.in2.read_accessor<VAL, DIM>(rect);
+
+    if constexpr (KIND != VariantKind::GPU) {
+      if (is_packed_mask(args.mask)) {
+#if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
+        bool dense = out.accessor.is_dense_row_major(rect) &&
+                     in1.accessor.is_dense_row_major(rect) &&
+                     in2.accessor.is_dense_row_major(rect);
+#else
+        bool dense = false;
+#endif
+        PerfScope::note_dense(dense);
+        PackedMaskRO<DIM> mask{args.mask};
+        WherePackedImplBody<KIND, CODE, DIM>()(out, mask, in1, in2, pitches, rect, dense);
+        return;
+      }
+    }
+
     auto mask = args.mask.read_accessor<bool, DIM>(rect);
-    auto in1  = args.in1.read_accessor<VAL, DIM>(rect);
-    auto in2  = args.in2.read_accessor<VAL, DIM>(rect);
 
 #if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
     // Check to see if this is dense or not
@@ -56,6 +109,7 @@ struct WhereImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     WhereImplBody<KIND, CODE, DIM>()(out, mask, in1, in2, pitches, rect, dense);
   }
@@ -64,6 +118,7 @@ struct WhereImpl {
 template <VariantKind KIND>
 static void where_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_WHERE, KIND};
   auto inputs = context.inputs();
   WhereArgs args{context.output(0), inputs[0], inputs[1], inputs[2]};
   auto dim = std::max(1, args.out.dim());
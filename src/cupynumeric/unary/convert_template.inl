@@ -20,6 +20,7 @@
 #include "cupynumeric/unary/convert.h"
 #include "cupynumeric/pitches.h"
 #include "cupynumeric/unary/convert_util.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -56,6 +57,7 @@ struct ConvertImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     OP func{};
     ConvertImplBody<KIND, NAN_OP, DST_TYPE, SRC_TYPE, DIM>()(func, out, in, pitches, rect, dense);
@@ -102,6 +104,7 @@ struct SourceTypeDispatch {
 template <VariantKind KIND>
 static void convert_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_CONVERT, KIND};
   ConvertArgs args{context.output(0), context.input(0), context.scalar(0).value<ConvertCode>()};
   type_dispatch(args.in.code(), SourceTypeDispatch<KIND>{}, args);
 }
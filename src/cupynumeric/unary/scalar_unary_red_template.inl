@@ -21,8 +21,10 @@
 #include "cupynumeric/cupynumeric_task.h"
 #include "cupynumeric/unary/scalar_unary_red.h"
 #include "cupynumeric/unary/unary_red_util.h"
+#include "cupynumeric/bits/packed_mask.h"
 #include "cupynumeric/pitches.h"
 #include "cupynumeric/execution_policy/reduction/scalar_reduction.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -47,15 +49,55 @@ struct ScalarUnaryRed {
   Point<DIM> origin;
   Point<DIM> shape;
   RHS to_find;
-  RHS mu;
   bool dense;
+  bool pairwise;
   WHERE where;
   const bool* whereptr;
+  // Set when the where mask is bit-packed (see bits/packed_mask.h), which only CPU and OpenMP
+  // variants receive
+  bool packed;
+  PackedMaskRO<DIM> packed_where;
 
-  struct DenseReduction {};
-  struct SparseReduction {};
+  // Masked and NaN-skipping reductions do uneven work per point, so they ask the OpenMP
+  // policy for dynamic scheduling
+  static constexpr bool IRREGULAR =
+    HAS_WHERE || OP_CODE == UnaryRedCode::NANARGMAX || OP_CODE == UnaryRedCode::NANARGMIN ||
+    OP_CODE == UnaryRedCode::NANMAX || OP_CODE == UnaryRedCode::NANMIN ||
+    OP_CODE == UnaryRedCode::NANPROD || OP_CODE == UnaryRedCode::NANSUM;
 
-  ScalarUnaryRed(ScalarUnaryRedArgs& args) : dense(false)
+  struct DenseReduction {
+    static constexpr bool DYNAMIC = IRREGULAR;
+  };
+  struct SparseReduction {
+    static constexpr bool DYNAMIC = IRREGULAR;
+  };
+  struct DenseArgReduction {
+    static constexpr bool RANGE = true;
+  };
+  struct DensePairwiseReduction {
+    static constexpr bool RANGE = true;
+  };
+  struct DensePackedReduction {
+    static constexpr bool RANGE = true;
+  };
+
+  // Floating-point sums over a dense range can be computed pairwise: the range is halved
+  // until it has at most PAIRWISE_BLOCK_SIZE points, which are accumulated in PAIRWISE_LANES
+  // independent partial sums. Like numpy's summation, this bounds the rounding error by
+  // O(log n) rather than O(n), and the lanes keep the inner loop vectorizable.
+  static constexpr bool PAIRWISE =
+    (OP_CODE == UnaryRedCode::SUM || OP_CODE == UnaryRedCode::SUM_SQUARES ||
+     OP_CODE == UnaryRedCode::NANSUM) &&
+    (legate::is_floating_point<CODE>::value || legate::is_complex<CODE>::value);
+  static constexpr size_t PAIRWISE_BLOCK_SIZE = 128;
+  static constexpr size_t PAIRWISE_LANES      = 8;
+
+  // The answer to contains/any is known after the first hit and that of all after the first miss
+  static constexpr bool SHORT_CIRCUIT = OP_CODE == UnaryRedCode::CONTAINS ||
+                                        OP_CODE == UnaryRedCode::ANY ||
+                                        OP_CODE == UnaryRedCode::ALL;
+
+  ScalarUnaryRed(ScalarUnaryRedArgs& args) : dense(false), pairwise(false), packed(false)
   {
     rect   = args.in.shape<DIM>();
     origin = rect.lo;
@@ -67,12 +109,20 @@ struct ScalarUnaryRed {
     if constexpr (OP_CODE == UnaryRedCode::CONTAINS) {
       to_find = args.args[0].value<RHS>();
     }
-    if constexpr (OP_CODE == UnaryRedCode::VARIANCE) {
-      mu = args.args[0].value<RHS>();
+    if constexpr (PAIRWISE) {
+      // Callers that do not pass the flag get pairwise summation
+      pairwise = args.args.empty() || args.args.back().value<bool>();
     }
 
     if constexpr (HAS_WHERE) {
-      where = args.where.read_accessor<bool, DIM>(rect);
+      if constexpr (KIND != VariantKind::GPU) {
+        packed = is_packed_mask(args.where);
+      }
+      if (packed) {
+        packed_where = PackedMaskRO<DIM>{args.where};
+      } else {
+        where = args.where.read_accessor<bool, DIM>(rect);
+      }
     }
 #if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
     // Check to see if this is dense or not
@@ -81,12 +131,15 @@ struct ScalarUnaryRed {
       inptr = in.ptr(rect);
     }
     if constexpr (HAS_WHERE) {
-      dense = dense && where.accessor.is_dense_row_major(rect);
-      if (dense) {
-        whereptr = where.ptr(rect);
+      if (!packed) {
+        dense = dense && where.accessor.is_dense_row_major(rect);
+        if (dense) {
+          whereptr = where.ptr(rect);
+        }
       }
     }
 #endif
+    PerfScope::note_dense(dense);
   }
 
   __CUDA_HD__ void operator()(LHS& lhs, size_t idx, LHS identity, DenseReduction) const noexcept
@@ -100,16 +153,6 @@ struct ScalarUnaryRed {
       if (mask && (inptr[idx] == to_find)) {
         lhs = true;
       }
-    } else if constexpr (OP_CODE == UnaryRedCode::ARGMAX || OP_CODE == UnaryRedCode::ARGMIN ||
-                         OP_CODE == UnaryRedCode::NANARGMAX || OP_CODE == UnaryRedCode::NANARGMIN) {
-      auto p = pitches.unflatten(idx, origin);
-      if (mask) {
-        OP::template fold<true>(lhs, OP::convert(p, shape, identity, inptr[idx]));
-      }
-    } else if constexpr (OP_CODE == UnaryRedCode::VARIANCE) {
-      if (mask) {
-        OP::template fold<true>(lhs, OP::convert(inptr[idx] - mu, identity));
-      }
     } else {
       if (mask) {
         OP::template fold<true>(lhs, OP::convert(inptr[idx], identity));
@@ -122,7 +165,7 @@ struct ScalarUnaryRed {
     auto p    = pitches.unflatten(idx, origin);
     bool mask = true;
     if constexpr (HAS_WHERE) {
-      mask = where[p];
+      mask = packed ? packed_where[p] : where[p];
     }
 
     if constexpr (OP_CODE == UnaryRedCode::CONTAINS) {
@@ -134,10 +177,6 @@ struct ScalarUnaryRed {
       if (mask) {
         OP::template fold<true>(lhs, OP::convert(p, shape, identity, in[p]));
       }
-    } else if constexpr (OP_CODE == UnaryRedCode::VARIANCE) {
-      if (mask) {
-        OP::template fold<true>(lhs, OP::convert(in[p] - mu, identity));
-      }
     } else {
       if (mask) {
         OP::template fold<true>(lhs, OP::convert(in[p], identity));
@@ -145,6 +184,117 @@ struct ScalarUnaryRed {
     }
   }
 
+  // Arg reductions over a dense range only need the winning value and its offset, so the
+  // offset is turned into a global index once per range rather than once per point. The
+  // comparison is the same one Argval::apply uses, which keeps the first of equal values.
+  void operator()(LHS& lhs, size_t lo, size_t hi, LHS identity, DenseArgReduction) const noexcept
+  {
+    using REDOP = std::conditional_t<OP_CODE == UnaryRedCode::ARGMAX ||
+                                       OP_CODE == UnaryRedCode::NANARGMAX,
+                                     legate::MaxReduction<RHS>,
+                                     legate::MinReduction<RHS>>;
+
+    auto best     = identity.arg_value;
+    auto best_idx = hi;
+    for (size_t idx = lo; idx < hi; ++idx) {
+      if constexpr (HAS_WHERE) {
+        if (!whereptr[idx]) {
+          continue;
+        }
+      }
+      const RHS value = inptr[idx];
+      if constexpr (OP_CODE == UnaryRedCode::NANARGMAX || OP_CODE == UnaryRedCode::NANARGMIN) {
+        if (is_nan(value)) {
+          continue;
+        }
+      }
+      auto copy = best;
+      REDOP::template fold<true>(copy, value);
+      if (copy != best) {
+        best     = copy;
+        best_idx = idx;
+      }
+    }
+    if (best_idx != hi) {
+      OP::template fold<true>(
+        lhs, OP::convert(pitches.unflatten(best_idx, origin), shape, identity, best));
+    }
+  }
+
+  void operator()(LHS& lhs,
+                  size_t lo,
+                  size_t hi,
+                  LHS identity,
+                  DensePairwiseReduction) const noexcept
+  {
+    OP::template fold<true>(lhs, pairwise_sum(lo, hi, identity));
+  }
+
+  // With a bit-packed mask, a dense range is walked one row segment at a time and only the
+  // selected points are visited
+  void operator()(LHS& lhs, size_t lo, size_t hi, LHS identity, DensePackedReduction) const noexcept
+  {
+    size_t idx = lo;
+    while (idx < hi) {
+      auto p         = pitches.unflatten(idx, origin);
+      const size_t n = std::min<size_t>(hi - idx, rect.hi[DIM - 1] - p[DIM - 1] + 1);
+      packed_where.for_each_set(p, n, [&](int64_t k) {
+        const size_t point = idx + k;
+        if constexpr (OP_CODE == UnaryRedCode::CONTAINS) {
+          if (inptr[point] == to_find) {
+            lhs = true;
+          }
+        } else if constexpr (is_arg_reduce<OP_CODE>::value) {
+          OP::template fold<true>(
+            lhs, OP::convert(pitches.unflatten(point, origin), shape, identity, inptr[point]));
+        } else {
+          OP::template fold<true>(lhs, OP::convert(inptr[point], identity));
+        }
+      });
+      idx += n;
+    }
+  }
+
+  LHS pairwise_sum(size_t lo, size_t hi, LHS identity) const noexcept
+  {
+    if (hi - lo > PAIRWISE_BLOCK_SIZE) {
+      // Split on a multiple of the lane count so that the blocks stay aligned
+      const size_t mid = lo + (hi - lo) / 2 / PAIRWISE_LANES * PAIRWISE_LANES;
+      auto result      = pairwise_sum(lo, mid, identity);
+      OP::template fold<true>(result, pairwise_sum(mid, hi, identity));
+      return result;
+    }
+
+    LHS lanes[PAIRWISE_LANES];
+    for (auto& lane : lanes) {
+      lane = identity;
+    }
+    size_t idx = lo;
+    for (; idx + PAIRWISE_LANES <= hi; idx += PAIRWISE_LANES) {
+      for (size_t lane = 0; lane < PAIRWISE_LANES; ++lane) {
+        (*this)(lanes[lane], idx + lane, identity, DenseReduction{});
+      }
+    }
+    for (; idx < hi; ++idx) {
+      (*this)(lanes[0], idx, identity, DenseReduction{});
+    }
+    for (size_t width = PAIRWISE_LANES / 2; width > 0; width /= 2) {
+      for (size_t lane = 0; lane < width; ++lane) {
+        OP::template fold<true>(lanes[lane], lanes[lane + width]);
+      }
+    }
+    return lanes[0];
+  }
+
+  __CUDA_HD__ bool done(const LHS& lhs) const noexcept
+  {
+    if constexpr (OP_CODE == UnaryRedCode::ALL) {
+      return !lhs;
+    } else {
+      return lhs;
+    }
+  }
+
   void execute() const noexcept
   {
     auto identity = LG_OP::identity;
@@ -154,7 +304,24 @@ struct ScalarUnaryRed {
     if constexpr (KIND != VariantKind::GPU) {
       // Check to see if this is dense or not
       if (dense) {
-        return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(volume, out, identity, *this);
+        if constexpr (HAS_WHERE) {
+          if (packed) {
+            return ScalarReductionPolicy<KIND, LG_OP, DensePackedReduction>()(
+              volume, out, identity, *this);
+          }
+        }
+        if constexpr (is_arg_reduce<OP_CODE>::value) {
+          return ScalarReductionPolicy<KIND, LG_OP, DenseArgReduction>()(
+            volume, out, identity, *this);
+        } else if constexpr (PAIRWISE) {
+          if (pairwise) {
+            return ScalarReductionPolicy<KIND, LG_OP, DensePairwiseReduction>()(
+              volume, out, identity, *this);
+          }
+          return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(volume, out, identity, *this);
+        } else {
+          return ScalarReductionPolicy<KIND, LG_OP, DenseReduction>()(volume, out, identity, *this);
+        }
       }
     }
 #endif
@@ -192,6 +359,7 @@ struct ScalarUnaryRedDispatch {
 template <VariantKind KIND>
 static void scalar_unary_red_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_SCALAR_UNARY_RED, KIND};
   const auto num_scalars = context.num_scalars();
   auto op_code           = context.scalar(0).value<UnaryRedCode>();
   auto shape             = context.scalar(1).value<DomainPoint>();
@@ -19,6 +19,7 @@
 // Useful for IDEs
 #include "cupynumeric/unary/unary_op.h"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -61,6 +62,7 @@ struct UnaryOpImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     OP func{args.args};
     UnaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(func, out, in, pitches, rect, dense);
@@ -106,6 +108,7 @@ struct MultiOutUnaryOpImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     OP func{};
     MultiOutUnaryOpImplBody<KIND, OP_CODE, CODE, DIM>()(
@@ -159,6 +162,7 @@ struct UnaryCopyImpl {
     // No dense execution if we're doing bounds checks
     bool dense = false;
 #endif
+    PerfScope::note_dense(dense);
 
     PointCopyImplBody<KIND, VAL, DIM>()(out, in, pitches, rect, dense);
   }
@@ -174,7 +178,9 @@ struct UnaryOpDispatch {
       auto type = args.in.type().as_fixed_array_type();
       cupynumeric::double_dispatch(dim, type.num_elements(), UnaryCopyImpl<KIND>{}, args);
     } else {
-      auto code = OP_CODE == UnaryOpCode::GETARG ? args.out.code() : args.in.code();
+      auto code = OP_CODE == UnaryOpCode::GETARG || OP_CODE == UnaryOpCode::GETM2
+                    ? args.out.code()
+                    : args.in.code();
       legate::double_dispatch(dim, code, UnaryOpImpl<KIND, OP_CODE>{}, args);
     }
   }
@@ -183,6 +189,7 @@ struct UnaryOpDispatch {
 template <VariantKind KIND>
 static void unary_op_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_UNARY_OP, KIND};
   auto op_code = context.scalar(0).value<UnaryOpCode>();
   switch (op_code) {
     case UnaryOpCode::FREXP: {
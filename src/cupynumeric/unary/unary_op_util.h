@@ -19,6 +19,7 @@
 #include "cupynumeric/cupynumeric_task.h"
 #include "cupynumeric/arg.h"
 #include "cupynumeric/arg.inl"
+#include "cupynumeric/welford.h"
 
 #ifdef __NVCC__
 #include "thrust/complex.h"
@@ -54,6 +55,7 @@ enum class UnaryOpCode : int {
   FLOOR       = CUPYNUMERIC_UOP_FLOOR,
   FREXP       = CUPYNUMERIC_UOP_FREXP,
   GETARG      = CUPYNUMERIC_UOP_GETARG,
+  GETM2       = CUPYNUMERIC_UOP_GETM2,
   IMAG        = CUPYNUMERIC_UOP_IMAG,
   INVERT      = CUPYNUMERIC_UOP_INVERT,
   ISFINITE    = CUPYNUMERIC_UOP_ISFINITE,
@@ -129,6 +131,8 @@ constexpr decltype(auto) op_dispatch(UnaryOpCode op_code, Functor f, Fnargs&&...
       return f.template operator()<UnaryOpCode::FLOOR>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::GETARG:
       return f.template operator()<UnaryOpCode::GETARG>(std::forward<Fnargs>(args)...);
+    case UnaryOpCode::GETM2:
+      return f.template operator()<UnaryOpCode::GETM2>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::IMAG:
       return f.template operator()<UnaryOpCode::IMAG>(std::forward<Fnargs>(args)...);
     case UnaryOpCode::INVERT:
@@ -667,6 +671,17 @@ struct UnaryOp<UnaryOpCode::GETARG, CODE> {
   constexpr decltype(auto) operator()(const T& x) const { return x.arg; }
 };
 
+template <legate::Type::Code CODE>
+struct UnaryOp<UnaryOpCode::GETM2, CODE> {
+  using T = WelfordVal<legate::type_of<CODE>>;
+  static constexpr bool valid =
+    CODE == legate::Type::Code::FLOAT32 || CODE == legate::Type::Code::FLOAT64;
+
+  UnaryOp(const std::vector<legate::Scalar>& args) {}
+
+  constexpr decltype(auto) operator()(const T& x) const { return x.m2; }
+};
+
 template <legate::Type::Code CODE>
 struct UnaryOp<UnaryOpCode::IMAG, CODE> {
   using T                     = legate::type_of<CODE>;
@@ -16,6 +16,7 @@
 
 #include "cupynumeric/unary/unary_red.h"
 #include "cupynumeric/unary/unary_red_template.inl"
+#include "cupynumeric/unary/unary_red_cpu.inl"
 
 namespace cupynumeric {
 
@@ -23,9 +24,11 @@ using namespace legate;
 
 template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM, bool HAS_WHERE>
 struct UnaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM, HAS_WHERE> {
-  using OP    = UnaryRedOp<OP_CODE, CODE>;
-  using LG_OP = typename OP::OP;
-  using RHS   = type_of<CODE>;
+  using OP     = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP  = typename OP::OP;
+  using RHS    = type_of<CODE>;
+  using ENGINE = UnaryRedEngine<OP_CODE, CODE, DIM, HAS_WHERE>;
+  using VAL    = typename ENGINE::VAL;
 
   void operator()(AccessorRD<LG_OP, true, DIM> lhs,
                   AccessorRO<RHS, DIM> rhs,
@@ -33,17 +36,69 @@ struct UnaryRedImplBody<VariantKind::CPU, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
-                  size_t volume) const
+                  size_t volume,
+                  bool dense) const
   {
-    for (size_t idx = 0; idx < volume; ++idx) {
-      auto point = pitches.unflatten(idx, rect.lo);
-      bool mask  = true;
-      if constexpr (HAS_WHERE) {
-        mask = where[point];
+    if (!dense) {
+      for (size_t idx = 0; idx < volume; ++idx) {
+        auto point = pitches.unflatten(idx, rect.lo);
+        bool mask  = true;
+        if constexpr (HAS_WHERE) {
+          mask = where[point];
+        }
+        if (mask) {
+          auto identity = LG_OP::identity;
+          lhs.reduce(point, OP::convert(point, collapsed_dim, identity, rhs[point]));
+        }
       }
-      if (mask) {
-        auto identity = LG_OP::identity;
-        lhs.reduce(point, OP::convert(point, collapsed_dim, identity, rhs[point]));
+      return;
+    }
+
+    UnaryRedLayout<DIM> layout(rect, collapsed_dim);
+    const size_t slab    = layout.extent * layout.inner;
+    auto inptr           = rhs.ptr(rect);
+    const bool* whereptr = nullptr;
+    if constexpr (HAS_WHERE) {
+      whereptr = where.ptr(rect);
+    }
+
+    if (layout.inner == 1) {
+      // Reducing along the innermost dimension: each output is a contiguous row
+      for (size_t outer = 0; outer < layout.outer; ++outer) {
+        auto point = pitches.unflatten(outer * slab, rect.lo);
+        auto acc   = ENGINE::fold_row(inptr + outer * slab,
+                                      HAS_WHERE ? whereptr + outer * slab : nullptr,
+                                      0,
+                                      layout.extent,
+                                      point,
+                                      collapsed_dim);
+        lhs.reduce(point, acc);
+      }
+      return;
+    }
+
+    // Reducing along an outer dimension: sweep whole rows of the input into a
+    // tile of output accumulators
+    auto tile = create_buffer<VAL>(std::min(layout.inner, UNARY_RED_TILE_SIZE));
+    for (size_t outer = 0; outer < layout.outer; ++outer) {
+      for (size_t col = 0; col < layout.inner; col += UNARY_RED_TILE_SIZE) {
+        const size_t width = std::min(layout.inner - col, UNARY_RED_TILE_SIZE);
+        for (size_t idx = 0; idx < width; ++idx) {
+          tile[idx] = LG_OP::identity;
+        }
+        ENGINE::fold_tile(tile.ptr(0),
+                          inptr + outer * slab,
+                          HAS_WHERE ? whereptr + outer * slab : nullptr,
+                          0,
+                          layout.extent,
+                          layout.inner,
+                          col,
+                          width,
+                          pitches.unflatten(outer * slab + col, rect.lo),
+                          collapsed_dim);
+        for (size_t idx = 0; idx < width; ++idx) {
+          lhs.reduce(pitches.unflatten(outer * slab + col + idx, rect.lo), tile[idx]);
+        }
       }
     }
   }
@@ -0,0 +1,117 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cupynumeric/unary/unary_red.h"
+#include "cupynumeric/unary/unary_red_template.inl"
+
+namespace cupynumeric {
+
+using namespace legate;
+
+// Number of outputs accumulated together when reducing over a non-innermost
+// dimension. The tile stays in L1 while the rows of the input stream past it.
+static constexpr size_t UNARY_RED_TILE_SIZE = 1024;
+
+// A dense input viewed as [outer, extent, inner], where `extent` is the size
+// of the collapsed dimension, `outer` the volume of the dimensions before it,
+// and `inner` the volume of the dimensions after it
+template <int DIM>
+struct UnaryRedLayout {
+  UnaryRedLayout(const Rect<DIM>& rect, int collapsed_dim)
+  {
+    for (int dim = 0; dim < DIM; ++dim) {
+      size_t diff = rect.hi[dim] - rect.lo[dim] + 1;
+      if (dim < collapsed_dim) {
+        outer *= diff;
+      } else if (dim == collapsed_dim) {
+        extent = diff;
+      } else {
+        inner *= diff;
+      }
+    }
+  }
+
+  size_t outer{1};
+  size_t extent{1};
+  size_t inner{1};
+};
+
+// The engines below fold contiguous runs of the input into local
+// accumulators and touch the reduction accessor only once per output.
+// UnaryRedOp::convert only looks at the coordinate along the collapsed
+// dimension, so that is the only coordinate of `point` the engines update.
+template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM, bool HAS_WHERE>
+struct UnaryRedEngine {
+  using OP    = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP = typename OP::OP;
+  using RHS   = type_of<CODE>;
+  using VAL   = typename LG_OP::RHS;
+
+  // Folds elements [lo, hi) of a contiguous row
+  static VAL fold_row(const RHS* in,
+                      const bool* where,
+                      size_t lo,
+                      size_t hi,
+                      Point<DIM> point,
+                      int collapsed_dim)
+  {
+    const auto base = point[collapsed_dim];
+    VAL acc         = LG_OP::identity;
+    for (size_t idx = lo; idx < hi; ++idx) {
+      if constexpr (HAS_WHERE) {
+        if (!where[idx]) {
+          continue;
+        }
+      }
+      point[collapsed_dim] = base + idx;
+      LG_OP::template fold<true>(acc, OP::convert(point, collapsed_dim, LG_OP::identity, in[idx]));
+    }
+    return acc;
+  }
+
+  // Folds rows [lo, hi) of an [extent, inner] slab into `tile`, which holds
+  // the accumulators for columns [col, col + width)
+  static void fold_tile(VAL* tile,
+                        const RHS* in,
+                        const bool* where,
+                        size_t lo,
+                        size_t hi,
+                        size_t inner,
+                        size_t col,
+                        size_t width,
+                        Point<DIM> point,
+                        int collapsed_dim)
+  {
+    const auto base = point[collapsed_dim];
+    for (size_t row = lo; row < hi; ++row) {
+      point[collapsed_dim] = base + row;
+      const size_t offset  = row * inner + col;
+      for (size_t idx = 0; idx < width; ++idx) {
+        if constexpr (HAS_WHERE) {
+          if (!where[offset + idx]) {
+            continue;
+          }
+        }
+        LG_OP::template fold<true>(
+          tile[idx], OP::convert(point, collapsed_dim, LG_OP::identity, in[offset + idx]));
+      }
+    }
+  }
+};
+
+}  // namespace cupynumeric
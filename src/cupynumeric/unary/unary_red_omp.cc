@@ -16,6 +16,9 @@
 
 #include "cupynumeric/unary/unary_red.h"
 #include "cupynumeric/unary/unary_red_template.inl"
+#include "cupynumeric/unary/unary_red_cpu.inl"
+
+#include <omp.h>
 
 namespace cupynumeric {
 
@@ -73,11 +76,16 @@ class Splitter {
   size_t pitches_[DIM];
 };
 
+// Runs shorter than this many elements are never split between threads
+static constexpr size_t MIN_REDUCTION_CHUNK_SIZE = 1 << 14;
+
 template <UnaryRedCode OP_CODE, Type::Code CODE, int DIM, bool HAS_WHERE>
 struct UnaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM, HAS_WHERE> {
-  using OP    = UnaryRedOp<OP_CODE, CODE>;
-  using LG_OP = typename OP::OP;
-  using RHS   = type_of<CODE>;
+  using OP     = UnaryRedOp<OP_CODE, CODE>;
+  using LG_OP  = typename OP::OP;
+  using RHS    = type_of<CODE>;
+  using ENGINE = UnaryRedEngine<OP_CODE, CODE, DIM, HAS_WHERE>;
+  using VAL    = typename ENGINE::VAL;
 
   void operator()(AccessorRD<LG_OP, true, DIM> lhs,
                   AccessorRO<RHS, DIM> rhs,
@@ -85,7 +93,175 @@ struct UnaryRedImplBody<VariantKind::OMP, OP_CODE, CODE, DIM, HAS_WHERE> {
                   const Rect<DIM>& rect,
                   const Pitches<DIM - 1>& pitches,
                   int collapsed_dim,
-                  size_t volume) const
+                  size_t volume,
+                  bool dense) const
+  {
+    if (!dense) {
+      reduce_sparse(lhs, rhs, where, rect, collapsed_dim);
+      return;
+    }
+
+    UnaryRedLayout<DIM> layout(rect, collapsed_dim);
+    auto inptr           = rhs.ptr(rect);
+    const bool* whereptr = nullptr;
+    if constexpr (HAS_WHERE) {
+      whereptr = where.ptr(rect);
+    }
+
+    if (layout.inner == 1) {
+      reduce_rows(lhs, inptr, whereptr, rect, pitches, layout, collapsed_dim);
+    } else {
+      reduce_tiles(lhs, inptr, whereptr, rect, pitches, layout, collapsed_dim);
+    }
+  }
+
+  // Reduces along the innermost dimension, where each output is a contiguous
+  // row. Rows are handed out to threads whole when there are enough of them;
+  // otherwise each row is split into chunks whose partial results are folded
+  // in order, so ties in arg reductions resolve as in the sequential case.
+  void reduce_rows(AccessorRD<LG_OP, true, DIM>& lhs,
+                   const RHS* inptr,
+                   const bool* whereptr,
+                   const Rect<DIM>& rect,
+                   const Pitches<DIM - 1>& pitches,
+                   const UnaryRedLayout<DIM>& layout,
+                   int collapsed_dim) const
+  {
+    const size_t num_threads = omp_get_max_threads();
+    const size_t stride      = layout.extent;
+
+    if (layout.outer >= num_threads || stride < 2 * MIN_REDUCTION_CHUNK_SIZE) {
+#pragma omp parallel for schedule(static)
+      for (size_t outer = 0; outer < layout.outer; ++outer) {
+        auto point = pitches.unflatten(outer * stride, rect.lo);
+        auto acc   = ENGINE::fold_row(inptr + outer * stride,
+                                      HAS_WHERE ? whereptr + outer * stride : nullptr,
+                                      0,
+                                      stride,
+                                      point,
+                                      collapsed_dim);
+        lhs.reduce(point, acc);
+      }
+      return;
+    }
+
+    const size_t num_chunks =
+      std::min(num_threads, (stride + MIN_REDUCTION_CHUNK_SIZE - 1) / MIN_REDUCTION_CHUNK_SIZE);
+    const size_t chunk_size = (stride + num_chunks - 1) / num_chunks;
+    auto partials           = create_buffer<VAL>(num_chunks);
+
+    for (size_t outer = 0; outer < layout.outer; ++outer) {
+      auto point = pitches.unflatten(outer * stride, rect.lo);
+#pragma omp parallel for schedule(static)
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const size_t lo = std::min(chunk * chunk_size, stride);
+        const size_t hi = std::min(lo + chunk_size, stride);
+        partials[chunk] = ENGINE::fold_row(inptr + outer * stride,
+                                           HAS_WHERE ? whereptr + outer * stride : nullptr,
+                                           lo,
+                                           hi,
+                                           point,
+                                           collapsed_dim);
+      }
+      VAL acc = partials[0];
+      for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+        LG_OP::template fold<true>(acc, partials[chunk]);
+      }
+      lhs.reduce(point, acc);
+    }
+  }
+
+  // Reduces along an outer dimension by sweeping whole rows of the input into
+  // tiles of output accumulators. Each (outer, tile) pair is independent; when
+  // there are too few of them to keep every thread busy, the reduced
+  // dimension is split as well and the partial tiles are folded in order.
+  void reduce_tiles(AccessorRD<LG_OP, true, DIM>& lhs,
+                    const RHS* inptr,
+                    const bool* whereptr,
+                    const Rect<DIM>& rect,
+                    const Pitches<DIM - 1>& pitches,
+                    const UnaryRedLayout<DIM>& layout,
+                    int collapsed_dim) const
+  {
+    const size_t num_threads = omp_get_max_threads();
+    const size_t slab        = layout.extent * layout.inner;
+    const size_t tile_size   = std::min(layout.inner, UNARY_RED_TILE_SIZE);
+    const size_t num_tiles   = (layout.inner + tile_size - 1) / tile_size;
+    const size_t num_items   = layout.outer * num_tiles;
+
+    if (num_items >= num_threads || slab < 2 * MIN_REDUCTION_CHUNK_SIZE) {
+      auto tiles = create_buffer<VAL>(num_threads * tile_size);
+#pragma omp parallel for schedule(static)
+      for (size_t item = 0; item < num_items; ++item) {
+        const size_t outer = item / num_tiles;
+        const size_t col   = (item % num_tiles) * tile_size;
+        const size_t width = std::min(layout.inner - col, tile_size);
+        auto tile          = tiles.ptr(omp_get_thread_num() * tile_size);
+        for (size_t idx = 0; idx < width; ++idx) {
+          tile[idx] = LG_OP::identity;
+        }
+        ENGINE::fold_tile(tile,
+                          inptr + outer * slab,
+                          HAS_WHERE ? whereptr + outer * slab : nullptr,
+                          0,
+                          layout.extent,
+                          layout.inner,
+                          col,
+                          width,
+                          pitches.unflatten(outer * slab + col, rect.lo),
+                          collapsed_dim);
+        for (size_t idx = 0; idx < width; ++idx) {
+          lhs.reduce(pitches.unflatten(outer * slab + col + idx, rect.lo), tile[idx]);
+        }
+      }
+      return;
+    }
+
+    const size_t min_rows   = (MIN_REDUCTION_CHUNK_SIZE + tile_size - 1) / tile_size;
+    const size_t num_chunks = std::max<size_t>(
+      1, std::min(num_threads / num_items, (layout.extent + min_rows - 1) / min_rows));
+    const size_t chunk_size = (layout.extent + num_chunks - 1) / num_chunks;
+    auto partials           = create_buffer<VAL>(num_chunks * tile_size);
+
+    for (size_t item = 0; item < num_items; ++item) {
+      const size_t outer = item / num_tiles;
+      const size_t col   = (item % num_tiles) * tile_size;
+      const size_t width = std::min(layout.inner - col, tile_size);
+      auto point         = pitches.unflatten(outer * slab + col, rect.lo);
+#pragma omp parallel for schedule(static)
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const size_t lo = std::min(chunk * chunk_size, layout.extent);
+        const size_t hi = std::min(lo + chunk_size, layout.extent);
+        auto tile       = partials.ptr(chunk * tile_size);
+        for (size_t idx = 0; idx < width; ++idx) {
+          tile[idx] = LG_OP::identity;
+        }
+        ENGINE::fold_tile(tile,
+                          inptr + outer * slab,
+                          HAS_WHERE ? whereptr + outer * slab : nullptr,
+                          lo,
+                          hi,
+                          layout.inner,
+                          col,
+                          width,
+                          point,
+                          collapsed_dim);
+      }
+      for (size_t idx = 0; idx < width; ++idx) {
+        VAL acc = partials[idx];
+        for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+          LG_OP::template fold<true>(acc, partials[chunk * tile_size + idx]);
+        }
+        lhs.reduce(pitches.unflatten(outer * slab + col + idx, rect.lo), acc);
+      }
+    }
+  }
+
+  void reduce_sparse(AccessorRD<LG_OP, true, DIM>& lhs,
+                     const AccessorRO<RHS, DIM>& rhs,
+                     const AccessorRO<bool, DIM>& where,
+                     const Rect<DIM>& rect,
+                     int collapsed_dim) const
   {
     Splitter<DIM> splitter;
     auto split = splitter.split(rect, collapsed_dim);
@@ -22,6 +22,7 @@
 #include "cupynumeric/arg.h"
 #include "cupynumeric/arg.inl"
 #include "cupynumeric/pitches.h"
+#include "cupynumeric/utilities/perf_counters.h"
 
 namespace cupynumeric {
 
@@ -56,8 +57,21 @@ struct UnaryRedImpl {
     if constexpr (HAS_WHERE) {
       where = args.where.read_accessor<bool, DIM>(rect);
     }
+
+#if !LEGATE_DEFINED(LEGATE_BOUNDS_CHECKS)
+    // Check to see if this is dense or not
+    bool dense = rhs.accessor.is_dense_row_major(rect);
+    if constexpr (HAS_WHERE) {
+      dense = dense && where.accessor.is_dense_row_major(rect);
+    }
+#else
+    // No dense execution if we're doing bounds checks
+    bool dense = false;
+#endif
+    PerfScope::note_dense(dense);
+
     UnaryRedImplBody<KIND, OP_CODE, CODE, DIM, HAS_WHERE>()(
-      lhs, rhs, where, rect, pitches, args.collapsed_dim, volume);
+      lhs, rhs, where, rect, pitches, args.collapsed_dim, volume, dense);
   }
 
   template <Type::Code CODE,
@@ -82,6 +96,7 @@ struct UnaryRedDispatch {
 template <VariantKind KIND>
 static void unary_red_template(TaskContext& context)
 {
+  PerfScope perf{context, CUPYNUMERIC_UNARY_RED, KIND};
   bool has_where = context.scalar(2).value<bool>();
   UnaryRedArgs args{context.reduction(0),
                     context.input(0),
@@ -18,6 +18,7 @@
 
 #include "cupynumeric/cupynumeric_task.h"
 #include "cupynumeric/arg.h"
+#include "cupynumeric/welford.h"
 #include "cupynumeric/arg.inl"
 #include "cupynumeric/unary/isnan.h"
 
@@ -293,13 +294,16 @@ struct UnaryRedOp<UnaryRedCode::SUM_SQUARES, TYPE_CODE> {
   __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return rhs * rhs; }
 };
 
+// Accumulates the count, mean, and sum of squared deviations of the input in
+// a single pass; GETM2 extracts the latter once the reduction is complete
 template <legate::Type::Code TYPE_CODE>
 struct UnaryRedOp<UnaryRedCode::VARIANCE, TYPE_CODE> {
-  static constexpr bool valid = true;
+  static constexpr bool valid =
+    TYPE_CODE == legate::Type::Code::FLOAT32 || TYPE_CODE == legate::Type::Code::FLOAT64;
 
   using RHS = legate::type_of<TYPE_CODE>;
-  using VAL = RHS;
-  using OP  = Legion::SumReduction<VAL>;
+  using VAL = WelfordVal<RHS>;
+  using OP  = WelfordReduction<RHS>;
 
   template <bool EXCLUSIVE>
   __CUDA_HD__ static void fold(VAL& a, VAL b)
@@ -310,10 +314,10 @@ struct UnaryRedOp<UnaryRedCode::VARIANCE, TYPE_CODE> {
   template <int32_t DIM>
   __CUDA_HD__ static VAL convert(const Legion::Point<DIM>&, int32_t, const VAL, const RHS& rhs)
   {
-    return rhs * rhs;
+    return VAL(rhs);
   }
 
-  __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return rhs * rhs; }
+  __CUDA_HD__ static VAL convert(const RHS& rhs, const VAL) { return VAL(rhs); }
 };
 
 template <legate::Type::Code TYPE_CODE>
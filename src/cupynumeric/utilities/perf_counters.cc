@@ -0,0 +1,195 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cupynumeric/utilities/perf_counters.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace cupynumeric {
+
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+// Defined in perf_counters.cu
+void perf_counters_synchronize_stream();
+#endif
+
+namespace {
+
+bool enabled_from_env()
+{
+  const auto* value = std::getenv("CUPYNUMERIC_PERF_COUNTERS");
+  return value != nullptr && std::atoi(value) != 0;
+}
+
+std::atomic<bool>& enabled()
+{
+  static std::atomic<bool> enabled{enabled_from_env()};
+  return enabled;
+}
+
+std::mutex records_mutex{};
+
+std::map<std::pair<int32_t, int32_t>, PerfCounters>& records()
+{
+  static std::map<std::pair<int32_t, int32_t>, PerfCounters> records{};
+  return records;
+}
+
+void accumulate(int32_t op_code, int32_t variant, const PerfCounters& counters)
+{
+  const std::lock_guard<std::mutex> lock{records_mutex};
+  auto& total = records()[{op_code, variant}];
+  total.launches += counters.launches;
+  total.elements += counters.elements;
+  total.bytes_read += counters.bytes_read;
+  total.bytes_written += counters.bytes_written;
+  total.dense_launches += counters.dense_launches;
+  total.strided_launches += counters.strided_launches;
+  total.nanoseconds += counters.nanoseconds;
+}
+
+thread_local PerfScope* current_scope = nullptr;
+
+// Taken by cupynumeric_perf_counters_snapshot and read by cupynumeric_perf_counters_get, so that
+// the records read one at a time are consistent with each other
+std::vector<CuPyNumericPerfRecord>& c_snapshot()
+{
+  static std::vector<CuPyNumericPerfRecord> snapshot{};
+  return snapshot;
+}
+
+}  // namespace
+
+bool perf_counters_enabled() { return enabled().load(std::memory_order_relaxed); }
+
+void perf_counters_enable(bool enable) { enabled().store(enable, std::memory_order_relaxed); }
+
+void perf_counters_reset()
+{
+  const std::lock_guard<std::mutex> lock{records_mutex};
+  records().clear();
+}
+
+std::vector<CuPyNumericPerfRecord> perf_counters_snapshot()
+{
+  std::vector<CuPyNumericPerfRecord> snapshot;
+  const std::lock_guard<std::mutex> lock{records_mutex};
+  snapshot.reserve(records().size());
+  for (auto& [key, counters] : records()) {
+    auto& record            = snapshot.emplace_back();
+    record.op_code          = key.first;
+    record.variant          = key.second;
+    record.launches         = counters.launches;
+    record.elements         = counters.elements;
+    record.bytes_read       = counters.bytes_read;
+    record.bytes_written    = counters.bytes_written;
+    record.dense_launches   = counters.dense_launches;
+    record.strided_launches = counters.strided_launches;
+    record.nanoseconds      = counters.nanoseconds;
+  }
+  return snapshot;
+}
+
+void perf_counters_record_launch(CuPyNumericOpCode op_code)
+{
+  if (!perf_counters_enabled()) {
+    return;
+  }
+  PerfCounters counters{};
+  counters.launches = 1;
+  accumulate(op_code, PERF_VARIANT_SUBMIT, counters);
+}
+
+PerfScope::PerfScope(const legate::TaskContext& context,
+                     CuPyNumericOpCode op_code,
+                     VariantKind kind)
+  : active_(perf_counters_enabled()), op_code_(op_code), kind_(kind)
+{
+  if (!active_) {
+    return;
+  }
+
+  auto add_stores = [&](const std::vector<legate::PhysicalArray>& arrays, uint64_t& bytes) {
+    for (auto& array : arrays) {
+      const auto volume = static_cast<uint64_t>(array.domain().get_volume());
+      counters_.elements = std::max(counters_.elements, volume);
+      bytes += volume * array.type().size();
+    }
+  };
+  add_stores(context.inputs(), counters_.bytes_read);
+  add_stores(context.outputs(), counters_.bytes_written);
+  add_stores(context.reductions(), counters_.bytes_written);
+  counters_.launches = 1;
+
+  outer_ = std::exchange(current_scope, this);
+  start_ = std::chrono::steady_clock::now();
+}
+
+PerfScope::~PerfScope()
+{
+  if (!active_) {
+    return;
+  }
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+  // GPU bodies only enqueue their kernels, so wait for them to get a meaningful time
+  if (kind_ == VariantKind::GPU) {
+    perf_counters_synchronize_stream();
+  }
+#endif
+  const auto elapsed = std::chrono::steady_clock::now() - start_;
+  counters_.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  current_scope = outer_;
+  accumulate(op_code_, static_cast<int32_t>(kind_), counters_);
+}
+
+/*static*/ void PerfScope::note_dense(bool dense)
+{
+  auto scope = current_scope;
+  if (nullptr == scope) {
+    return;
+  }
+  scope->counters_.dense_launches   = dense ? 1 : 0;
+  scope->counters_.strided_launches = dense ? 0 : 1;
+}
+
+}  // namespace cupynumeric
+
+extern "C" {
+
+bool cupynumeric_perf_counters_enabled() { return cupynumeric::perf_counters_enabled(); }
+
+void cupynumeric_perf_counters_enable(bool enable) { cupynumeric::perf_counters_enable(enable); }
+
+void cupynumeric_perf_counters_reset() { cupynumeric::perf_counters_reset(); }
+
+unsigned cupynumeric_perf_counters_snapshot()
+{
+  auto& snapshot = cupynumeric::c_snapshot();
+  snapshot       = cupynumeric::perf_counters_snapshot();
+  return static_cast<unsigned>(snapshot.size());
+}
+
+CuPyNumericPerfRecord cupynumeric_perf_counters_get(unsigned index)
+{
+  const auto& snapshot = cupynumeric::c_snapshot();
+  return index < snapshot.size() ? snapshot[index] : CuPyNumericPerfRecord{};
+}
+
+}  // extern "C"
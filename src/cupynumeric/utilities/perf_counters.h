@@ -0,0 +1,73 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "cupynumeric/cupynumeric_task.h"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace cupynumeric {
+
+struct PerfCounters {
+  uint64_t launches{0};          // task executions, or launches for PERF_VARIANT_SUBMIT
+  uint64_t elements{0};          // elements of the largest store of each execution
+  uint64_t bytes_read{0};        // bytes of the input stores
+  uint64_t bytes_written{0};     // bytes of the output and reduction stores
+  uint64_t dense_launches{0};    // executions whose body took its dense path
+  uint64_t strided_launches{0};  // executions whose body took its strided path
+  uint64_t nanoseconds{0};       // wall time spent in the task bodies
+};
+
+// Records with this variant count the launches created through CuPyNumericRuntime::create_task,
+// which carry the op code that submit no longer has access to
+constexpr int PERF_VARIANT_SUBMIT = -1;
+
+// The counters are kept per process and are only updated while enabled, which can also be done by
+// setting CUPYNUMERIC_PERF_COUNTERS in the environment
+[[nodiscard]] bool perf_counters_enabled();
+void perf_counters_enable(bool enable);
+void perf_counters_reset();
+// One record per op code and variant seen so far
+[[nodiscard]] std::vector<CuPyNumericPerfRecord> perf_counters_snapshot();
+
+void perf_counters_record_launch(CuPyNumericOpCode op_code);
+
+// Times one execution of a task variant and records it, together with the sizes of the task's
+// stores, when it goes out of scope. Bodies with dense and strided paths report the one they take
+// through note_dense. Does nothing unless the counters are enabled.
+class PerfScope {
+ public:
+  PerfScope(const legate::TaskContext& context, CuPyNumericOpCode op_code, VariantKind kind);
+  ~PerfScope();
+  PerfScope(const PerfScope&)            = delete;
+  PerfScope& operator=(const PerfScope&) = delete;
+
+  // Applies to the innermost scope active on the calling thread
+  static void note_dense(bool dense);
+
+ private:
+  bool active_{false};
+  CuPyNumericOpCode op_code_;
+  VariantKind kind_;
+  PerfCounters counters_{};
+  PerfScope* outer_{nullptr};
+  std::chrono::steady_clock::time_point start_{};
+};
+
+}  // namespace cupynumeric
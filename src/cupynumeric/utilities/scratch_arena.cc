@@ -0,0 +1,144 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "cupynumeric/utilities/scratch_arena.h"
+
+#include "legate.h"
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace cupynumeric {
+
+namespace {
+
+std::mutex arenas_mutex{};
+
+std::unordered_map<legate::Processor::id_t, std::unique_ptr<ScratchArena>>& arenas()
+{
+  static std::unordered_map<legate::Processor::id_t, std::unique_ptr<ScratchArena>> arenas{};
+  return arenas;
+}
+
+size_t block_size(size_t bytes)
+{
+  size_t block = ScratchArena::MIN_BLOCK_SIZE;
+  while (block < bytes) {
+    block <<= 1;
+  }
+  return block;
+}
+
+}  // namespace
+
+ScratchArena::~ScratchArena() { trim(); }
+
+/*static*/ ScratchArena& ScratchArena::local()
+{
+  // Code running outside of a task shares the arena of the null processor
+  const auto proc = legate::Processor::get_executing_processor().id;
+  const std::lock_guard<std::mutex> lock{arenas_mutex};
+  auto& arena = arenas()[proc];
+  if (!arena) {
+    arena = std::make_unique<ScratchArena>();
+  }
+  return *arena;
+}
+
+void* ScratchArena::acquire(size_t& bytes)
+{
+  if (bytes == 0) {
+    return nullptr;
+  }
+  bytes = block_size(bytes);
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    stats_.bytes_in_use += bytes;
+    auto finder = free_blocks_.find(bytes);
+    if (finder != free_blocks_.end() && !finder->second.empty()) {
+      auto ptr = finder->second.back();
+      finder->second.pop_back();
+      stats_.bytes_cached -= bytes;
+      ++stats_.hits;
+      return ptr;
+    }
+    ++stats_.misses;
+  }
+  // Blocks are powers of two no smaller than a page, so they are also multiples of the alignment
+  auto ptr = std::aligned_alloc(64, bytes);
+  if (nullptr == ptr) {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    stats_.bytes_in_use -= bytes;
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+void ScratchArena::release(void* ptr, size_t bytes)
+{
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    stats_.bytes_in_use -= bytes;
+    if (stats_.bytes_cached + bytes <= SCRATCH_ARENA_CAPACITY) {
+      free_blocks_[bytes].push_back(ptr);
+      stats_.bytes_cached += bytes;
+      return;
+    }
+  }
+  std::free(ptr);
+}
+
+void ScratchArena::trim()
+{
+  const std::lock_guard<std::mutex> lock{mutex_};
+  for (auto& [_, blocks] : free_blocks_) {
+    for (auto ptr : blocks) {
+      std::free(ptr);
+    }
+  }
+  free_blocks_.clear();
+  stats_.bytes_cached = 0;
+}
+
+ScratchArenaStats ScratchArena::stats() const
+{
+  const std::lock_guard<std::mutex> lock{mutex_};
+  return stats_;
+}
+
+ScratchArenaStats scratch_arena_stats()
+{
+  ScratchArenaStats total{};
+  const std::lock_guard<std::mutex> lock{arenas_mutex};
+  for (auto& [_, arena] : arenas()) {
+    auto stats = arena->stats();
+    total.hits += stats.hits;
+    total.misses += stats.misses;
+    total.bytes_cached += stats.bytes_cached;
+    total.bytes_in_use += stats.bytes_in_use;
+  }
+  return total;
+}
+
+void scratch_arena_trim()
+{
+  const std::lock_guard<std::mutex> lock{arenas_mutex};
+  for (auto& [_, arena] : arenas()) {
+    arena->trim();
+  }
+}
+
+}  // namespace cupynumeric
@@ -0,0 +1,112 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cupynumeric {
+
+struct ScratchArenaStats {
+  uint64_t hits{0};          // requests served from a cached block
+  uint64_t misses{0};        // requests that allocated a new block
+  uint64_t bytes_cached{0};  // bytes held in free lists for later requests
+  uint64_t bytes_in_use{0};  // bytes handed out and not yet returned
+};
+
+// Cache of host scratch blocks for the tasks of one processor. Requests are
+// rounded up to a power of two, and released blocks are kept in per-size
+// free lists, up to SCRATCH_ARENA_CAPACITY bytes, so that later tasks of the
+// same processor can reuse them without going back to the system allocator.
+class ScratchArena {
+ public:
+  static constexpr size_t MIN_BLOCK_SIZE         = 4096;
+  static constexpr size_t SCRATCH_ARENA_CAPACITY = size_t{256} << 20;
+
+  ScratchArena() = default;
+  ~ScratchArena();
+  ScratchArena(const ScratchArena&)            = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  // Returns the arena of the executing processor
+  static ScratchArena& local();
+
+  // Rounds `bytes` up to the size of the block it returns
+  [[nodiscard]] void* acquire(size_t& bytes);
+  void release(void* ptr, size_t bytes);
+  // Returns every cached block to the system
+  void trim();
+  [[nodiscard]] ScratchArenaStats stats() const;
+
+ private:
+  mutable std::mutex mutex_{};
+  std::unordered_map<size_t, std::vector<void*>> free_blocks_{};
+  ScratchArenaStats stats_{};
+};
+
+// Statistics summed over the arenas of all processors in this process
+[[nodiscard]] ScratchArenaStats scratch_arena_stats();
+
+// Returns the cached blocks of all arenas to the system
+void scratch_arena_trim();
+
+// RAII handle for `size` elements of uninitialized host scratch memory taken
+// from the arena of the executing processor. Unlike a legate::Buffer, the
+// memory goes back to the arena, not to the task's pool, when the handle is
+// destroyed, so repeated tasks with similar shapes reuse the same blocks.
+template <typename T>
+class ScratchBuffer {
+ public:
+  explicit ScratchBuffer(size_t size) : arena_(&ScratchArena::local()), bytes_(size * sizeof(T))
+  {
+    ptr_ = static_cast<T*>(arena_->acquire(bytes_));
+  }
+  ~ScratchBuffer()
+  {
+    if (ptr_ != nullptr) {
+      arena_->release(ptr_, bytes_);
+    }
+  }
+  ScratchBuffer(const ScratchBuffer&)            = delete;
+  ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+  ScratchBuffer(ScratchBuffer&& other) noexcept
+    : arena_(other.arena_),
+      ptr_(std::exchange(other.ptr_, nullptr)),
+      bytes_(std::exchange(other.bytes_, 0))
+  {
+  }
+  ScratchBuffer& operator=(ScratchBuffer&& other) noexcept
+  {
+    std::swap(arena_, other.arena_);
+    std::swap(ptr_, other.ptr_);
+    std::swap(bytes_, other.bytes_);
+    return *this;
+  }
+
+  [[nodiscard]] T* ptr() const noexcept { return ptr_; }
+  T& operator[](size_t idx) const noexcept { return ptr_[idx]; }
+
+ private:
+  ScratchArena* arena_;
+  T* ptr_{nullptr};
+  size_t bytes_;
+};
+
+}  // namespace cupynumeric
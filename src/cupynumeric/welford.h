@@ -0,0 +1,82 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "legate.h"
+
+namespace cupynumeric {
+
+// Running state of Welford's algorithm: the number of values seen, their
+// mean, and the sum of squared deviations from that mean. The layout matches
+// legate::struct_type({int64, T, T}, true /*align*/).
+template <typename T>
+class WelfordVal {
+ public:
+  // Calling this constructor manually is unsafe, as the members are left uninitialized.
+  // This constructor exists only to make nvcc happy when we use a shared memory of WelfordVal<T>.
+  __CUDA_HD__
+  WelfordVal() {}
+  __CUDA_HD__
+  WelfordVal(T value);
+  __CUDA_HD__
+  WelfordVal(int64_t count, T mean, T m2);
+  __CUDA_HD__
+  WelfordVal(const WelfordVal& other);
+
+ public:
+  // Merges two partial states with the pairwise update of Chan et al.
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline void apply(const WelfordVal<T>& rhs);
+
+ public:
+  __CUDA_HD__ WelfordVal& operator=(const WelfordVal& other)
+  {
+    count = other.count;
+    mean  = other.mean;
+    m2    = other.m2;
+    return *this;
+  }
+
+ public:
+  int64_t count;
+  T mean;
+  T m2;
+};
+
+template <typename T>
+class WelfordReduction {
+ public:
+  using LHS = WelfordVal<T>;
+  using RHS = WelfordVal<T>;
+
+  static const WelfordVal<T> identity;
+
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline static void apply(LHS& lhs, RHS rhs)
+  {
+    lhs.template apply<EXCLUSIVE>(rhs);
+  }
+  template <bool EXCLUSIVE>
+  __CUDA_HD__ inline static void fold(RHS& rhs1, RHS rhs2)
+  {
+    rhs1.template apply<EXCLUSIVE>(rhs2);
+  }
+};
+
+}  // namespace cupynumeric
+
+#include "cupynumeric/welford.inl"
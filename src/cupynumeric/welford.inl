@@ -0,0 +1,126 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cupynumeric/welford.h"
+
+namespace cupynumeric {
+
+template <typename T>
+__CUDA_HD__ WelfordVal<T>::WelfordVal(T v) : count(1), mean(v), m2(0)
+{
+}
+
+template <typename T>
+__CUDA_HD__ WelfordVal<T>::WelfordVal(int64_t n, T mu, T m) : count(n), mean(mu), m2(m)
+{
+}
+
+template <typename T>
+__CUDA_HD__ WelfordVal<T>::WelfordVal(const WelfordVal& other)
+  : count(other.count), mean(other.mean), m2(other.m2)
+{
+}
+
+namespace detail {
+
+template <typename T>
+__CUDA_HD__ inline void welford_merge(
+  int64_t& count, T& mean, T& m2, int64_t rhs_count, T rhs_mean, T rhs_m2)
+{
+  if (rhs_count == 0) {
+    return;
+  }
+  if (count == 0) {
+    count = rhs_count;
+    mean  = rhs_mean;
+    m2    = rhs_m2;
+    return;
+  }
+  const auto total = count + rhs_count;
+  const T delta    = rhs_mean - mean;
+  const T weight   = static_cast<T>(rhs_count) / static_cast<T>(total);
+  mean += delta * weight;
+  m2 += rhs_m2 + delta * delta * static_cast<T>(count) * weight;
+  count = total;
+}
+
+}  // namespace detail
+
+template <typename T>
+template <bool EXCLUSIVE>
+__CUDA_HD__ inline void WelfordVal<T>::apply(const WelfordVal<T>& rhs)
+{
+  if (EXCLUSIVE) {
+    detail::welford_merge(count, mean, m2, rhs.count, rhs.mean, rhs.m2);
+  } else {
+    // Handle conflicts here. Counts are never negative, so -1 in the count
+    // marks a state that another thread is in the middle of updating.
+#ifdef __CUDA_ARCH__
+    const unsigned long long guard = (unsigned long long)-1LL;
+    unsigned long long* ptr        = (unsigned long long*)&count;
+    union {
+      long long as_signed;
+      unsigned long long as_unsigned;
+    } next, current;
+    next.as_signed = *ptr;
+    do {
+      current.as_signed = next.as_signed;
+      next.as_unsigned  = atomicCAS(ptr, current.as_unsigned, guard);
+    } while ((next.as_signed != current.as_signed) || (next.as_signed == -1LL));
+    // Memory fence to prevent the compiler from hoisting the loads
+    __threadfence();
+    int64_t n = next.as_signed;
+    detail::welford_merge(n, mean, m2, rhs.count, rhs.mean, rhs.m2);
+    // Make sure the new mean and m2 are visible before releasing the state
+    __threadfence();
+    next.as_signed = n;
+    // We know the value is minus 1 so this is guaranteed to succeed
+    atomicCAS(ptr, guard, next.as_unsigned);
+#else
+    volatile long long* ptr = reinterpret_cast<volatile long long*>(&count);
+    long long next          = *ptr;
+    long long current;
+    do {
+      current = next;
+      next    = __sync_val_compare_and_swap(ptr, current, -1);
+    } while ((next != current) || (next == -1));
+    // Memory fence to prevent the compiler from hoisting the loads
+    __sync_synchronize();
+    int64_t n = next;
+    detail::welford_merge(n, mean, m2, rhs.count, rhs.mean, rhs.m2);
+    // Make sure the new mean and m2 are visible before releasing the state
+    __sync_synchronize();
+    // We know the value is minus 1 so this is guaranteed to succeed
+    __sync_val_compare_and_swap(ptr, -1, n);
+#endif
+  }
+}
+
+// Declare these here, to work around undefined-var-template warnings
+
+#define DECLARE_WELFORD_IDENTITY(TYPE) \
+  template <>                          \
+  const WelfordVal<TYPE> WelfordReduction<TYPE>::identity;
+
+DECLARE_WELFORD_IDENTITY(float)
+DECLARE_WELFORD_IDENTITY(double)
+
+#undef DECLARE_WELFORD_IDENTITY
+
+}  // namespace cupynumeric
@@ -0,0 +1,133 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench_util.h"
+
+#include "cupynumeric/runtime.h"
+
+namespace cupynumeric::bench {
+
+namespace {
+
+const std::vector<int64_t> EXTENTS = {256, 1024, 4096};
+
+// BINARY_OP
+template <legate::Type::Code CODE>
+void BM_add(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  auto b            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto c = add(a, b);
+    wait();
+  }
+  set_throughput(state, n * n, 3 * n * n * type.size());
+  set_label(state, type, layout);
+}
+
+// UNARY_RED, reducing the inner axis
+template <legate::Type::Code CODE>
+void BM_amax_axis(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto m = amax(a, {1});
+    wait();
+  }
+  set_throughput(state, n * n, (n * n + n) * type.size());
+  set_label(state, type, layout);
+}
+
+// SCALAR_UNARY_RED
+template <legate::Type::Code CODE>
+void BM_sum(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto s = sum(a);
+    wait();
+  }
+  set_throughput(state, n * n, n * n * type.size());
+  set_label(state, type, layout);
+}
+
+// SCAN_LOCAL in its fused form, which scans whole rows in one pass. The NDArray API has no
+// cumsum, so the task is launched the way the Python frontend does when every row fits in a
+// single task.
+template <legate::Type::Code CODE>
+void BM_cumsum_rows(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto runtime      = CuPyNumericRuntime::get_runtime();
+  auto a            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto out   = runtime->create_array({n, n}, type);
+    auto task  = runtime->create_task(CUPYNUMERIC_SCAN_LOCAL);
+    auto p_out = task.add_output(out.get_store());
+    auto p_in  = task.add_input(a.get_store());
+    task.add_scalar_arg(legate::Scalar(static_cast<int32_t>(CUPYNUMERIC_SCAN_SUM)));
+    task.add_scalar_arg(legate::Scalar(false /*nan_to_identity*/));
+    task.add_scalar_arg(legate::Scalar(false /*exclusive*/));
+    task.add_constraint(legate::align(p_in, p_out));
+    task.add_constraint(legate::broadcast(p_in, {1}));
+    runtime->submit(std::move(task));
+    wait();
+  }
+  set_throughput(state, n * n, 2 * n * n * type.size());
+  set_label(state, type, layout);
+}
+
+void grid(benchmark::internal::Benchmark* b) { matrix_grid(b, EXTENTS); }
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_add, legate::Type::Code::FLOAT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_add, legate::Type::Code::FLOAT64)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_add, legate::Type::Code::INT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_add, legate::Type::Code::INT64)->Apply(grid);
+
+BENCHMARK_TEMPLATE(BM_amax_axis, legate::Type::Code::FLOAT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_amax_axis, legate::Type::Code::FLOAT64)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_amax_axis, legate::Type::Code::INT64)->Apply(grid);
+
+BENCHMARK_TEMPLATE(BM_sum, legate::Type::Code::FLOAT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_sum, legate::Type::Code::FLOAT64)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_sum, legate::Type::Code::INT64)->Apply(grid);
+
+BENCHMARK_TEMPLATE(BM_cumsum_rows, legate::Type::Code::FLOAT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_cumsum_rows, legate::Type::Code::FLOAT64)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_cumsum_rows, legate::Type::Code::INT64)->Apply(grid);
+
+}  // namespace cupynumeric::bench
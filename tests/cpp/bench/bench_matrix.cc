@@ -0,0 +1,89 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench_util.h"
+
+namespace cupynumeric::bench {
+
+namespace {
+
+// MATMUL of two n x n matrices, both with the requested layout
+template <legate::Type::Code CODE>
+void BM_matmul(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  auto b            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto c = dot(a, b);
+    wait();
+  }
+  set_throughput(state, n * n, 3 * n * n * type.size());
+  // Matmul is compute bound, so also report its 2 * n^3 flops as a rate
+  state.counters["GFLOP/s"] = benchmark::Counter(
+    2e-9 * static_cast<double>(n * n * n), benchmark::Counter::kIsIterationInvariantRate);
+  set_label(state, type, layout);
+}
+
+// CONVOLVE of an n x n image with a k x k filter
+template <legate::Type::Code CODE>
+void BM_convolve(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto k      = static_cast<uint64_t>(state.range(2));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  auto v            = random_array({k, k}, type);
+  wait();
+
+  for (auto _ : state) {
+    auto c = convolve(a, v);
+    wait();
+  }
+  set_throughput(state, n * n, 2 * n * n * type.size());
+  set_label(state, type, layout);
+}
+
+void matmul_grid(benchmark::internal::Benchmark* b) { matrix_grid(b, {256, 1024, 2048}); }
+
+void convolve_grid(benchmark::internal::Benchmark* b)
+{
+  for (int64_t n : {1024, 4096}) {
+    for (auto layout : {Layout::DENSE, Layout::TRANSPOSED, Layout::SLICED}) {
+      for (int64_t k : {3, 17}) {
+        b->Args({n, static_cast<int64_t>(layout), k});
+      }
+    }
+  }
+  b->ArgNames({"n", "layout", "k"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_matmul, legate::Type::Code::FLOAT16)->Apply(matmul_grid);
+BENCHMARK_TEMPLATE(BM_matmul, legate::Type::Code::FLOAT32)->Apply(matmul_grid);
+BENCHMARK_TEMPLATE(BM_matmul, legate::Type::Code::FLOAT64)->Apply(matmul_grid);
+BENCHMARK_TEMPLATE(BM_matmul, legate::Type::Code::COMPLEX64)->Apply(matmul_grid);
+
+BENCHMARK_TEMPLATE(BM_convolve, legate::Type::Code::FLOAT32)->Apply(convolve_grid);
+BENCHMARK_TEMPLATE(BM_convolve, legate::Type::Code::FLOAT64)->Apply(convolve_grid);
+
+}  // namespace cupynumeric::bench
@@ -0,0 +1,140 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "bench_util.h"
+
+namespace cupynumeric::bench {
+
+namespace {
+
+const std::vector<int64_t> EXTENTS = {256, 1024, 4096};
+
+// SORT over a whole vector
+template <legate::Type::Code CODE>
+void BM_sort(benchmark::State& state)
+{
+  const auto n    = static_cast<uint64_t>(state.range(0));
+  const auto type = legate::primitive_type(CODE);
+  auto a          = random_array({n}, type);
+  wait();
+
+  for (auto _ : state) {
+    auto s = sort(a);
+    wait();
+  }
+  set_throughput(state, n, 2 * n * type.size());
+  set_label(state, type, Layout::DENSE);
+}
+
+// SORT of every row of a matrix
+template <legate::Type::Code CODE>
+void BM_sort_rows(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto s = sort(a, -1);
+    wait();
+  }
+  set_throughput(state, n * n, 2 * n * n * type.size());
+  set_label(state, type, layout);
+}
+
+// UNIQUE; the operands hold at most 100 distinct values
+template <legate::Type::Code CODE>
+void BM_unique(benchmark::State& state)
+{
+  const auto n    = static_cast<uint64_t>(state.range(0));
+  const auto type = legate::primitive_type(CODE);
+  auto a          = random_array({n}, type);
+  wait();
+
+  for (auto _ : state) {
+    auto u = unique(a);
+    wait();
+  }
+  set_throughput(state, n, n * type.size());
+  set_label(state, type, Layout::DENSE);
+}
+
+// NONZERO; about one element in a hundred is zero for integer operands
+template <legate::Type::Code CODE>
+void BM_nonzero(benchmark::State& state)
+{
+  const auto n      = static_cast<uint64_t>(state.range(0));
+  const auto layout = static_cast<Layout>(state.range(1));
+  const auto type   = legate::primitive_type(CODE);
+  auto a            = make_matrix(n, n, type, layout);
+  wait();
+
+  for (auto _ : state) {
+    auto indices = nonzero(a);
+    wait();
+  }
+  // Counts the input and an upper bound of two int64 coordinates per element
+  set_throughput(state, n * n, n * n * (type.size() + 2 * sizeof(int64_t)));
+  set_label(state, type, layout);
+}
+
+// BINCOUNT into 100 bins, with and without weights
+template <legate::Type::Code CODE, bool WEIGHTS>
+void BM_bincount(benchmark::State& state)
+{
+  const auto n    = static_cast<uint64_t>(state.range(0));
+  const auto type = legate::primitive_type(CODE);
+  auto x          = random_array({n}, type);
+  std::optional<NDArray> weights{};
+  if constexpr (WEIGHTS) {
+    weights = random({n});
+  }
+  wait();
+
+  for (auto _ : state) {
+    auto counts = bincount(x, weights);
+    wait();
+  }
+  set_throughput(state, n, n * (type.size() + (WEIGHTS ? sizeof(double) : 0)));
+  set_label(state, type, Layout::DENSE);
+}
+
+void grid(benchmark::internal::Benchmark* b) { matrix_grid(b, EXTENTS); }
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_sort, legate::Type::Code::FLOAT32)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_sort, legate::Type::Code::FLOAT64)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_sort, legate::Type::Code::INT32)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_sort, legate::Type::Code::INT64)->Apply(vector_grid);
+
+BENCHMARK_TEMPLATE(BM_sort_rows, legate::Type::Code::FLOAT64)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_sort_rows, legate::Type::Code::INT32)->Apply(grid);
+
+BENCHMARK_TEMPLATE(BM_unique, legate::Type::Code::FLOAT64)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_unique, legate::Type::Code::INT32)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_unique, legate::Type::Code::INT64)->Apply(vector_grid);
+
+BENCHMARK_TEMPLATE(BM_nonzero, legate::Type::Code::INT32)->Apply(grid);
+BENCHMARK_TEMPLATE(BM_nonzero, legate::Type::Code::INT64)->Apply(grid);
+
+BENCHMARK_TEMPLATE(BM_bincount, legate::Type::Code::INT32, false)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_bincount, legate::Type::Code::INT64, false)->Apply(vector_grid);
+BENCHMARK_TEMPLATE(BM_bincount, legate::Type::Code::INT64, true)->Apply(vector_grid);
+
+}  // namespace cupynumeric::bench
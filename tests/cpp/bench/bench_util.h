@@ -0,0 +1,106 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "legate.h"
+#include "cupynumeric.h"
+
+namespace cupynumeric::bench {
+
+// How the operands of a benchmark are laid out in memory. Transposed and sliced operands are
+// views whose instances are not dense row-major, so the kernels take their strided paths.
+enum class Layout : int64_t {
+  DENSE      = 0,
+  TRANSPOSED = 1,
+  SLICED     = 2,
+};
+
+inline const char* layout_name(Layout layout)
+{
+  switch (layout) {
+    case Layout::DENSE: return "dense";
+    case Layout::TRANSPOSED: return "transposed";
+    case Layout::SLICED: return "sliced";
+  }
+  return "unknown";
+}
+
+// Uniform random values in [0, 100) converted to the given type, so that integer operands are
+// not all zero
+inline NDArray random_array(std::vector<uint64_t> shape, const legate::Type& type)
+{
+  auto values = random(std::move(shape)) * legate::Scalar(100.0);
+  return type == legate::float64() ? values : values.as_type(type);
+}
+
+// A rows x cols operand with the requested layout
+inline NDArray make_matrix(uint64_t rows, uint64_t cols, const legate::Type& type, Layout layout)
+{
+  switch (layout) {
+    case Layout::DENSE: return random_array({rows, cols}, type);
+    case Layout::TRANSPOSED: return random_array({cols, rows}, type).transpose();
+    case Layout::SLICED:
+      return random_array({rows, cols + 2}, type)[{slice(), slice(1, cols + 1)}];
+  }
+  return random_array({rows, cols}, type);
+}
+
+// Legate launches are asynchronous, so each timed iteration waits for its tasks to finish
+inline void wait() { legate::Runtime::get_runtime()->issue_execution_fence(true /*block*/); }
+
+// Reports the elements and bytes processed per iteration. Google Benchmark turns them into
+// items_per_second and bytes_per_second; GB/s is added as its own counter for the reports.
+inline void set_throughput(benchmark::State& state, uint64_t elements, uint64_t bytes)
+{
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+  state.counters["GB/s"] = benchmark::Counter(
+    static_cast<double>(bytes) * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+inline void set_label(benchmark::State& state, const legate::Type& type, Layout layout)
+{
+  state.SetLabel(type.to_string() + "/" + layout_name(layout));
+}
+
+// Square matrix extents and layouts shared by the benchmarks over 2-D operands
+inline void matrix_grid(benchmark::internal::Benchmark* b, std::vector<int64_t> extents)
+{
+  for (auto extent : extents) {
+    for (auto layout : {Layout::DENSE, Layout::TRANSPOSED, Layout::SLICED}) {
+      b->Args({extent, static_cast<int64_t>(layout)});
+    }
+  }
+  b->ArgNames({"n", "layout"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+// 1-D sizes shared by the benchmarks over vectors
+inline void vector_grid(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 24)
+    ->ArgName("n")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace cupynumeric::bench
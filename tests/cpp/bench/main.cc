@@ -0,0 +1,45 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "legate.h"
+#include "cupynumeric.h"
+
+int main(int argc, char** argv)
+{
+  // Consumes the --benchmark_* flags, e.g. --benchmark_format=json or --benchmark_filter
+  ::benchmark::Initialize(&argc, argv);
+  if (legate::start(argc, argv) != 0) {
+    return 1;
+  }
+  cupynumeric::initialize(argc, argv);
+
+  // The processor counts are fixed for the whole run; run.py sweeps them across processes
+  auto machine = legate::get_machine();
+  ::benchmark::AddCustomContext("cpus",
+                                std::to_string(machine.count(legate::mapping::TaskTarget::CPU)));
+  ::benchmark::AddCustomContext("omps",
+                                std::to_string(machine.count(legate::mapping::TaskTarget::OMP)));
+  ::benchmark::AddCustomContext("gpus",
+                                std::to_string(machine.count(legate::mapping::TaskTarget::GPU)));
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return legate::finish();
+}
@@ -0,0 +1,129 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Runs cupynumeric_bench once per processor configuration and merges the
+Google Benchmark JSON reports. With --baseline, compares the throughput of
+every benchmark against a previous report and fails on regressions."""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def run_config(binary, variant, threads, extra_args):
+    if variant == "cpu":
+        config = f"--cpus {threads}"
+    else:
+        config = f"--cpus 1 --omps 1 --ompthreads {threads}"
+    env = dict(os.environ)
+    env["LEGATE_CONFIG"] = config
+
+    with tempfile.NamedTemporaryFile(suffix=".json") as f:
+        cmd = [
+            binary,
+            f"--benchmark_out={f.name}",
+            "--benchmark_out_format=json",
+        ] + extra_args
+        print(f"LEGATE_CONFIG='{config}' {' '.join(cmd)}", flush=True)
+        subprocess.check_call(cmd, env=env, stdout=subprocess.DEVNULL)
+        report = json.load(f)
+
+    for bench in report["benchmarks"]:
+        bench["variant"] = variant
+        bench["threads"] = threads
+    return report
+
+
+def key(bench):
+    return (bench["name"], bench["variant"], bench["threads"])
+
+
+def compare(report, baseline, tolerance):
+    previous = {key(b): b for b in baseline["benchmarks"]}
+    regressions = []
+    for bench in report["benchmarks"]:
+        old = previous.get(key(bench))
+        if old is None or not old.get("items_per_second"):
+            continue
+        ratio = bench["items_per_second"] / old["items_per_second"]
+        bench["baseline_ratio"] = ratio
+        if ratio < 1.0 - tolerance:
+            regressions.append((bench, ratio))
+
+    for bench, ratio in regressions:
+        print(
+            f"REGRESSION {bench['name']} [{bench['variant']} x"
+            f"{bench['threads']}]: {ratio:.2f}x of baseline"
+        )
+    return len(regressions) == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--binary",
+        default="build/cupynumeric_bench",
+        help="Path to the cupynumeric_bench executable",
+    )
+    parser.add_argument(
+        "--variant",
+        choices=("cpu", "omp"),
+        default="omp",
+        help="Run on CPU processors or on one OpenMP processor",
+    )
+    parser.add_argument(
+        "--threads",
+        type=int,
+        nargs="+",
+        default=[1, 2, 4, 8],
+        help="Thread counts to sweep",
+    )
+    parser.add_argument(
+        "--output", default="bench.json", help="Merged JSON report"
+    )
+    parser.add_argument(
+        "--baseline", help="Previous report to check for regressions"
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.1,
+        help="Tolerated relative throughput loss against the baseline",
+    )
+    args, extra_args = parser.parse_known_args()
+
+    merged = None
+    for threads in args.threads:
+        report = run_config(args.binary, args.variant, threads, extra_args)
+        if merged is None:
+            merged = report
+        else:
+            merged["benchmarks"].extend(report["benchmarks"])
+
+    ok = True
+    if args.baseline is not None:
+        with open(args.baseline) as f:
+            ok = compare(merged, json.load(f), args.tolerance)
+
+    with open(args.output, "w") as f:
+        json.dump(merged, f, indent=2)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,112 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "common_utils.h"
+
+using namespace cupynumeric;
+
+namespace {
+
+// Dense reference for a rows x cols CSR matrix times a row-major cols x width operand
+std::vector<double> dense_product(const std::vector<int64_t>& indptr,
+                                  const std::vector<int64_t>& indices,
+                                  const std::vector<double>& data,
+                                  const std::vector<double>& rhs,
+                                  size_t width)
+{
+  const size_t rows = indptr.size() - 1;
+  std::vector<double> out(rows * width, 0.0);
+  for (size_t row = 0; row < rows; ++row) {
+    for (int64_t idx = indptr[row]; idx < indptr[row + 1]; ++idx) {
+      for (size_t col = 0; col < width; ++col) {
+        out[row * width + col] += data[idx] * rhs[indices[idx] * width + col];
+      }
+    }
+  }
+  return out;
+}
+
+// 6 x 7, with an empty row and a dense row
+const std::vector<int64_t> INDPTR{0, 2, 3, 3, 10, 12, 14};
+const std::vector<int64_t> INDICES{0, 4, 2, 0, 1, 2, 3, 4, 5, 6, 1, 5, 3, 6};
+const std::vector<double> DATA{
+  1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0};
+
+CsrMatrix make_matrix()
+{
+  return CsrMatrix(mk_array(INDPTR), mk_array(INDICES), mk_array(DATA), {6, 7});
+}
+
+TEST(Csr, test_spmv)
+{
+  auto a   = make_matrix();
+  auto rhs = mk_seq_vector<double>({7});
+  auto x   = mk_array(rhs);
+  auto y   = dot(a, x);
+  check_array_near(y, dense_product(INDPTR, INDICES, DATA, rhs, 1), {6});
+
+  // Products reuse the cached halos and can write into an existing array
+  auto out = zeros({6}, legate::float64());
+  a.dot(x, out);
+  check_array_near(out, dense_product(INDPTR, INDICES, DATA, rhs, 1), {6});
+}
+
+TEST(Csr, test_spmm)
+{
+  auto a   = make_matrix();
+  auto rhs = mk_seq_vector<double>({7, 3});
+  auto x   = mk_array(rhs, {7, 3});
+  auto y   = a.dot(x);
+  check_array_near(y, dense_product(INDPTR, INDICES, DATA, rhs, 3), {6, 3});
+}
+
+TEST(Csr, test_combined_with_dense_ops)
+{
+  // One step of a Richardson iteration, x + (b - A x)
+  auto a = make_matrix();
+  auto x = mk_array(std::vector<double>(7, 1.0));
+  auto b = zeros({6}, legate::float64());
+  b.fill(Scalar(100.0));
+  auto r = add(b, negative(dot(a, x)));
+
+  auto ax = dense_product(INDPTR, INDICES, DATA, std::vector<double>(7, 1.0), 1);
+  std::vector<double> expected(6);
+  for (size_t row = 0; row < 6; ++row) {
+    expected[row] = 100.0 - ax[row];
+  }
+  check_array_near(r, expected, {6});
+}
+
+TEST(Csr, test_no_nonzeros)
+{
+  auto a = CsrMatrix(mk_array(std::vector<int64_t>{0, 0, 0}),
+                     zeros({0}, legate::int64()),
+                     zeros({0}, legate::float64()),
+                     {2, 3});
+  auto y = a.dot(mk_array(std::vector<double>{1.0, 2.0, 3.0}));
+  check_array<double>(y, {0.0, 0.0}, {2});
+}
+
+TEST(CsrErrors, test_invalid)
+{
+  EXPECT_THROW(CsrMatrix(mk_array(INDPTR), mk_array(INDICES), mk_array(DATA), {5, 7}),
+               std::invalid_argument);
+  EXPECT_THROW(CsrMatrix(mk_array(INDPTR), mk_array(INDICES), mk_array(DATA), {6}),
+               std::invalid_argument);
+  EXPECT_THROW(make_matrix().dot(zeros({6}, legate::float64())), std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,75 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "common_utils.h"
+
+using namespace cupynumeric;
+
+namespace {
+
+uint64_t eager_volume() { return CuPyNumericRuntime::get_runtime()->max_eager_volume(); }
+
+TEST(Eager, test_scalar_arithmetic)
+{
+  auto x = zeros({1}, legate::int64());
+  x.fill(Scalar(int64_t(3)));
+  auto y = x * Scalar(int64_t(4)) + Scalar(int64_t(5));
+  y += x;
+  check_array<int64_t>(y, {20}, {1});
+}
+
+TEST(Eager, test_unary_and_convert)
+{
+  auto x = zeros({1}, legate::float64());
+  x.fill(Scalar(-2.5));
+  auto y = abs(negative(x));
+  check_array<double>(y, {2.5}, {1});
+  auto z = y.as_type(legate::int32());
+  check_array<int32_t>(z, {2}, {1});
+}
+
+TEST(Eager, test_full_reduction)
+{
+  const uint64_t n = std::min<uint64_t>(eager_volume(), 8);
+  auto x           = full({n}, Scalar(int32_t(2)));
+  auto total       = sum(x);
+  check_array<int32_t>(total, {static_cast<int32_t>(2 * n)});
+  auto big = amax(multiply(x, x));
+  check_array<int32_t>(big, {4});
+}
+
+TEST(Eager, test_promotion_with_large_array)
+{
+  const uint64_t n = eager_volume() + 5;
+  auto scale       = zeros({1}, legate::float32());
+  scale.fill(Scalar(2.0f));
+  auto big = full({n}, Scalar(1.5f));
+  auto res = multiply(big, scale);
+  check_array<float>(res, std::vector<float>(n, 3.0f), {n});
+  // The promoted array stays usable, both for tasks and for further operations
+  scale += scale;
+  check_array<float>(scale, {4.0f}, {1});
+}
+
+TEST(Eager, test_copies_share_values)
+{
+  auto x = zeros({2}, legate::int16());
+  auto y = x;
+  x.fill(Scalar(int16_t(7)));
+  check_array<int16_t>(y, {7, 7}, {2});
+}
+
+}  // namespace
@@ -0,0 +1,131 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <optional>
+
+#include "common_utils.h"
+
+using namespace cupynumeric;
+
+namespace {
+
+// The frontends only request the plain epilogue (alpha = 1, beta = 0), so these tests launch
+// MATMUL directly to cover the scaled lhs, the bias and the activation
+constexpr uint64_t M = 6;
+constexpr uint64_t K = 5;
+constexpr uint64_t N = 8;
+
+struct Epilogue {
+  double alpha;
+  double beta;
+  bool bias;
+  CuPyNumericMatMulActivation activation;
+};
+
+// Launches MATMUL with a fused epilogue over a 2 x 2 grid of result tiles, each of which sees
+// the whole contracted dimension
+void launch_matmul(
+  NDArray& lhs, NDArray& rhs1, NDArray& rhs2, std::optional<NDArray> bias, const Epilogue& e)
+{
+  auto runtime = CuPyNumericRuntime::get_runtime();
+  auto p_lhs   = lhs.get_store().partition_by_tiling({M / 2, N / 2});
+  auto p_rhs1  = rhs1.get_store().partition_by_tiling({M / 2, K});
+  auto p_rhs2  = rhs2.get_store().partition_by_tiling({K, N / 2});
+
+  auto task = runtime->create_task(CuPyNumericOpCode::CUPYNUMERIC_MATMUL, {2, 2});
+  task.add_output(p_lhs);
+  if (e.beta != 0.0) {
+    task.add_input(p_lhs);
+  }
+  task.add_input(p_rhs1, legate::SymbolicPoint{legate::dimension(0), legate::constant(0)});
+  task.add_input(p_rhs2, legate::SymbolicPoint{legate::constant(0), legate::dimension(1)});
+  if (bias.has_value()) {
+    task.add_input(bias->get_store().partition_by_tiling({M / 2, N / 2}));
+  }
+  task.add_scalar_arg(legate::Scalar(e.alpha));
+  task.add_scalar_arg(legate::Scalar(e.beta));
+  task.add_scalar_arg(legate::Scalar(static_cast<int32_t>(e.activation)));
+  runtime->submit(std::move(task));
+}
+
+template <typename T>
+void test_epilogue(const Epilogue& e, double abs_error)
+{
+  // Operands with both signs, so that the activation clamps some of the results
+  auto a = mk_seq_vector<T>({M, K}, T(0.25), T(-4));
+  auto b = mk_seq_vector<T>({K, N}, T(-0.125), T(2));
+  auto c = mk_seq_vector<T>({M, N}, T(0.5), T(-10));
+  auto d = mk_seq_vector<T>({M, N}, T(-0.75), T(15));
+
+  std::vector<T> expected(M * N);
+  for (uint64_t i = 0; i < M; ++i) {
+    for (uint64_t j = 0; j < N; ++j) {
+      double product = 0.0;
+      for (uint64_t l = 0; l < K; ++l) {
+        product += static_cast<double>(a[i * K + l]) * static_cast<double>(b[l * N + j]);
+      }
+      double value = e.alpha * product + e.beta * static_cast<double>(c[i * N + j]);
+      if (e.bias) {
+        value += static_cast<double>(d[i * N + j]);
+      }
+      if (e.activation == CUPYNUMERIC_MATMUL_ACTIVATION_RELU) {
+        value = std::max(value, 0.0);
+      }
+      expected[i * N + j] = static_cast<T>(value);
+    }
+  }
+
+  auto lhs  = mk_array(c, {M, N});
+  auto rhs1 = mk_array(a, {M, K});
+  auto rhs2 = mk_array(b, {K, N});
+  launch_matmul(lhs,
+                rhs1,
+                rhs2,
+                e.bias ? std::make_optional(mk_array(d, {M, N})) : std::nullopt,
+                e);
+  check_array_near(lhs, expected, {M, N}, abs_error);
+}
+
+TEST(MatMulEpilogue, Beta)
+{
+  const Epilogue e{2.0, 0.5, false, CUPYNUMERIC_MATMUL_ACTIVATION_NONE};
+  test_epilogue<double>(e, 1e-10);
+  test_epilogue<float>(e, 1e-4);
+}
+
+TEST(MatMulEpilogue, Bias)
+{
+  const Epilogue e{1.0, 0.0, true, CUPYNUMERIC_MATMUL_ACTIVATION_NONE};
+  test_epilogue<double>(e, 1e-10);
+  test_epilogue<float>(e, 1e-4);
+}
+
+TEST(MatMulEpilogue, Relu)
+{
+  const Epilogue e{1.0, 0.0, false, CUPYNUMERIC_MATMUL_ACTIVATION_RELU};
+  test_epilogue<double>(e, 1e-10);
+  test_epilogue<float>(e, 1e-4);
+}
+
+TEST(MatMulEpilogue, All)
+{
+  const Epilogue e{-1.5, 2.0, true, CUPYNUMERIC_MATMUL_ACTIVATION_RELU};
+  test_epilogue<double>(e, 1e-10);
+  test_epilogue<float>(e, 1e-4);
+}
+
+}  // namespace
@@ -0,0 +1,77 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <unistd.h>
+
+#include "common_utils.h"
+
+using namespace cupynumeric;
+
+namespace {
+
+std::string write_file(const std::vector<int32_t>& values)
+{
+  char name[] = "/tmp/cupynumeric_memmap_XXXXXX";
+  close(mkstemp(name));
+  std::ofstream out(name, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int32_t));
+  return name;
+}
+
+TEST(Memmap, Basic)
+{
+  std::vector<int32_t> values(5000);
+  std::iota(values.begin(), values.end(), 0);
+  auto filename = write_file(values);
+
+  auto x = memmap(filename, {50, 100}, legate::int32());
+  check_array(x, values, {50, 100});
+
+  std::remove(filename.c_str());
+}
+
+TEST(Memmap, Offset)
+{
+  std::vector<int32_t> values(5000);
+  std::iota(values.begin(), values.end(), 0);
+  auto filename = write_file(values);
+
+  // Offsets need not be page aligned
+  auto x = memmap(filename, {3, 4, 5}, legate::int32(), 12 * sizeof(int32_t));
+  std::vector<int32_t> x_gt(values.begin() + 12, values.begin() + 72);
+  check_array(x, x_gt, {3, 4, 5});
+
+  std::remove(filename.c_str());
+}
+
+TEST(Memmap, Invalid)
+{
+  std::vector<int32_t> values(10);
+  auto filename = write_file(values);
+
+  EXPECT_THROW(memmap(filename, {11}, legate::int32()), std::invalid_argument);
+  EXPECT_THROW(memmap(filename, {8}, legate::int32(), 12), std::invalid_argument);
+  EXPECT_THROW(memmap(filename, {2}, legate::int32(), -1), std::invalid_argument);
+  EXPECT_THROW(memmap(filename + ".missing", {2}, legate::int32()), std::runtime_error);
+
+  std::remove(filename.c_str());
+}
+
+}  // namespace
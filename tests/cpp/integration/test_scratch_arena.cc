@@ -0,0 +1,80 @@
+/* Copyright 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <gtest/gtest.h>
+#include "legate.h"
+#include "cupynumeric.h"
+#include "cupynumeric/utilities/scratch_arena.h"
+
+namespace {
+
+using cupynumeric::ScratchArena;
+using cupynumeric::ScratchBuffer;
+
+TEST(ScratchArena, Reuse)
+{
+  cupynumeric::scratch_arena_trim();
+  auto before = cupynumeric::scratch_arena_stats();
+
+  float* first = nullptr;
+  {
+    ScratchBuffer<float> buffer(1000);
+    first = buffer.ptr();
+    ASSERT_NE(first, nullptr);
+    for (size_t idx = 0; idx < 1000; ++idx) {
+      buffer[idx] = static_cast<float>(idx);
+    }
+    auto stats = cupynumeric::scratch_arena_stats();
+    EXPECT_EQ(stats.misses, before.misses + 1);
+    EXPECT_EQ(stats.bytes_in_use, before.bytes_in_use + ScratchArena::MIN_BLOCK_SIZE);
+  }
+
+  auto released = cupynumeric::scratch_arena_stats();
+  EXPECT_EQ(released.bytes_in_use, before.bytes_in_use);
+  EXPECT_EQ(released.bytes_cached, ScratchArena::MIN_BLOCK_SIZE);
+
+  {
+    // A request from the same size class gets the cached block back
+    ScratchBuffer<int32_t> buffer(500);
+    EXPECT_EQ(static_cast<void*>(buffer.ptr()), static_cast<void*>(first));
+    auto stats = cupynumeric::scratch_arena_stats();
+    EXPECT_EQ(stats.hits, before.hits + 1);
+    EXPECT_EQ(stats.bytes_cached, 0U);
+  }
+
+  cupynumeric::scratch_arena_trim();
+  EXPECT_EQ(cupynumeric::scratch_arena_stats().bytes_cached, 0U);
+}
+
+TEST(ScratchArena, SizeClasses)
+{
+  cupynumeric::scratch_arena_trim();
+  auto before = cupynumeric::scratch_arena_stats();
+  {
+    ScratchBuffer<char> empty(0);
+    EXPECT_EQ(empty.ptr(), nullptr);
+    ScratchBuffer<char> small(ScratchArena::MIN_BLOCK_SIZE + 1);
+    ScratchBuffer<char> moved(std::move(small));
+    EXPECT_EQ(small.ptr(), nullptr);
+    EXPECT_EQ(cupynumeric::scratch_arena_stats().bytes_in_use,
+              before.bytes_in_use + 2 * ScratchArena::MIN_BLOCK_SIZE);
+  }
+  auto after = cupynumeric::scratch_arena_stats();
+  EXPECT_EQ(after.misses, before.misses + 1);
+  EXPECT_EQ(after.bytes_cached, 2 * ScratchArena::MIN_BLOCK_SIZE);
+  cupynumeric::scratch_arena_trim();
+}
+
+}  // namespace
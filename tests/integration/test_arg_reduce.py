@@ -119,6 +119,25 @@ class TestArgMaxAndArgMin:
             func_num(in_num, keepdims=keepdims),
         )
 
+    @pytest.mark.parametrize("func_name", ARG_FUNCS)
+    @pytest.mark.parametrize(
+        "dtype", (np.float32, np.float64, np.int32, np.int64)
+    )
+    def test_argmax_and_argmin_large(self, func_name, dtype):
+        # Large enough to be split across threads and tasks; the values are
+        # distinct, so the answer does not depend on how ties are broken
+        in_np = np.random.permutation(300 * 700).astype(dtype)
+        in_np = in_np.reshape(300, 700)
+        in_num = num.array(in_np)
+
+        func_np = getattr(np, func_name)
+        func_num = getattr(num, func_name)
+
+        assert func_np(in_np) == func_num(in_num)
+        # Strided views take the per-point path
+        assert func_np(in_np[::2, 1::3]) == func_num(in_num[::2, 1::3])
+        assert func_np(in_np.T) == func_num(in_num.T)
+
     @pytest.mark.parametrize("func_name", ARG_FUNCS)
     @pytest.mark.parametrize("ndim", range(1, LEGATE_MAX_DIM + 1))
     @pytest.mark.parametrize("keepdims", [True, False])
@@ -84,7 +84,7 @@ def test_array_ufunc_accumulate():
     res_num = np.add.accumulate(vec_num)
 
     assert np.array_equal(res_np, res_num)
-    assert isinstance(res_num, np.ndarray)  # unimplemented
+    assert isinstance(res_num, num.ndarray)  # implemented
 
 
 def test_array_ufunc_reduceat():
@@ -89,6 +89,26 @@ class TestPackbits(object):
             out_num = num.packbits(in_num, axis=axis, bitorder=bitorder)
             assert np.array_equal(out_np, out_num)
 
+    @pytest.mark.parametrize("shape", ((1001,), (3, 517), (67, 9), (9, 6, 70)))
+    @pytest.mark.parametrize("dtype", ("?", "b", "h", "I", "q"))
+    @pytest.mark.parametrize("bitorder", ("little", "big"))
+    def test_large(self, shape, dtype, bitorder):
+        # Long rows take the vector paths; multiples of 256 are nonzero
+        # values with a zero low byte
+        in_np = np.random.randint(low=0, high=2, size=shape).astype(dtype)
+        if dtype not in ("?", "b"):
+            in_np *= 256
+        in_num = num.array(in_np)
+
+        for axis in range(len(shape)):
+            out_np = np.packbits(in_np, axis=axis, bitorder=bitorder)
+            out_num = num.packbits(in_num, axis=axis, bitorder=bitorder)
+            assert np.array_equal(out_np, out_num)
+
+        out_np = np.packbits(in_np[..., ::3], bitorder=bitorder)
+        out_num = num.packbits(in_num[..., ::3], bitorder=bitorder)
+        assert np.array_equal(out_np, out_num)
+
 
 class TestUnpackbits(object):
     def test_none_arr(self):
@@ -180,6 +200,21 @@ class TestUnpackbits(object):
             out_num = num.unpackbits(in_num, axis=axis, bitorder=bitorder)
             assert np.array_equal(out_np, out_num)
 
+    @pytest.mark.parametrize("shape", ((1001,), (3, 517), (67, 9), (9, 6, 70)))
+    @pytest.mark.parametrize("bitorder", ("little", "big"))
+    def test_large(self, shape, bitorder):
+        in_np = np.random.randint(low=0, high=256, size=shape, dtype="B")
+        in_num = num.array(in_np)
+
+        for axis in range(len(shape)):
+            out_np = np.unpackbits(in_np, axis=axis, bitorder=bitorder)
+            out_num = num.unpackbits(in_num, axis=axis, bitorder=bitorder)
+            assert np.array_equal(out_np, out_num)
+
+        out_np = np.unpackbits(in_np[..., ::3], bitorder=bitorder)
+        out_num = num.unpackbits(in_num[..., ::3], bitorder=bitorder)
+        assert np.array_equal(out_np, out_num)
+
     @pytest.mark.parametrize("ndim", range(1, LEGATE_MAX_DIM + 1))
     @pytest.mark.parametrize("bitorder", ("little", "big"))
     @pytest.mark.parametrize("count", (-2, 0, 2, 5))
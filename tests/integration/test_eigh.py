@@ -0,0 +1,163 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+from utils.comparisons import allclose
+
+import cupynumeric as num
+
+SIZES = (1, 8, 9, 255)
+
+RTOL = {
+    np.dtype(np.float32): 1e-1,
+    np.dtype(np.complex64): 1e-1,
+    np.dtype(np.float64): 1e-5,
+    np.dtype(np.complex128): 1e-5,
+}
+
+ATOL = {
+    np.dtype(np.float32): 1e-3,
+    np.dtype(np.complex64): 1e-3,
+    np.dtype(np.float64): 1e-8,
+    np.dtype(np.complex128): 1e-8,
+}
+
+
+def _make_hermitian(shape, dtype):
+    a = np.random.rand(*shape).astype(dtype)
+    if np.issubdtype(dtype, np.complexfloating):
+        a = a + 1j * np.random.rand(*shape).astype(dtype)
+    return a + np.swapaxes(a, -1, -2).conj()
+
+
+def _check_eigh(a, w, v):
+    rtol = RTOL[np.dtype(a.dtype)]
+    atol = ATOL[np.dtype(a.dtype)]
+    # A @ v == v * w for every eigenpair
+    lhs = num.matmul(a, v)
+    rhs = v * w[..., np.newaxis, :]
+    assert allclose(lhs, rhs, rtol=rtol, atol=atol, check_dtype=False)
+
+
+@pytest.mark.parametrize("n", SIZES)
+@pytest.mark.parametrize(
+    "dtype", (np.float32, np.float64, np.complex64, np.complex128)
+)
+def test_eigh(n, dtype):
+    a = _make_hermitian((n, n), dtype)
+
+    w, v = num.linalg.eigh(a)
+    w_np = np.linalg.eigvalsh(a)
+
+    rtol = RTOL[np.dtype(dtype)]
+    atol = ATOL[np.dtype(dtype)]
+    assert allclose(w, w_np, rtol=rtol, atol=atol)
+    _check_eigh(a, w, v)
+
+
+@pytest.mark.parametrize("uplo", ("L", "U"))
+@pytest.mark.parametrize("dtype", (np.float64, np.complex128))
+def test_eigh_uplo(uplo, dtype):
+    a = _make_hermitian((9, 9), dtype)
+    # Poison the triangle that must not be read
+    if uplo == "L":
+        a_in = np.tril(a) + np.triu(np.full_like(a, 100), 1)
+    else:
+        a_in = np.triu(a) + np.tril(np.full_like(a, 100), -1)
+
+    w, v = num.linalg.eigh(a_in, UPLO=uplo)
+    w_np = np.linalg.eigvalsh(a)
+
+    assert allclose(w, w_np)
+    _check_eigh(a, w, v)
+
+
+@pytest.mark.parametrize("shape", ((2, 8, 8), (3, 2, 9, 9), (4, 1, 1)))
+@pytest.mark.parametrize("dtype", (np.float32, np.complex128))
+def test_eigh_batched(shape, dtype):
+    a = _make_hermitian(shape, dtype)
+
+    w, v = num.linalg.eigh(a)
+    w_np = np.linalg.eigvalsh(a)
+
+    rtol = RTOL[np.dtype(dtype)]
+    atol = ATOL[np.dtype(dtype)]
+    assert w.shape == w_np.shape
+    assert allclose(w, w_np, rtol=rtol, atol=atol)
+    _check_eigh(a, w, v)
+
+
+@pytest.mark.parametrize("shape", ((8, 8), (3, 9, 9)))
+@pytest.mark.parametrize("dtype", (np.float64, np.complex64))
+def test_eigvalsh(shape, dtype):
+    a = _make_hermitian(shape, dtype)
+
+    w = num.linalg.eigvalsh(a)
+    w_np = np.linalg.eigvalsh(a)
+
+    rtol = RTOL[np.dtype(dtype)]
+    atol = ATOL[np.dtype(dtype)]
+    assert w.dtype == w_np.dtype
+    assert allclose(w, w_np, rtol=rtol, atol=atol)
+
+
+@pytest.mark.parametrize("dtype", (np.int32, np.int64))
+def test_eigh_dtype_int(dtype):
+    a = np.array([[2, 1, 0], [1, 3, 1], [0, 1, 4]], dtype=dtype)
+
+    w, v = num.linalg.eigh(a)
+    w_np, _ = np.linalg.eigh(a)
+
+    assert w.dtype == np.float64
+    assert allclose(w, w_np)
+    _check_eigh(a.astype(np.float64), w, v)
+
+
+class TestEighErrors:
+    def setup_method(self):
+        self.n = 3
+        self.a = num.random.rand(self.n, self.n).astype(np.float64)
+
+    def test_a_bad_dim(self):
+        a = num.random.rand(self.n).astype(np.float64)
+        msg = "Array must be at least two-dimensional"
+        with pytest.raises(num.linalg.LinAlgError, match=msg):
+            num.linalg.eigh(a)
+        with pytest.raises(num.linalg.LinAlgError, match=msg):
+            num.linalg.eigvalsh(a)
+
+    def test_a_not_square(self):
+        a = num.random.rand(self.n, self.n + 1).astype(np.float64)
+        msg = "Last 2 dimensions of the array must be square"
+        with pytest.raises(num.linalg.LinAlgError, match=msg):
+            num.linalg.eigh(a)
+
+    def test_bad_uplo(self):
+        with pytest.raises(ValueError):
+            num.linalg.eigh(self.a, UPLO="X")
+
+    def test_a_bad_dtype_float16(self):
+        a = self.a.astype(np.float16)
+        msg = "array type float16 is unsupported in linalg"
+        with pytest.raises(TypeError, match=msg):
+            num.linalg.eigh(a)
+
+
+if __name__ == "__main__":
+    import sys
+
+    np.random.seed(12345)
+    sys.exit(pytest.main(sys.argv))
@@ -283,6 +283,52 @@ def test_optimize(optimize):
     assert allclose(np_res, num_res)
 
 
+@pytest.mark.parametrize("optimize", [False, "greedy"])
+def test_repeated(optimize):
+    # Repeated calls reuse the contraction plan and write into the
+    # intermediates of the previous call; earlier results must stay intact
+    expr = "ij,jk,kl,lm->im"
+    shapes = [(16, 24), (24, 8), (8, 32), (32, 12)]
+    results = []
+    for _ in range(3):
+        np_ops = [np.random.rand(*shape) for shape in shapes]
+        num_ops = [num.array(op) for op in np_ops]
+        np_res = np.einsum(expr, *np_ops, optimize=optimize)
+        num_res = num.einsum(expr, *num_ops, optimize=optimize)
+        assert allclose(np_res, num_res)
+        results.append((np_res, num_res))
+    for np_res, num_res in results:
+        assert allclose(np_res, num_res)
+
+    # A different dtype must not pick up the float64 plan
+    np_ops = [np.random.rand(*shape).astype(np.float32) for shape in shapes]
+    num_ops = [num.array(op) for op in np_ops]
+    num_res = num.einsum(expr, *num_ops, optimize=optimize)
+    assert num_res.dtype == np.float32
+    assert allclose(np.einsum(expr, *np_ops, optimize=optimize), num_res)
+
+
+def test_plan_buffers(monkeypatch):
+    from cupynumeric._module import linalg_mvp
+
+    expr = "ij,jk,kl->il"
+    ops = [num.ones((8, 8)) for _ in range(3)]
+    num.clear_einsum_cache()
+    num.einsum(expr, *ops, optimize=False)
+    assert len(linalg_mvp._einsum_plans) == 1
+    (plan,) = linalg_mvp._einsum_plans.values()
+    assert plan.buffer_bytes > 0
+
+    # Intermediates beyond the budget are not kept between calls
+    monkeypatch.setattr(linalg_mvp, "_EINSUM_BUFFER_BUDGET", 0)
+    res = num.einsum(expr, *ops, optimize=False)
+    assert plan.buffer_bytes == 0
+    assert allclose(res, np.full((8, 8), 64.0))
+
+    num.clear_einsum_cache()
+    assert len(linalg_mvp._einsum_plans) == 0
+
+
 def test_expr_opposite():
     a = np.random.rand(256, 256)
     b = np.random.rand(256, 256)
@@ -28,15 +28,15 @@ def test_ufunc():
     in_num = num.array([0, 1, 2, 3])
     in_np = in_num.__array__()
 
-    # This test uses logical_and.accumulate because it is currently
+    # This test uses logical_and.outer because it is currently
     # unimplemented, and we want to verify a behaviour of unimplemented ufunc
-    # methods. If logical_and.accumulate becomes implemented in the future,
+    # methods. If logical_and.outer becomes implemented in the future,
     # this assertion will start to fail, and a new (unimplemented) ufunc method
     # should be found to replace it
-    assert not num.logical_and.accumulate._cupynumeric.implemented
+    assert not num.logical_and.outer._cupynumeric.implemented
 
-    out_num = num.logical_and.accumulate(in_num)
-    out_np = np.logical_and.accumulate(in_np)
+    out_num = num.logical_and.outer(in_num, in_num)
+    out_np = np.logical_and.outer(in_np, in_np)
     assert np.array_equal(out_num, out_np)
 
 
@@ -37,6 +37,105 @@ def test_load():
         assert np.array_equal(np_arr, num_arr)
 
 
+@pytest.mark.parametrize("order", ("C", "F"))
+@pytest.mark.parametrize("dtype", (np.int16, np.float64, np.complex64))
+def test_load_large(order, dtype):
+    np_arr = np.asarray(
+        np.arange(3 * 500 * 70).reshape((3, 500, 70)).astype(dtype),
+        order=order,
+    )
+    with NamedTemporaryFile(suffix=".npy", delete=False) as f:
+        fname = f.name
+        np.save(f, np_arr)
+
+    num_arr = num.load(fname)
+    assert isinstance(num_arr, num.ndarray)
+    assert np.array_equal(np_arr, num_arr)
+
+
+@pytest.mark.parametrize("order", ("C", "F"))
+def test_load_mmap(order):
+    np_arr = np.asarray(
+        np.arange(400 * 300, dtype=np.float32).reshape((400, 300)),
+        order=order,
+    )
+    with NamedTemporaryFile(suffix=".npy", delete=False) as f:
+        fname = f.name
+        np.save(f, np_arr)
+
+    num_arr = num.load(fname, mmap_mode="r")
+    assert isinstance(num_arr, num.ndarray)
+    assert not num_arr.flags.writeable
+    assert np.array_equal(np_arr, num_arr)
+    assert np.array_equal(np_arr.sum(axis=0), num_arr.sum(axis=0))
+
+    with pytest.raises(ValueError):
+        num_arr[0, 0] = 1
+
+    # Updates to copies never reach the read-only mapping
+    num_copy = num_arr.copy()
+    num_copy += 1
+    assert np.array_equal(np_arr + 1, num_copy)
+    assert np.array_equal(np_arr, num_arr)
+    assert np.array_equal(np.load(fname), np_arr)
+
+    with pytest.raises(NotImplementedError):
+        num.load(fname, mmap_mode="r+")
+
+
+@pytest.mark.parametrize("shape", ((7,), (1000, 37), (4, 5, 600)), ids=str)
+def test_save(shape):
+    np_arr = np.random.random(shape)
+    with NamedTemporaryFile(suffix=".npy", delete=False) as f:
+        fname = f.name
+
+    num.save(fname, num.array(np_arr))
+    assert np.array_equal(np.load(fname), np_arr)
+
+    # Views are written in C order like NumPy does
+    num.save(fname, num.array(np_arr).T)
+    assert np.array_equal(np.load(fname), np_arr.T)
+
+
+def test_overwrite_larger_file():
+    # Stale bytes of a previous, larger file must not survive
+    with NamedTemporaryFile(suffix=".npy", delete=False) as f:
+        fname = f.name
+    np.save(fname, np.arange(1000))
+    num.save(fname, num.arange(10))
+    assert np.array_equal(np.load(fname), np.arange(10))
+
+    num.arange(10, dtype=np.int64).tofile(fname)
+    assert np.array_equal(np.fromfile(fname, dtype=np.int64), np.arange(10))
+
+
+def test_save_appends_extension():
+    with NamedTemporaryFile(suffix=".npy", delete=False) as f:
+        fname = f.name
+    base = fname[: -len(".npy")]
+    num.save(base, num.arange(10))
+    assert np.array_equal(np.load(fname), np.arange(10))
+
+
+def test_tofile_fromfile():
+    np_arr = np.arange(20000, dtype=np.int32).reshape((200, 100))
+    with NamedTemporaryFile(suffix=".bin", delete=False) as f:
+        fname = f.name
+
+    num.array(np_arr).tofile(fname)
+    assert np.array_equal(np.fromfile(fname, dtype=np.int32), np_arr.ravel())
+
+    num_arr = num.fromfile(fname, dtype=np.int32)
+    assert isinstance(num_arr, num.ndarray)
+    assert np.array_equal(num_arr, np_arr.ravel())
+
+    num_arr = num.fromfile(fname, dtype=np.int32, count=500, offset=40)
+    assert np.array_equal(num_arr, np_arr.ravel()[10:510])
+
+    with pytest.raises(ValueError):
+        num.fromfile(fname, dtype=np.int32, count=20001)
+
+
 def test_non_existent_file():
     with pytest.raises(OSError):
         num.load("does-not-exist.npy")
@@ -123,6 +123,23 @@ def test_where():
     )
 
 
+@pytest.mark.parametrize("pos", (None, 0, 12345, (1 << 20) - 1))
+def test_early_exit(pos):
+    # The full reductions stop scanning once the answer is known, so put the
+    # deciding element at different points of a large input
+    ones = np.ones(1 << 20, dtype=bool)
+    zeros = np.zeros(1 << 20, dtype=bool)
+    ints = np.arange(1 << 20, dtype=np.int64)
+    if pos is not None:
+        ones[pos] = False
+        zeros[pos] = True
+    value = -1 if pos is None else pos
+
+    assert num.all(num.array(ones)) == np.all(ones)
+    assert num.any(num.array(zeros)) == np.any(zeros)
+    assert (value in num.array(ints)) == (value in ints)
+
+
 class TestAnyAllErrors:
     def setup_method(self):
         input = [[[5, 10], [0, 100]]]
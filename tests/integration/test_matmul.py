@@ -15,7 +15,7 @@
 
 import numpy as np
 import pytest
-from legate.core import LEGATE_MAX_DIM
+from legate.core import LEGATE_MAX_DIM, get_legate_runtime
 from utils.comparisons import allclose
 from utils.contractions import (
     check_default,
@@ -124,6 +124,151 @@ def test_2d_matmul(mnk):
     assert allclose(np_a @ np_b, num_a @ num_b)
 
 
+@pytest.mark.parametrize("k", (2000, 20000))
+def test_2d_matmul_deep(k):
+    # A contraction much longer than the result is split across replicas of
+    # the result when there are processors to spare
+    np_a = np.random.random((16, k))
+    np_b = np.random.random((k, 12))
+    num_a = num.array(np_a)
+    num_b = num.array(np_b)
+    assert allclose(np_a @ np_b, num_a @ num_b)
+
+
+@pytest.mark.parametrize("a_transposed", (False, True))
+@pytest.mark.parametrize("b_transposed", (False, True))
+def test_half_matmul_panels(a_transposed, b_transposed):
+    # Deep enough that half-precision inputs are staged in several panels
+    m, n, k = 600, 700, 3000
+    np_a = np.random.random((k, m) if a_transposed else (m, k))
+    np_b = np.random.random((n, k) if b_transposed else (k, n))
+    np_a = np_a.astype(np.float16)
+    np_b = np_b.astype(np.float16)
+    num_a = num.array(np_a)
+    num_b = num.array(np_b)
+    if a_transposed:
+        np_a, num_a = np_a.T, num_a.T
+    if b_transposed:
+        np_b, num_b = np_b.T, num_b.T
+
+    expected = np_a.astype(np.float32) @ np_b.astype(np.float32)
+    out = num_a @ num_b
+    assert out.dtype == np.float16
+    assert allclose(expected.astype(np.float16), out, rtol=1e-2)
+
+
+@pytest.mark.parametrize("dtype", (np.float16, np.float32, np.complex64))
+def test_matmul_into_view(dtype):
+    # The result is written through the task's output epilogue, which must
+    # leave the rest of the output array untouched
+    np_a = np.random.random((40, 30)).astype(dtype)
+    np_b = np.random.random((30, 20)).astype(dtype)
+    np_out = np.full((50, 25), 7, dtype=dtype)
+    num_out = num.array(np_out)
+
+    np.matmul(np_a, np_b, out=np_out[5:45, 3:23])
+    num.matmul(num.array(np_a), num.array(np_b), out=num_out[5:45, 3:23])
+    rtol = 1e-2 if dtype == np.float16 else 1e-5
+    assert num_out.dtype == dtype
+    assert allclose(np_out, num_out, rtol=rtol)
+
+
+@pytest.mark.parametrize(
+    "dtype", (np.float16, np.float32, np.float64, np.complex64, np.complex128)
+)
+@pytest.mark.parametrize(
+    "shapes",
+    (
+        ((64, 8, 5), (64, 5, 7)),
+        ((3, 1, 9), (3, 9, 1)),
+        # More matrices than threads, one GEMM per thread
+        ((128, 24, 32), (128, 32, 16)),
+        # Fewer matrices than threads, each GEMM multithreaded
+        ((2, 200, 150), (2, 150, 100)),
+    ),
+    ids=str,
+)
+def test_batched_matmul(dtype, shapes):
+    # Many small matrices multiplied pairwise along the leading dimension
+    np_a = np.random.random(shapes[0]).astype(dtype)
+    np_b = np.random.random(shapes[1]).astype(dtype)
+    num_a = num.array(np_a)
+    num_b = num.array(np_b)
+
+    rtol = 1e-2 if dtype == np.float16 else 1e-5
+    assert allclose(np_a @ np_b, num_a @ num_b, rtol=rtol)
+    assert allclose(
+        np.einsum("bij,bjk->bik", np_a, np_b),
+        num.einsum("bij,bjk->bik", num_a, num_b),
+        rtol=rtol,
+    )
+    # Operands stored with their matrix dimensions transposed
+    np_at = np.ascontiguousarray(np_a.swapaxes(1, 2))
+    np_bt = np.ascontiguousarray(np_b.swapaxes(1, 2))
+    assert allclose(
+        np.einsum("bji,bkj->bik", np_at, np_bt),
+        num.einsum("bji,bkj->bik", num.array(np_at), num.array(np_bt)),
+        rtol=rtol,
+    )
+
+
+@pytest.mark.skipif(
+    get_legate_runtime().node_count > 1,
+    reason="performance counters only cover this process",
+)
+@pytest.mark.parametrize(
+    "shapes",
+    (((128, 24, 32), (128, 32, 16)), ((2, 200, 150), (2, 150, 100))),
+    ids=str,
+)
+def test_batched_matmul_task(shapes):
+    np_a = np.random.random(shapes[0])
+    np_b = np.random.random(shapes[1])
+    num_a = num.array(np_a)
+    num_b = num.array(np_b)
+    with num.perf_counters() as report:
+        num_c = num_a @ num_b
+    assert allclose(np_a @ np_b, num_c)
+    assert any(r.op == "BATCHED_MATMUL" for r in report.records)
+
+
+@pytest.mark.parametrize("dtype", (np.float32, np.float64, np.complex64))
+@pytest.mark.parametrize("transposed", (False, True))
+def test_batched_matvec(dtype, transposed):
+    # Leading dimensions of the matrix are batched matrix-vector products
+    shape = (6, 50, 60)
+    if transposed:
+        shape = shape[:-2] + shape[-2:][::-1]
+    np_a = np.random.random(shape).astype(dtype)
+    np_x = np.random.random(60).astype(dtype)
+    num_a = num.array(np_a)
+    num_x = num.array(np_x)
+    if transposed:
+        np_a, num_a = np_a.swapaxes(-1, -2), num_a.swapaxes(-1, -2)
+
+    assert allclose(np.matmul(np_a, np_x), num.matmul(num_a, num_x))
+
+
+@pytest.mark.parametrize("dtype", (np.float16, np.float32, np.complex128))
+def test_strided_matvec(dtype):
+    # Views whose strides are not unit in the usual places
+    np_a = np.random.random((40, 30, 5)).astype(dtype)
+    np_b = np.random.random((30, 7)).astype(dtype)
+    num_a = num.array(np_a)
+    num_b = num.array(np_b)
+
+    # Neither dimension of the matrix is contiguous
+    assert allclose(
+        np_a[:, :, 2] @ np_b[:, 3], num_a[:, :, 2] @ num_b[:, 3], rtol=1e-2
+    )
+    # A transposed matrix and a vector that is far from contiguous
+    assert allclose(
+        np_a[:, 0, :].T @ np_a[:, 1, 4],
+        num_a[:, 0, :].T @ num_a[:, 1, 4],
+        rtol=1e-2,
+    )
+
+
 class TestMatmulErrors:
     @pytest.mark.parametrize(
         "shapesAB",
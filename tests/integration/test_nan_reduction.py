@@ -363,6 +363,27 @@ class TestNanReductions:
         out_num = num.nanmin(arr, where=True, initial=10)
         assert allclose(out_np, out_num)
 
+    @pytest.mark.parametrize("func_name", NAN_FUNCS)
+    def test_where_skewed(self, func_name):
+        # NaNs and masked-out points are packed into the two ends of the
+        # input so that the work per point is uneven across the array
+        if func_name == "nanprod":
+            arr_np = np.ones(1 << 18)
+        else:
+            arr_np = np.random.random(1 << 18) + 0.5
+        arr_np[: 1 << 16] = np.nan
+        where_np = np.ones(arr_np.shape, dtype=bool)
+        where_np[-(1 << 16) :] = False
+        kwargs = {"nanmax": {"initial": 0}, "nanmin": {"initial": 10}}.get(
+            func_name, {}
+        )
+
+        out_np = getattr(np, func_name)(arr_np, where=where_np, **kwargs)
+        out_num = getattr(num, func_name)(
+            num.array(arr_np), where=num.array(where_np), **kwargs
+        )
+        assert allclose(out_np, out_num)
+
 
 class TestCornerCases:
     """
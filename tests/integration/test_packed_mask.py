@@ -0,0 +1,183 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Comparisons may store their results bit-packed; these tests check that
+# every consumer of such masks, and every fallback that unpacks them, agrees
+# with NumPy. Row lengths that are not multiples of 8 exercise the padding,
+# and rows longer than PACKED_MASK_CHUNK (4096) the chunked OpenMP loops.
+
+import numpy as np
+import pytest
+from utils.generators import mk_seq_array
+
+import cupynumeric as num
+from cupynumeric._thunk.deferred import DeferredArray
+from cupynumeric.runtime import runtime
+from cupynumeric.settings import settings
+
+SHAPES = (
+    (5,),
+    (37,),
+    (1000,),
+    (6, 13),
+    (4, 9, 17),
+    (3, 8, 16),
+    (20000,),
+    (3, 10007),
+)
+
+# Comparisons only pack their results on machines without GPUs
+PACKED = runtime.num_gpus == 0
+
+
+@pytest.fixture(autouse=True, scope="module")
+def packed_masks():
+    # Packed masks are opt-in, so turn them on for every test here
+    settings.packed_masks = True
+    yield
+    settings.packed_masks.unset_value()
+
+
+def _inputs(shape):
+    a = mk_seq_array(np, shape) % 7
+    a_num = mk_seq_array(num, shape) % 7
+    return a, a_num
+
+
+def _check_packed(mask_num):
+    # Small arrays may be eager, and those are never packed
+    thunk = mask_num._thunk
+    if PACKED and isinstance(thunk, DeferredArray):
+        assert thunk._packed is not None
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+@pytest.mark.parametrize(
+    "op", ("less", "less_equal", "greater", "greater_equal", "equal")
+)
+def test_compare(shape, op):
+    a, a_num = _inputs(shape)
+    mask = getattr(np, op)(a, 3)
+    mask_num = getattr(num, op)(a_num, 3)
+    _check_packed(mask_num)
+    assert np.array_equal(mask_num, mask)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_where(shape):
+    a, a_num = _inputs(shape)
+    mask_num = a_num > 2
+    _check_packed(mask_num)
+    res = np.where(a > 2, a, -a)
+    res_num = num.where(mask_num, a_num, -a_num)
+    assert np.array_equal(res_num, res)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_nonzero(shape):
+    a, a_num = _inputs(shape)
+    mask_num = a_num != 0
+    _check_packed(mask_num)
+    res = np.nonzero(a != 0)
+    res_num = num.nonzero(mask_num)
+    assert len(res_num) == len(res)
+    for r, r_num in zip(res, res_num):
+        assert np.array_equal(r_num, r)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_boolean_indexing(shape):
+    a, a_num = _inputs(shape)
+    mask_num = a_num < 4
+    _check_packed(mask_num)
+    assert np.array_equal(a_num[mask_num], a[a < 4])
+
+    mask_num = a_num >= 5
+    _check_packed(mask_num)
+    a[a >= 5] = 0
+    a_num[mask_num] = 0
+    assert np.array_equal(a_num, a)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_boolean_set_array(shape):
+    a, a_num = _inputs(shape)
+    mask = a == 2
+    a[mask] = np.arange(np.count_nonzero(mask))
+    mask_num = a_num == 2
+    _check_packed(mask_num)
+    a_num[mask_num] = num.arange(num.count_nonzero(mask_num))
+    assert np.array_equal(a_num, a)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_putmask(shape):
+    a, a_num = _inputs(shape)
+    mask_num = a_num > 4
+    _check_packed(mask_num)
+    np.putmask(a, a > 4, 42)
+    num.putmask(a_num, mask_num, 42)
+    assert np.array_equal(a_num, a)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+@pytest.mark.parametrize("func", ("sum", "max", "any", "all"))
+def test_reduction_where(shape, func):
+    a, a_num = _inputs(shape)
+    kwargs = {"initial": 0} if func == "max" else {}
+    res = getattr(np, func)(a, where=a > 1, **kwargs)
+    res_num = getattr(num, func)(a_num, where=a_num > 1, **kwargs)
+    assert np.array_equal(res_num, res)
+
+
+@pytest.mark.parametrize("shape", SHAPES, ids=str)
+def test_fallbacks(shape):
+    # Operations without native support see the unpacked values
+    a, a_num = _inputs(shape)
+    mask = a < 3
+    mask_num = a_num < 3
+    _check_packed(mask_num)
+    assert np.array_equal(mask_num.astype(np.int32), mask.astype(np.int32))
+    assert np.array_equal(np.logical_not(mask_num), np.logical_not(mask))
+    assert np.array_equal(mask_num[..., 1:], mask[..., 1:])
+    assert np.array_equal(num.sum(mask_num, axis=-1), np.sum(mask, axis=-1))
+    assert np.array_equal(a_num[mask_num & (a_num > 0)], a[mask & (a > 0)])
+
+
+def test_out_view():
+    # Comparisons into views must write through to the viewed array
+    a, a_num = _inputs((40,))
+    out = np.zeros(40, dtype=bool)
+    out_num = num.zeros(40, dtype=bool)
+    np.less(a[::2], 3, out=out[::2])
+    num.less(a_num[::2], 3, out=out_num[::2])
+    assert np.array_equal(out_num, out)
+
+
+def test_reused_mask():
+    a, a_num = _inputs((6, 13))
+    mask = a > 3
+    mask_num = a_num > 3
+    _check_packed(mask_num)
+    assert np.array_equal(num.where(mask_num, a_num, 0), np.where(mask, a, 0))
+    assert np.array_equal(a_num[mask_num], a[mask])
+    assert np.array_equal(mask_num, mask)
+    assert np.array_equal(num.where(mask_num, a_num, 0), np.where(mask, a, 0))
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,81 @@
+# Copyright 2024 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import json
+from tempfile import NamedTemporaryFile
+
+import numpy as np
+import pytest
+from legate.core import get_legate_runtime
+
+import cupynumeric as num
+
+SIZE = 100000
+
+
+def test_binary_op():
+    a = num.ones(SIZE)
+    b = num.ones(SIZE)
+    with num.perf_counters() as report:
+        c = a + b
+    assert np.array_equal(c, np.full(SIZE, 2.0))
+
+    records = [r for r in report.records if r.op == "BINARY_OP"]
+    bytes_read = sum(r.bytes_read for r in records)
+    bytes_written = sum(r.bytes_written for r in records)
+    if get_legate_runtime().node_count == 1:
+        assert sum(r.launches for r in records) > 0
+        assert bytes_read == 2 * SIZE * 8
+        assert bytes_written == SIZE * 8
+    else:
+        # Each rank only counts the tasks it executed itself, which may be
+        # none of them
+        assert bytes_read <= 2 * SIZE * 8
+        assert bytes_written <= SIZE * 8
+    for r in records:
+        assert r.dense_launches + r.strided_launches == r.launches
+
+
+def test_outside_block_not_counted():
+    a = num.ones(SIZE)
+    with num.perf_counters() as report:
+        pass
+    a + a
+    assert all(r.op != "BINARY_OP" for r in report.records)
+
+
+@pytest.mark.parametrize("suffix", (".csv", ".json"))
+def test_dump(suffix):
+    a = num.ones(SIZE)
+    with num.perf_counters() as report:
+        a.sum()
+
+    with NamedTemporaryFile(suffix=suffix) as f:
+        report.dump(f.name)
+        with open(f.name) as g:
+            if suffix == ".json":
+                rows = json.load(g)
+                assert len(rows) == len(report.records)
+                assert all("gbps" in row for row in rows)
+            else:
+                lines = g.read().splitlines()
+                assert lines[0].startswith("op,variant,launches")
+                assert len(lines) == len(report.records) + 1
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -329,6 +329,46 @@ def test_indexed():
     assert allclose(num.sum(x), np.sum(x_np))
 
 
+# Shapes that exercise the inner-axis and outer-axis engines with both few
+# long rows and many short ones
+LAYOUT_SIZES = [(3, 70000), (70000, 3), (2, 40000, 3), (4, 2500, 1030)]
+
+
+@pytest.mark.parametrize("size", LAYOUT_SIZES, ids=str)
+@pytest.mark.parametrize("op", ["sum", "max", "argmax"])
+def test_axis_layouts(size, op):
+    arr_np = np.random.random(size)
+    arr_num = num.array(arr_np)
+    for axis in range(arr_np.ndim):
+        out_np = getattr(np, op)(arr_np, axis=axis)
+        out_num = getattr(num, op)(arr_num, axis=axis)
+        assert allclose(out_np, out_num)
+
+
+def test_axis_layouts_where():
+    arr_np = np.random.random((5, 40000))
+    where_np = arr_np > 0.5
+    arr_num = num.array(arr_np)
+    where_num = num.array(where_np)
+    for axis in range(2):
+        out_np = np.sum(arr_np, axis=axis, where=where_np)
+        out_num = num.sum(arr_num, axis=axis, where=where_num)
+        assert allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize("op", ["sum", "nansum", "mean"])
+def test_float32_accuracy(op):
+    # A sequential float32 accumulation of these values is off by several
+    # percent; a pairwise one stays close to the exact sum
+    arr_np = np.full(1 << 22, 0.1, dtype=np.float32)
+    arr_np[::7] = 1.7
+    arr_num = num.array(arr_np)
+    exact = getattr(np, op)(arr_np.astype(np.float64))
+    out_num = getattr(num, op)(arr_num)
+    assert out_num.dtype == np.float32
+    assert np.isclose(out_num, exact, rtol=1e-5, atol=0)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -19,6 +19,9 @@ import pytest
 from utils.generators import mk_0to1_array
 
 import cupynumeric as num
+from cupynumeric._array.thunk import perform_scan
+from cupynumeric._thunk.eager import scan_identity
+from cupynumeric.config import ScanCode
 
 
 def _gen_array(n0, shape, dt, axis, outtype):
@@ -97,6 +100,11 @@ ops = [
     "nancumsum",
     "nancumprod",
 ]
+_ACCUMULATE_UFUNCS = {
+    ScanCode.SUM: "add",
+    ScanCode.MAX: "maximum",
+    ScanCode.LOGICAL_XOR: "logical_xor",
+}
 ops_nan = [
     "nancumsum",
     "nancumprod",
@@ -216,6 +224,52 @@ def test_empty_array(op):
     assert np.array_equal(out_np, out_num)
 
 
+@pytest.mark.parametrize("op", ("cumsum", "nancumsum"))
+@pytest.mark.parametrize("shape", ((4096, 7), (3, 100000), (50000,)), ids=str)
+@pytest.mark.parametrize("axis", (0, -1))
+def test_many_rows_and_long_rows(op, shape, axis):
+    A = mk_0to1_array(np, shape)
+    out_np = getattr(np, op)(A, axis=axis)
+    out_num = getattr(num, op)(num.array(A), axis=axis)
+    assert np.allclose(out_np, out_num)
+
+
+@pytest.mark.parametrize(
+    "ufunc", ("maximum", "minimum", "logical_and", "logical_or", "add")
+)
+@pytest.mark.parametrize("shape", ((100,), (4, 25), (4, 5, 6)), ids=str)
+@pytest.mark.parametrize("dt", (np.int32, np.float64, bool))
+def test_ufunc_accumulate(ufunc, shape, dt):
+    A = (np.random.random(shape) * 10 - 5).astype(dt)
+    for axis in range(len(shape)):
+        out_np = getattr(np, ufunc).accumulate(A, axis=axis)
+        out_num = getattr(num, ufunc).accumulate(num.array(A), axis=axis)
+        assert np.array_equal(out_np, out_num)
+
+
+def test_maximum_accumulate_nan():
+    A = np.array([1.0, 3.0, np.nan, 5.0, 2.0])
+    out_np = np.maximum.accumulate(A)
+    out_num = num.maximum.accumulate(num.array(A))
+    assert np.array_equal(out_np, out_num, equal_nan=True)
+
+
+@pytest.mark.parametrize(
+    "op", (ScanCode.SUM, ScanCode.MAX, ScanCode.LOGICAL_XOR), ids=str
+)
+@pytest.mark.parametrize("shape", ((100,), (4, 25)), ids=str)
+def test_exclusive_scan(op, shape):
+    dt = bool if op is ScanCode.LOGICAL_XOR else np.int64
+    A = np.random.randint(0, 5, size=shape).astype(dt)
+    inclusive = getattr(np, _ACCUMULATE_UFUNCS[op]).accumulate(A, axis=-1)
+    expected = np.empty_like(inclusive)
+    expected[..., 1:] = inclusive[..., :-1]
+    expected[..., 0] = scan_identity(op, np.dtype(dt))
+
+    out_num = perform_scan(op, num.array(A), axis=-1, exclusive=True)
+    assert np.array_equal(expected, out_num)
+
+
 @pytest.mark.parametrize("op", ops)
 def test_scalar(op):
     A = 1
@@ -191,6 +191,28 @@ def test_var_corners(dtype, ddof, axis, shape):
     check_op(op_np, op_num, np_in, dtype)
 
 
+@pytest.mark.parametrize("axis", [None, 0, 1])
+@pytest.mark.parametrize("shape", [(3000, 40), (40, 3000)])
+def test_var_large_offset(axis, shape):
+    # A large mean makes the naive <x^2> - <x>^2 formula lose every digit
+    np_in = get_op_input(shape=shape, offset=1e8)
+
+    op_np = functools.partial(np.var, axis=axis, ddof=1)
+    op_num = functools.partial(num.var, axis=axis, ddof=1)
+
+    check_op(op_np, op_num, np_in, "d")
+
+
+@pytest.mark.parametrize("axis", [None, 0, 1])
+def test_var_int(axis):
+    np_in = get_op_input(shape=(50, 60), a_min=-100, a_max=100, randint=True)
+
+    op_np = functools.partial(np.var, axis=axis)
+    op_num = functools.partial(num.var, axis=axis)
+
+    check_op(op_np, op_num, np_in, "d")
+
+
 @pytest.mark.xfail
 @pytest.mark.parametrize("dtype", dtypes)
 @pytest.mark.parametrize("ddof", [0, 1])
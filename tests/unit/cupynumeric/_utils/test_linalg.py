@@ -96,6 +96,43 @@ def test_matmul_modes(a: int, b: int) -> None:
     assert _matmul_modes_oracle(a, b)
 
 
+class Test_matmul_launch_shape:
+    def test_single_proc(self) -> None:
+        assert m.matmul_launch_shape(100, 100, 100, 1, 8, 1 << 27) == (
+            (1, 1),
+            1,
+        )
+
+    def test_square(self) -> None:
+        assert m.matmul_launch_shape(1000, 1000, 1000, 4, 8, 1 << 27) == (
+            (2, 2),
+            1,
+        )
+
+    def test_tall_result(self) -> None:
+        assert m.matmul_launch_shape(4096, 8, 1000, 8, 8, 1 << 27) == (
+            (8, 1),
+            1,
+        )
+
+    def test_deep_contraction_replicates(self) -> None:
+        assert m.matmul_launch_shape(64, 64, 1 << 20, 16, 8, 1 << 27) == (
+            (1, 1),
+            16,
+        )
+
+    def test_replica_budget(self) -> None:
+        # The same shape may not replicate once partial tiles don't fit
+        (pm, pn), c = m.matmul_launch_shape(64, 64, 1 << 20, 16, 8, 1024)
+        assert c == 1
+        assert pm * pn == 16
+
+    @pytest.mark.parametrize("procs", (1, 2, 3, 6, 12, 64))
+    def test_uses_all_procs(self, procs: int) -> None:
+        (pm, pn), c = m.matmul_launch_shape(500, 300, 2000, procs, 4, 4096)
+        assert pm * pn * c == procs
+
+
 AxesType = int | tuple[int, int] | tuple[list[int], list[int]]
 
 
@@ -58,6 +58,7 @@ def test_CuPyNumericOpCode() -> None:
         "ARANGE",
         "ARGWHERE",
         "BATCHED_CHOLESKY",
+        "BATCHED_MATMUL",
         "BINARY_OP",
         "BINARY_RED",
         "BINCOUNT",
@@ -66,6 +67,8 @@ def test_CuPyNumericOpCode() -> None:
         "CONTRACT",
         "CONVERT",
         "CONVOLVE",
+        "CSR_HALO",
+        "CSR_POS",
         "DIAG",
         "DOT",
         "EYE",
@@ -81,6 +84,7 @@ def test_CuPyNumericOpCode() -> None:
         "MP_SOLVE",
         "NONZERO",
         "PACKBITS",
+        "PACKED_COMPARE",
         "POTRF",
         "PUTMASK",
         "QR",
@@ -93,6 +97,8 @@ def test_CuPyNumericOpCode() -> None:
         "SCAN_LOCAL",
         "SOLVE",
         "SORT",
+        "SPMM",
+        "SPMV",
         "SEARCHSORTED",
         "SVD",
         "SYRK",
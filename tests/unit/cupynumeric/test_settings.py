@@ -28,7 +28,11 @@ _expected_settings = (
     "report_coverage",
     "report_dump_callstack",
     "report_dump_csv",
+    "report_perf_counters",
+    "report_perf_dump",
     "numpy_compat",
+    "pairwise_sum",
+    "packed_masks",
     "fast_math",
     "min_gpu_chunk",
     "min_cpu_chunk",
@@ -72,7 +76,13 @@ class TestSettings:
             == 'bool ("0" or "1")'
         )
         assert m.settings.report_dump_csv.convert_type == "str"
+        assert (
+            m.settings.report_perf_counters.convert_type == 'bool ("0" or "1")'
+        )
+        assert m.settings.report_perf_dump.convert_type == "str"
         assert m.settings.numpy_compat.convert_type == 'bool ("0" or "1")'
+        assert m.settings.pairwise_sum.convert_type == 'bool ("0" or "1")'
+        assert m.settings.packed_masks.convert_type == 'bool ("0" or "1")'
 
 
 class TestDefaults:
@@ -91,9 +101,21 @@ class TestDefaults:
     def test_report_dump_csv(self) -> None:
         assert m.settings.report_dump_csv.default is None
 
+    def test_report_perf_counters(self) -> None:
+        assert m.settings.report_perf_counters.default is False
+
+    def test_report_perf_dump(self) -> None:
+        assert m.settings.report_perf_dump.default is None
+
     def test_numpy_compat(self) -> None:
         assert m.settings.numpy_compat.default is False
 
+    def test_pairwise_sum(self) -> None:
+        assert m.settings.pairwise_sum.default is True
+
+    def test_packed_masks(self) -> None:
+        assert m.settings.packed_masks.default is False
+
     @pytest.mark.skip(reason="Does not work in CI (path issue)")
     @pytest.mark.parametrize("name", _settings_with_test_defaults)
     def test_default(self, name: str) -> None: